@@ -51,6 +51,7 @@ uint8_t hdc2080_basic_init(hdc2080_address_t addr_pin)
     uint8_t res;
     uint8_t reg;
     int8_t offset;
+    hdc2080_config_t config;
     
     /* link interface function */
     DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
@@ -59,6 +60,7 @@ uint8_t hdc2080_basic_init(hdc2080_address_t addr_pin)
     DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
     DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
     DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
     DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
     
     /* set addr pin */
@@ -79,75 +81,21 @@ uint8_t hdc2080_basic_init(hdc2080_address_t addr_pin)
         return 1;
     }
     
-    /* set default temperature resolution */
-    res = hdc2080_set_temperature_resolution(&gs_handle, HDC2080_BASIC_DEFAULT_TEMPERATURE_RESOLUTION);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set temperature resolution failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set default humidity resolution */
-    res = hdc2080_set_humidity_resolution(&gs_handle, HDC2080_BASIC_DEFAULT_HUMIDITY_RESOLUTION);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set humidity resolution failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set humidity and temperature */
-    res = hdc2080_set_mode(&gs_handle, HDC2080_MODE_HUMIDITY_TEMPERATURE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set mode failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set default heater */
-    res = hdc2080_set_heater(&gs_handle, HDC2080_BASIC_DEFAULT_HEATER);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set heater failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable interrupt pin */
-    res = hdc2080_set_interrupt_pin(&gs_handle, HDC2080_BOOL_FALSE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set interrupt pin failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set default interrupt polarity */
-    res = hdc2080_set_interrupt_polarity(&gs_handle, HDC2080_BASIC_DEFAULT_INTERRUPT_POLARITY);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set interrupt polarity failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set default interrupt mode */
-    res = hdc2080_set_interrupt_mode(&gs_handle, HDC2080_BASIC_DEFAULT_INTERRUPT_MODE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set interrupt mode failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
+    /* default config */
+    config.temperature_resolution = HDC2080_BASIC_DEFAULT_TEMPERATURE_RESOLUTION;
+    config.humidity_resolution = HDC2080_BASIC_DEFAULT_HUMIDITY_RESOLUTION;
+    config.mode = HDC2080_MODE_HUMIDITY_TEMPERATURE;
+    config.heater = HDC2080_BASIC_DEFAULT_HEATER;
+    config.interrupt_pin = HDC2080_BOOL_FALSE;
+    config.interrupt_polarity = HDC2080_BASIC_DEFAULT_INTERRUPT_POLARITY;
+    config.interrupt_mode = HDC2080_BASIC_DEFAULT_INTERRUPT_MODE;
+    config.auto_measurement_mode = HDC2080_BASIC_DEFAULT_AUTO_MEASUREMENT_MODE;
+    config.drdy_interrupt = HDC2080_BOOL_FALSE;
+    config.temperature_high_threshold_interrupt = HDC2080_BOOL_FALSE;
+    config.temperature_low_threshold_interrupt = HDC2080_BOOL_FALSE;
+    config.humidity_high_threshold_interrupt = HDC2080_BOOL_FALSE;
+    config.humidity_low_threshold_interrupt = HDC2080_BOOL_FALSE;
+    config.measurement = HDC2080_BOOL_TRUE;
     
     /* 0.0% */
     res = hdc2080_humidity_convert_to_register(&gs_handle, 0.0f, &reg);
@@ -158,26 +106,8 @@ uint8_t hdc2080_basic_init(hdc2080_address_t addr_pin)
         
         return 1;
     }
-    
-    /* set humidity high threshold */
-    res = hdc2080_set_humidity_high_threshold(&gs_handle, reg);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set humidity high threshold failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set humidity low threshold */
-    res = hdc2080_set_humidity_low_threshold(&gs_handle, reg);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set humidity low threshold failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
+    config.humidity_high_threshold = reg;
+    config.humidity_low_threshold = reg;
     
     /* 0.0 */
     res = hdc2080_temperature_convert_to_register(&gs_handle, 0.0f, &reg);
@@ -188,26 +118,8 @@ uint8_t hdc2080_basic_init(hdc2080_address_t addr_pin)
         
         return 1;
     }
-    
-    /* set temperature high threshold */
-    res = hdc2080_set_temperature_high_threshold(&gs_handle, reg);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set temperature high threshold failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set temperature low threshold */
-    res = hdc2080_set_temperature_low_threshold(&gs_handle, reg);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set temperature low threshold failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
+    config.temperature_high_threshold = reg;
+    config.temperature_low_threshold = reg;
     
     /* set default offset */
     res = hdc2080_humidity_offset_convert_to_register(&gs_handle, HDC2080_BASIC_DEFAULT_HUMIDITY_OFFSET, &offset);
@@ -218,16 +130,7 @@ uint8_t hdc2080_basic_init(hdc2080_address_t addr_pin)
         
         return 1;
     }
-    
-    /* set humidity offset adjustment */
-    res = hdc2080_set_humidity_offset_adjustment(&gs_handle, offset);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set humidity offset adjustment failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
+    config.humidity_offset = offset;
     
     /* set default offset */
     res = hdc2080_temperature_offset_convert_to_register(&gs_handle, HDC2080_BASIC_DEFAULT_TEMPERATURE_OFFSET, &offset);
@@ -238,82 +141,13 @@ uint8_t hdc2080_basic_init(hdc2080_address_t addr_pin)
         
         return 1;
     }
+    config.temperature_offset = offset;
     
-    /* set temperature offset adjustment */
-    res = hdc2080_set_temperature_offset_adjustment(&gs_handle, offset);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set temperature offset adjustment failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable data ready */
-    res = hdc2080_set_interrupt(&gs_handle, HDC2080_INTERRUPT_DRDY, HDC2080_BOOL_FALSE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set interrupt failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable temperature high threshold */
-    res = hdc2080_set_interrupt(&gs_handle, HDC2080_INTERRUPT_TEMPERATURE_HIGH_THRESHOLD, HDC2080_BOOL_FALSE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set interrupt failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable temperature low threshold */
-    res = hdc2080_set_interrupt(&gs_handle, HDC2080_INTERRUPT_TEMPERATURE_LOW_THRESHOLD, HDC2080_BOOL_FALSE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set interrupt failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable humidity high threshold */
-    res = hdc2080_set_interrupt(&gs_handle, HDC2080_INTERRUPT_HUMIDITY_HIGH_THRESHOLD, HDC2080_BOOL_FALSE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set interrupt failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable humidity low threshold */
-    res = hdc2080_set_interrupt(&gs_handle, HDC2080_INTERRUPT_HUMIDITY_LOW_THRESHOLD, HDC2080_BOOL_FALSE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set interrupt failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set default auto measurement mode */
-    res = hdc2080_set_auto_measurement_mode(&gs_handle, HDC2080_BASIC_DEFAULT_AUTO_MEASUREMENT_MODE);
-    if (res != 0)
-    {
-        hdc2080_interface_debug_print("hdc2080: set auto measurement mode failed.\n");
-        (void)hdc2080_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* enable measurement */
-    res = hdc2080_set_measurement(&gs_handle, HDC2080_BOOL_TRUE);
+    /* apply config */
+    res = hdc2080_apply_config(&gs_handle, &config);
     if (res != 0)
     {
-        hdc2080_interface_debug_print("hdc2080: set measurement failed.\n");
+        hdc2080_interface_debug_print("hdc2080: apply config failed.\n");
         (void)hdc2080_deinit(&gs_handle);
         
         return 1;
@@ -65,6 +65,7 @@ uint8_t hdc2080_interrupt_init(hdc2080_address_t addr_pin,
     DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
     DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
     DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
     DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
     
     /* set addr pin */
@@ -379,3 +380,23 @@ uint8_t hdc2080_interrupt_deinit(void)
 
     return 0;
 }
+
+/**
+ * @brief      interrupt example irq handler
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       call it after the interrupt pin edge, reading the status releases the pin
+ *             so the next conversion makes a new edge
+ */
+uint8_t hdc2080_interrupt_irq_handler(uint8_t *status)
+{
+    /* read and clear the status */
+    if (hdc2080_get_interrupt_status(&gs_handle, status) != 0)
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -55,7 +55,7 @@ extern "C"{
 #define HDC2080_INTERRUPT_DEFAULT_HUMIDITY_RESOLUTION            HDC2080_RESOLUTION_14_BIT              /**< 14bits */
 #define HDC2080_INTERRUPT_DEFAULT_HEATER                         HDC2080_BOOL_FALSE                     /**< disable heater */
 #define HDC2080_INTERRUPT_DEFAULT_INTERRUPT_POLARITY             HDC2080_INTERRUPT_POLARITY_LOW         /**< active low */
-#define HDC2080_INTERRUPT_DEFAULT_INTERRUPT_MODE                 HDC2080_INTERRUPT_MODE_COMPARATOR      /**< comparator mode */
+#define HDC2080_INTERRUPT_DEFAULT_INTERRUPT_MODE                 HDC2080_INTERRUPT_MODE_LEVEL           /**< level sensitive mode */
 #define HDC2080_INTERRUPT_DEFAULT_AUTO_MEASUREMENT_MODE          HDC2080_AUTO_MEASUREMENT_MODE_5_HZ     /**< 5hz */
 #define HDC2080_INTERRUPT_DEFAULT_TEMPERATURE_OFFSET             0.0f                                   /**< 0.0 deg */
 #define HDC2080_INTERRUPT_DEFAULT_HUMIDITY_OFFSET                0.0f                                   /**< 0.0f % */
@@ -96,6 +96,17 @@ uint8_t hdc2080_interrupt_deinit(void);
  */
 uint8_t hdc2080_interrupt_read(float *temperature, float *humidity);
 
+/**
+ * @brief      interrupt example irq handler
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       call it after the interrupt pin edge, reading the status releases the pin
+ *             so the next conversion makes a new edge
+ */
+uint8_t hdc2080_interrupt_irq_handler(uint8_t *status);
+
 /**
  * @}
  */
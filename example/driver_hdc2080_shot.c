@@ -59,6 +59,7 @@ uint8_t hdc2080_shot_init(hdc2080_address_t addr_pin)
     DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
     DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
     DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
     DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
     
     /* set addr pin */
@@ -92,6 +92,101 @@ uint8_t hdc2080_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uin
     return 0;
 }
 
+/**
+ * @brief         interface iic bus init with a bus context
+ * @param[in,out] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 iic init failed
+ * @note          the bus is selected by the context name
+ */
+uint8_t hdc2080_interface_iic_init_ctx(void *ctx)
+{
+    return 0;
+}
+
+/**
+ * @brief         interface iic bus deinit with a bus context
+ * @param[in,out] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 iic deinit failed
+ * @note          none
+ */
+uint8_t hdc2080_interface_iic_deinit_ctx(void *ctx)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read with a bus context
+ * @param[in]  *ctx pointer to an hdc2080_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t hdc2080_interface_iic_read_ctx(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write with a bus context
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t hdc2080_interface_iic_write_ctx(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief         interface iic bus batch read
+ * @param[in]     *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @param[in,out] *batch pointer to a batch entry table
+ * @param[in]     num batch entry number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          all entries should be issued with as few bus calls as the platform allows
+ */
+uint8_t hdc2080_interface_iic_read_batch(void *ctx, hdc2080_iic_batch_t *batch, uint16_t num)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface bus lock
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @note      the handles on the same bus share one lock
+ */
+void hdc2080_interface_lock(void *ctx)
+{
+    
+}
+
+/**
+ * @brief     interface bus unlock
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @note      none
+ */
+void hdc2080_interface_unlock(void *ctx)
+{
+    
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -102,6 +197,16 @@ void hdc2080_interface_delay_ms(uint32_t ms)
 
 }
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void hdc2080_interface_delay_us(uint32_t us)
+{
+
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -0,0 +1,564 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bus_bench.c
+ * @brief     bus bench source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_interface.h"
+#include "driver_hdc2080_basic.h"
+#include "driver_hdc2080_shot.h"
+#include "driver_hdc2080_interrupt.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief bus counter structure definition
+ */
+typedef struct bench_counter_s
+{
+    uint32_t reads;              /**< read transactions */
+    uint32_t writes;             /**< write transactions */
+    uint32_t read_bytes;         /**< bytes read from the device */
+    uint32_t write_bytes;        /**< bytes written to the device with the register pointer */
+    uint32_t delays;             /**< delay calls */
+    uint64_t delay_us;           /**< requested delay time */
+} bench_counter_t;
+
+static bench_counter_t gs_counter;        /**< bus counter */
+static hdc2080_handle_t gs_handle;        /**< hdc2080 handle */
+static FILE *gs_out;                      /**< json output */
+static uint32_t gs_entries;               /**< json entries */
+
+/**
+ * @brief the real interface functions behind the linker wrap
+ */
+uint8_t __real_hdc2080_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+uint8_t __real_hdc2080_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+uint8_t __real_hdc2080_interface_iic_read_batch(void *ctx, hdc2080_iic_batch_t *batch, uint16_t num);
+void __real_hdc2080_interface_delay_ms(uint32_t ms);
+void __real_hdc2080_interface_delay_us(uint32_t us);
+
+/**
+ * @brief counting shim prototypes
+ */
+uint8_t __wrap_hdc2080_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+uint8_t __wrap_hdc2080_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+uint8_t __wrap_hdc2080_interface_iic_read_batch(void *ctx, hdc2080_iic_batch_t *batch, uint16_t num);
+void __wrap_hdc2080_interface_delay_ms(uint32_t ms);
+void __wrap_hdc2080_interface_delay_us(uint32_t us);
+
+/**
+ * @brief      counting iic read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the register pointer byte is counted as a written byte
+ */
+uint8_t __wrap_hdc2080_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_counter.reads++;
+    gs_counter.write_bytes += 1;
+    gs_counter.read_bytes += len;
+    
+    return __real_hdc2080_interface_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     counting iic write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the register pointer byte is counted as a written byte
+ */
+uint8_t __wrap_hdc2080_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_counter.writes++;
+    gs_counter.write_bytes += 1 + (uint32_t)len;
+    
+    return __real_hdc2080_interface_iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief         counting iic batch read
+ * @param[in]     *ctx pointer to a bus context
+ * @param[in,out] *batch pointer to a batch entry table
+ * @param[in]     num batch entry number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          one batch is counted as one read, the register pointer bytes are counted as written bytes
+ */
+uint8_t __wrap_hdc2080_interface_iic_read_batch(void *ctx, hdc2080_iic_batch_t *batch, uint16_t num)
+{
+    uint16_t i;
+    
+    gs_counter.reads++;
+    for (i = 0; i < num; i++)
+    {
+        gs_counter.write_bytes += 1;
+        gs_counter.read_bytes += batch[i].len;
+    }
+    
+    return __real_hdc2080_interface_iic_read_batch(ctx, batch, num);
+}
+
+/**
+ * @brief     counting delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+void __wrap_hdc2080_interface_delay_ms(uint32_t ms)
+{
+    gs_counter.delays++;
+    gs_counter.delay_us += (uint64_t)ms * 1000;
+    
+    __real_hdc2080_interface_delay_ms(ms);
+}
+
+/**
+ * @brief     counting delay us
+ * @param[in] us time
+ * @note      none
+ */
+void __wrap_hdc2080_interface_delay_us(uint32_t us)
+{
+    gs_counter.delays++;
+    gs_counter.delay_us += us;
+    
+    __real_hdc2080_interface_delay_us(us);
+}
+
+/**
+ * @brief  start a measured call
+ * @note   none
+ */
+static void a_bench_begin(void)
+{
+    memset(&gs_counter, 0, sizeof(bench_counter_t));
+}
+
+/**
+ * @brief     finish a measured call and emit its json entry
+ * @param[in] *group entry group
+ * @param[in] *name function name
+ * @param[in] cache register cache state
+ * @param[in] status returned status code
+ * @note      none
+ */
+static void a_bench_end(const char *group, const char *name, hdc2080_bool_t cache, uint8_t status)
+{
+    fprintf(gs_out, "%s\n    {\"group\": \"%s\", \"name\": \"%s\", \"cache\": %s, \"status\": %d, "
+            "\"transactions\": %u, \"reads\": %u, \"writes\": %u, \"read_bytes\": %u, \"write_bytes\": %u, "
+            "\"delays\": %u, \"delay_us\": %llu}",
+            (gs_entries != 0) ? "," : "", group, name, (cache == HDC2080_BOOL_TRUE) ? "true" : "false", status,
+            gs_counter.reads + gs_counter.writes, gs_counter.reads, gs_counter.writes,
+            gs_counter.read_bytes, gs_counter.write_bytes,
+            gs_counter.delays, (unsigned long long)gs_counter.delay_us);
+    gs_entries++;
+}
+
+/**
+ * @brief measure one driver call
+ */
+#define BENCH_API(NAME, CALL)                                     \
+    do {                                                          \
+        a_bench_begin();                                          \
+        res = (CALL);                                             \
+        a_bench_end("api", NAME, cache, res);                     \
+    } while (0)
+
+/**
+ * @brief measure one example call
+ */
+#define BENCH_EXAMPLE(NAME, CALL)                                 \
+    do {                                                          \
+        a_bench_begin();                                          \
+        res = (CALL);                                             \
+        a_bench_end("example", NAME, HDC2080_BOOL_FALSE, res);    \
+    } while (0)
+
+/**
+ * @brief     measure every public api
+ * @param[in] addr_pin address pin
+ * @param[in] cache register cache state
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_bench_api(hdc2080_address_t addr_pin, hdc2080_bool_t cache)
+{
+    uint8_t res;
+    uint8_t value;
+    int8_t offset;
+    uint8_t buf[1];
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    int16_t temperature_centi;
+    uint16_t humidity_centi;
+    hdc2080_address_t addr;
+    hdc2080_bool_t enable;
+    hdc2080_resolution_t resolution;
+    hdc2080_mode_t mode;
+    hdc2080_auto_measurement_mode_t auto_mode;
+    hdc2080_interrupt_polarity_t polarity;
+    hdc2080_interrupt_mode_t interrupt_mode;
+    hdc2080_config_t config;
+    hdc2080_snapshot_t snapshot;
+    hdc2080_handle_t *all[1];
+    hdc2080_info_t info;
+#if (HDC2080_USE_FLOAT == 1)
+    float temperature;
+    float humidity;
+#endif
+    
+    /* link interface function */
+    DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t);
+    DRIVER_HDC2080_LINK_IIC_INIT(&gs_handle, hdc2080_interface_iic_init);
+    DRIVER_HDC2080_LINK_IIC_DEINIT(&gs_handle, hdc2080_interface_iic_deinit);
+    DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
+    DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
+    DRIVER_HDC2080_LINK_IIC_READ_BATCH(&gs_handle, hdc2080_interface_iic_read_batch);
+    DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
+    all[0] = &gs_handle;
+    
+    /* basic */
+    BENCH_API("hdc2080_info", hdc2080_info(&info));
+    BENCH_API("hdc2080_set_addr_pin", hdc2080_set_addr_pin(&gs_handle, addr_pin));
+    BENCH_API("hdc2080_get_addr_pin", hdc2080_get_addr_pin(&gs_handle, &addr));
+    BENCH_API("hdc2080_init", hdc2080_init(&gs_handle));
+    if (res != 0)
+    {
+        return 1;
+    }
+    BENCH_API("hdc2080_set_register_cache", hdc2080_set_register_cache(&gs_handle, cache));
+    BENCH_API("hdc2080_get_register_cache", hdc2080_get_register_cache(&gs_handle, &enable));
+    BENCH_API("hdc2080_get_config", hdc2080_get_config(&gs_handle, &config));
+    BENCH_API("hdc2080_apply_config", hdc2080_apply_config(&gs_handle, &config));
+    
+    /* read */
+    BENCH_API("hdc2080_trigger_measurement", hdc2080_trigger_measurement(&gs_handle));
+    BENCH_API("hdc2080_read_poll", hdc2080_read_poll(&gs_handle));
+    BENCH_API("hdc2080_try_fetch_centi", hdc2080_try_fetch_centi(&gs_handle, &temperature_raw, &temperature_centi,
+                                                                 &humidity_raw, &humidity_centi));
+#if (HDC2080_USE_FLOAT == 1)
+    BENCH_API("hdc2080_try_fetch", hdc2080_try_fetch(&gs_handle, &temperature_raw, &temperature, &humidity_raw, &humidity));
+    BENCH_API("hdc2080_read_temperature_humidity", hdc2080_read_temperature_humidity(&gs_handle, &temperature_raw, &temperature,
+                                                                                     &humidity_raw, &humidity));
+    BENCH_API("hdc2080_read_temperature", hdc2080_read_temperature(&gs_handle, &temperature_raw, &temperature));
+    BENCH_API("hdc2080_read_humidity", hdc2080_read_humidity(&gs_handle, &humidity_raw, &humidity));
+#endif
+    BENCH_API("hdc2080_read_temperature_humidity_centi", hdc2080_read_temperature_humidity_centi(&gs_handle, &temperature_raw, &temperature_centi,
+                                                                                                 &humidity_raw, &humidity_centi));
+    BENCH_API("hdc2080_read_temperature_centi", hdc2080_read_temperature_centi(&gs_handle, &temperature_raw, &temperature_centi));
+    BENCH_API("hdc2080_read_humidity_centi", hdc2080_read_humidity_centi(&gs_handle, &humidity_raw, &humidity_centi));
+    BENCH_API("hdc2080_read_snapshot", hdc2080_read_snapshot(&gs_handle, &snapshot));
+    BENCH_API("hdc2080_read_all", hdc2080_read_all(all, 1, &snapshot));
+    
+    /* config */
+    BENCH_API("hdc2080_set_temperature_resolution", hdc2080_set_temperature_resolution(&gs_handle, HDC2080_RESOLUTION_14_BIT));
+    BENCH_API("hdc2080_get_temperature_resolution", hdc2080_get_temperature_resolution(&gs_handle, &resolution));
+    BENCH_API("hdc2080_set_humidity_resolution", hdc2080_set_humidity_resolution(&gs_handle, HDC2080_RESOLUTION_14_BIT));
+    BENCH_API("hdc2080_get_humidity_resolution", hdc2080_get_humidity_resolution(&gs_handle, &resolution));
+    BENCH_API("hdc2080_set_mode", hdc2080_set_mode(&gs_handle, HDC2080_MODE_HUMIDITY_TEMPERATURE));
+    BENCH_API("hdc2080_get_mode", hdc2080_get_mode(&gs_handle, &mode));
+    BENCH_API("hdc2080_set_measurement", hdc2080_set_measurement(&gs_handle, HDC2080_BOOL_FALSE));
+    BENCH_API("hdc2080_get_measurement", hdc2080_get_measurement(&gs_handle, &enable));
+    BENCH_API("hdc2080_set_auto_measurement_mode", hdc2080_set_auto_measurement_mode(&gs_handle, HDC2080_AUTO_MEASUREMENT_MODE_DISABLED));
+    BENCH_API("hdc2080_get_auto_measurement_mode", hdc2080_get_auto_measurement_mode(&gs_handle, &auto_mode));
+    BENCH_API("hdc2080_set_heater", hdc2080_set_heater(&gs_handle, HDC2080_BOOL_FALSE));
+    BENCH_API("hdc2080_get_heater", hdc2080_get_heater(&gs_handle, &enable));
+    BENCH_API("hdc2080_set_interrupt_pin", hdc2080_set_interrupt_pin(&gs_handle, HDC2080_BOOL_FALSE));
+    BENCH_API("hdc2080_get_interrupt_pin", hdc2080_get_interrupt_pin(&gs_handle, &enable));
+    BENCH_API("hdc2080_set_interrupt_polarity", hdc2080_set_interrupt_polarity(&gs_handle, HDC2080_INTERRUPT_POLARITY_LOW));
+    BENCH_API("hdc2080_get_interrupt_polarity", hdc2080_get_interrupt_polarity(&gs_handle, &polarity));
+    BENCH_API("hdc2080_set_interrupt_mode", hdc2080_set_interrupt_mode(&gs_handle, HDC2080_INTERRUPT_MODE_LEVEL));
+    BENCH_API("hdc2080_get_interrupt_mode", hdc2080_get_interrupt_mode(&gs_handle, &interrupt_mode));
+    BENCH_API("hdc2080_set_humidity_high_threshold", hdc2080_set_humidity_high_threshold(&gs_handle, 0xFF));
+    BENCH_API("hdc2080_get_humidity_high_threshold", hdc2080_get_humidity_high_threshold(&gs_handle, &value));
+    BENCH_API("hdc2080_set_humidity_low_threshold", hdc2080_set_humidity_low_threshold(&gs_handle, 0x00));
+    BENCH_API("hdc2080_get_humidity_low_threshold", hdc2080_get_humidity_low_threshold(&gs_handle, &value));
+    BENCH_API("hdc2080_set_temperature_high_threshold", hdc2080_set_temperature_high_threshold(&gs_handle, 0xFF));
+    BENCH_API("hdc2080_get_temperature_high_threshold", hdc2080_get_temperature_high_threshold(&gs_handle, &value));
+    BENCH_API("hdc2080_set_temperature_low_threshold", hdc2080_set_temperature_low_threshold(&gs_handle, 0x01));
+    BENCH_API("hdc2080_get_temperature_low_threshold", hdc2080_get_temperature_low_threshold(&gs_handle, &value));
+    BENCH_API("hdc2080_set_humidity_offset_adjustment", hdc2080_set_humidity_offset_adjustment(&gs_handle, 0));
+    BENCH_API("hdc2080_get_humidity_offset_adjustment", hdc2080_get_humidity_offset_adjustment(&gs_handle, &offset));
+    BENCH_API("hdc2080_set_temperature_offset_adjustment", hdc2080_set_temperature_offset_adjustment(&gs_handle, 0));
+    BENCH_API("hdc2080_get_temperature_offset_adjustment", hdc2080_get_temperature_offset_adjustment(&gs_handle, &offset));
+    BENCH_API("hdc2080_set_interrupt", hdc2080_set_interrupt(&gs_handle, HDC2080_INTERRUPT_DRDY, HDC2080_BOOL_FALSE));
+    BENCH_API("hdc2080_get_interrupt", hdc2080_get_interrupt(&gs_handle, HDC2080_INTERRUPT_DRDY, &enable));
+    BENCH_API("hdc2080_set_humidity_max", hdc2080_set_humidity_max(&gs_handle, 0x00));
+    BENCH_API("hdc2080_get_humidity_max", hdc2080_get_humidity_max(&gs_handle, &value));
+    BENCH_API("hdc2080_set_temperature_max", hdc2080_set_temperature_max(&gs_handle, 0x00));
+    BENCH_API("hdc2080_get_temperature_max", hdc2080_get_temperature_max(&gs_handle, &value));
+    BENCH_API("hdc2080_get_interrupt_status", hdc2080_get_interrupt_status(&gs_handle, &value));
+    
+    /* convert */
+#if (HDC2080_USE_FLOAT == 1)
+    BENCH_API("hdc2080_humidity_convert_to_register", hdc2080_humidity_convert_to_register(&gs_handle, 50.0f, &value));
+    BENCH_API("hdc2080_humidity_convert_to_data", hdc2080_humidity_convert_to_data(&gs_handle, value, &humidity));
+    BENCH_API("hdc2080_temperature_convert_to_register", hdc2080_temperature_convert_to_register(&gs_handle, 25.0f, &value));
+    BENCH_API("hdc2080_temperature_convert_to_data", hdc2080_temperature_convert_to_data(&gs_handle, value, &temperature));
+    BENCH_API("hdc2080_humidity_offset_convert_to_register", hdc2080_humidity_offset_convert_to_register(&gs_handle, 1.0f, &offset));
+    BENCH_API("hdc2080_humidity_offset_convert_to_data", hdc2080_humidity_offset_convert_to_data(&gs_handle, offset, &humidity));
+    BENCH_API("hdc2080_temperature_offset_convert_to_register", hdc2080_temperature_offset_convert_to_register(&gs_handle, 1.0f, &offset));
+    BENCH_API("hdc2080_temperature_offset_convert_to_data", hdc2080_temperature_offset_convert_to_data(&gs_handle, offset, &temperature));
+#endif
+    
+    /* register */
+    BENCH_API("hdc2080_get_reg", hdc2080_get_reg(&gs_handle, 0xFC, buf, 1));
+    BENCH_API("hdc2080_set_reg", hdc2080_set_reg(&gs_handle, 0x08, buf, 0));
+    BENCH_API("hdc2080_soft_reset", hdc2080_soft_reset(&gs_handle));
+    BENCH_API("hdc2080_deinit", hdc2080_deinit(&gs_handle));
+    
+    return 0;
+}
+
+/**
+ * @brief     measure the examples
+ * @param[in] addr_pin address pin
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_bench_example(hdc2080_address_t addr_pin)
+{
+    uint8_t res;
+    float temperature;
+    float humidity;
+    
+    /* basic */
+    BENCH_EXAMPLE("hdc2080_basic_init", hdc2080_basic_init(addr_pin));
+    if (res != 0)
+    {
+        return 1;
+    }
+    BENCH_EXAMPLE("hdc2080_basic_read", hdc2080_basic_read(&temperature, &humidity));
+    BENCH_EXAMPLE("hdc2080_basic_deinit", hdc2080_basic_deinit());
+    
+    /* shot */
+    BENCH_EXAMPLE("hdc2080_shot_init", hdc2080_shot_init(addr_pin));
+    if (res != 0)
+    {
+        return 1;
+    }
+    BENCH_EXAMPLE("hdc2080_shot_read", hdc2080_shot_read(&temperature, &humidity));
+    BENCH_EXAMPLE("hdc2080_shot_deinit", hdc2080_shot_deinit());
+    
+    /* interrupt */
+    BENCH_EXAMPLE("hdc2080_interrupt_init", hdc2080_interrupt_init(addr_pin, 50.0f, 10.0f, 80.0f, 20.0f));
+    if (res != 0)
+    {
+        return 1;
+    }
+    BENCH_EXAMPLE("hdc2080_interrupt_read", hdc2080_interrupt_read(&temperature, &humidity));
+    BENCH_EXAMPLE("hdc2080_interrupt_deinit", hdc2080_interrupt_deinit());
+    
+    return 0;
+}
+
+/**
+ * @brief     bus bench full function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+static uint8_t a_bus_bench(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "ho:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"output", required_argument, NULL, 'o'},
+        {"addr", required_argument, NULL, 1},
+        {NULL, 0, NULL, 0},
+    };
+    hdc2080_address_t addr_pin = HDC2080_ADDRESS_0;
+    char *path = NULL;
+    uint8_t res;
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                hdc2080_interface_debug_print("Usage:\n");
+                hdc2080_interface_debug_print("  hdc2080_bus_bench [--addr=<0 | 1>] [-o <path> | --output=<path>]\n");
+                hdc2080_interface_debug_print("\n");
+                hdc2080_interface_debug_print("Options:\n");
+                hdc2080_interface_debug_print("      --addr=<0 | 1>             Set the iic address.([default: 0])\n");
+                hdc2080_interface_debug_print("  -h, --help                     Show the help.\n");
+                hdc2080_interface_debug_print("  -o <path>, --output=<path>     Write the json report to a file.([default: stdout])\n");
+                
+                return 0;
+            }
+            
+            /* output */
+            case 'o' :
+            {
+                path = optarg;
+                
+                break;
+            }
+            
+            /* address */
+            case 1 :
+            {
+                if (strcmp("0", optarg) == 0)
+                {
+                    addr_pin = HDC2080_ADDRESS_0;
+                }
+                else if (strcmp("1", optarg) == 0)
+                {
+                    addr_pin = HDC2080_ADDRESS_1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+    
+    /* open the output */
+    if (path != NULL)
+    {
+        gs_out = fopen(path, "w");
+        if (gs_out == NULL)
+        {
+            perror("bus bench: open output failed.\n");
+            
+            return 1;
+        }
+    }
+    else
+    {
+        gs_out = stdout;
+    }
+    
+    /* run the bench */
+    gs_entries = 0;
+    fprintf(gs_out, "{\n  \"bench\": \"bus\",\n  \"entries\": [");
+    res = a_bench_api(addr_pin, HDC2080_BOOL_FALSE);
+    if (res == 0)
+    {
+        res = a_bench_api(addr_pin, HDC2080_BOOL_TRUE);
+    }
+    if (res == 0)
+    {
+        res = a_bench_example(addr_pin);
+    }
+    fprintf(gs_out, "\n  ]\n}\n");
+    
+    /* close the output */
+    if (path != NULL)
+    {
+        (void)fclose(gs_out);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    uint8_t res;
+    
+    res = a_bus_bench(argc, argv);
+    if (res == 1)
+    {
+        hdc2080_interface_debug_print("hdc2080: run failed.\n");
+    }
+    else if (res == 5)
+    {
+        hdc2080_interface_debug_print("hdc2080: param is invalid.\n");
+    }
+    else
+    {
+        
+    }
+    
+    return (res == 0) ? 0 : 1;
+}
@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_bench.c
+ * @brief     iic bench source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_interface.h"
+#include "acquire.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief iic bench op structure definition
+ */
+typedef struct bench_op_s
+{
+    const char *name;         /**< op name */
+    uint32_t calls;           /**< calls */
+    uint32_t errors;          /**< failed calls */
+    uint64_t sum_ns;          /**< total time */
+    uint64_t min_ns;          /**< min time */
+    uint64_t max_ns;          /**< max time */
+} bench_op_t;
+
+static hdc2080_handle_t gs_handle[2];               /**< hdc2080 handles */
+static hdc2080_interface_bus_t gs_bus[2] =          /**< one bus context per handle */
+{
+    {"/dev/i2c-1", -1},
+    {"/dev/i2c-1", -1},
+};
+static acquire_t gs_acquire[2];                     /**< acquisition threads */
+
+/**
+ * @brief     get the monotonic time
+ * @return    time in ns
+ * @note      none
+ */
+static uint64_t a_bench_now_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     account one op
+ * @param[in] *op pointer to an op
+ * @param[in] start start time
+ * @param[in] res op result
+ * @note      none
+ */
+static void a_bench_account(bench_op_t *op, uint64_t start, uint8_t res)
+{
+    uint64_t ns = a_bench_now_ns() - start;
+    
+    op->calls++;
+    op->errors += (res != 0) ? 1 : 0;
+    op->sum_ns += ns;
+    op->min_ns = ((op->calls == 1) || (ns < op->min_ns)) ? ns : op->min_ns;
+    op->max_ns = (ns > op->max_ns) ? ns : op->max_ns;
+}
+
+/**
+ * @brief     init a handle on the board transport
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] *bus pointer to a bus context
+ * @param[in] addr_pin address pin
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_bench_init(hdc2080_handle_t *handle, hdc2080_interface_bus_t *bus, hdc2080_address_t addr_pin)
+{
+    /* link interface function, every handle opens its own fd */
+    DRIVER_HDC2080_LINK_INIT(handle, hdc2080_handle_t);
+    DRIVER_HDC2080_LINK_CONTEXT(handle, bus);
+    DRIVER_HDC2080_LINK_IIC_INIT_CTX(handle, hdc2080_interface_iic_init_ctx);
+    DRIVER_HDC2080_LINK_IIC_DEINIT_CTX(handle, hdc2080_interface_iic_deinit_ctx);
+    DRIVER_HDC2080_LINK_IIC_READ_CTX(handle, hdc2080_interface_iic_read_ctx);
+    DRIVER_HDC2080_LINK_IIC_WRITE_CTX(handle, hdc2080_interface_iic_write_ctx);
+    DRIVER_HDC2080_LINK_IIC_READ_BATCH(handle, hdc2080_interface_iic_read_batch);
+    DRIVER_HDC2080_LINK_DELAY_MS(handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_LOCK(handle, hdc2080_interface_lock);
+    DRIVER_HDC2080_LINK_UNLOCK(handle, hdc2080_interface_unlock);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(handle, hdc2080_interface_debug_print);
+    
+    /* init */
+    if ((hdc2080_set_addr_pin(handle, addr_pin) != 0) || (hdc2080_init(handle) != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the acquisition threads on the board transport
+ * @param[in] times periods of every phase
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      both sensors run, then the second runs on after the first stopped,
+ *            an absent sensor fails its probe and must not disturb the other one
+ */
+static uint8_t a_bench_acquire(uint32_t times)
+{
+    uint8_t started[2];
+    uint8_t res;
+    uint32_t i;
+    
+    /* start one thread per sensor found */
+    for (i = 0; i < 2; i++)
+    {
+        started[i] = (acquire_start(&gs_acquire[i], (i == 0) ? HDC2080_ADDRESS_0 : HDC2080_ADDRESS_1,
+                                    NULL, 10000) == 0) ? 1 : 0;
+    }
+    if ((started[0] == 0) && (started[1] == 0))
+    {
+        hdc2080_interface_debug_print("iic bench: no sensor found.\n");
+        
+        return 1;
+    }
+    
+    /* both run, then the second one alone */
+    hdc2080_interface_delay_ms(times * 10);
+    if (started[0] != 0)
+    {
+        (void)acquire_stop(&gs_acquire[0]);
+    }
+    hdc2080_interface_delay_ms(times * 10);
+    if (started[1] != 0)
+    {
+        (void)acquire_stop(&gs_acquire[1]);
+    }
+    
+    /* output */
+    res = 0;
+    for (i = 0; i < 2; i++)
+    {
+        if (started[i] == 0)
+        {
+            hdc2080_interface_debug_print("iic bench: acquire %d not found.\n", i);
+            
+            continue;
+        }
+        hdc2080_interface_debug_print("iic bench: acquire %d samples %d, errors %d.\n", i,
+                                      gs_acquire[i].samples, gs_acquire[i].errors);
+        res |= ((gs_acquire[i].samples == 0) || (gs_acquire[i].errors != 0)) ? 1 : 0;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 5 param is invalid
+ * @note      none
+ */
+int main(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "h";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"times", required_argument, NULL, 1},
+        {"acquire", no_argument, NULL, 2},
+        {NULL, 0, NULL, 0},
+    };
+    bench_op_t op[4] =
+    {
+        {"get_reg", 0, 0, 0, 0, 0},
+        {"set_reg", 0, 0, 0, 0, 0},
+        {"read_snapshot", 0, 0, 0, 0, 0},
+        {"read_all", 0, 0, 0, 0, 0},
+    };
+    hdc2080_handle_t *table[2] = {&gs_handle[0], &gs_handle[1]};
+    hdc2080_snapshot_t snapshot[2];
+    uint32_t times = 1000;
+    uint8_t acquire = 0;
+    uint32_t i;
+    uint64_t start;
+    uint8_t reg;
+    uint8_t res;
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                hdc2080_interface_debug_print("Usage:\n");
+                hdc2080_interface_debug_print("  hdc2080_iic_bench [--times=<num>]\n");
+                hdc2080_interface_debug_print("  hdc2080_iic_bench --acquire [--times=<num>]\n");
+                hdc2080_interface_debug_print("\n");
+                hdc2080_interface_debug_print("Options:\n");
+                hdc2080_interface_debug_print("  -h, --help                     Show the help.\n");
+                hdc2080_interface_debug_print("      --acquire                  Run the acquisition threads of both sensors.\n");
+                hdc2080_interface_debug_print("      --times=<num>              Set the calls of every op or the 10ms periods of every acquire phase.([default: 1000])\n");
+                
+                return 0;
+            }
+            
+            /* times */
+            case 1 :
+            {
+                times = (uint32_t)atol(optarg);
+                if (times == 0)
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* acquire */
+            case 2 :
+            {
+                acquire = 1;
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+    
+    /* run the acquisition threads */
+    if (acquire != 0)
+    {
+        return a_bench_acquire(times);
+    }
+    
+    /* init both sensors */
+    if (a_bench_init(&gs_handle[0], &gs_bus[0], HDC2080_ADDRESS_0) != 0)
+    {
+        return 1;
+    }
+    if (a_bench_init(&gs_handle[1], &gs_bus[1], HDC2080_ADDRESS_1) != 0)
+    {
+        (void)hdc2080_deinit(&gs_handle[0]);
+        
+        return 1;
+    }
+    
+    /* every op goes through the I2C_RDWR transport of iic.c */
+    for (i = 0; i < times; i++)
+    {
+        start = a_bench_now_ns();
+        res = hdc2080_get_reg(&gs_handle[0], 0x0E, &reg, 1);
+        a_bench_account(&op[0], start, res);
+        start = a_bench_now_ns();
+        res = hdc2080_set_reg(&gs_handle[0], 0x0E, &reg, 1);
+        a_bench_account(&op[1], start, res);
+        start = a_bench_now_ns();
+        res = hdc2080_read_snapshot(&gs_handle[0], &snapshot[0]);
+        a_bench_account(&op[2], start, res);
+        start = a_bench_now_ns();
+        res = hdc2080_read_all(table, 2, snapshot);
+        a_bench_account(&op[3], start, res);
+    }
+    
+    /* output */
+    res = 0;
+    for (i = 0; i < 4; i++)
+    {
+        hdc2080_interface_debug_print("iic bench: %s calls %d, errors %d, min %0.1fus, avg %0.1fus, max %0.1fus.\n",
+                                      op[i].name, op[i].calls, op[i].errors, (float)op[i].min_ns / 1000.0f,
+                                      (float)((double)op[i].sum_ns / (double)op[i].calls) / 1000.0f,
+                                      (float)op[i].max_ns / 1000.0f);
+        res |= (op[i].errors != 0) ? 1 : 0;
+    }
+    
+    /* deinit */
+    (void)hdc2080_deinit(&gs_handle[1]);
+    (void)hdc2080_deinit(&gs_handle[0]);
+    
+    return res;
+}
@@ -0,0 +1,409 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      jitter_bench.c
+ * @brief     jitter bench source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_interface.h"
+#include "gpio.h"
+#include "rt.h"
+#include <getopt.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief jitter bench definition
+ */
+#define BENCH_MAX_TIMES        100000        /**< max samples of one phase */
+
+/**
+ * @brief jitter bench phase structure definition
+ */
+typedef struct bench_phase_s
+{
+    const char *name;              /**< phase name */
+    const rt_config_t *rt;         /**< real time config or NULL */
+    uint32_t times;                /**< samples to take */
+    uint32_t *latency_ns;          /**< edge to data latency */
+    uint32_t num;                  /**< latency number */
+    uint32_t timeouts;             /**< missing edges */
+    uint32_t errors;               /**< failed bus calls */
+    uint8_t rt_res;                /**< rt_apply result */
+} bench_phase_t;
+
+static hdc2080_handle_t gs_handle;        /**< hdc2080 handle */
+
+/**
+ * @brief     compare two latencies
+ * @param[in] *a pointer to a latency
+ * @param[in] *b pointer to a latency
+ * @return    order
+ * @note      none
+ */
+static int a_bench_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     phase thread
+ * @param[in] *arg pointer to a bench phase structure
+ * @return    NULL
+ * @note      every sample triggers a conversion, sleeps until the DRDY edge and reads the data
+ */
+static void *a_bench_thread(void *arg)
+{
+    bench_phase_t *phase = (bench_phase_t *)arg;
+    hdc2080_snapshot_t snapshot;
+    struct timespec now;
+    uint64_t edge_ns;
+    uint64_t now_ns;
+    uint32_t i;
+    uint8_t res;
+    
+    /* enter the real time mode */
+    phase->rt_res = 0;
+    if (phase->rt != NULL)
+    {
+        phase->rt_res = rt_apply(phase->rt);
+    }
+    
+    for (i = 0; i < phase->times; i++)
+    {
+        /* trigger and sleep until the data is ready */
+        if (hdc2080_trigger_measurement(&gs_handle) != 0)
+        {
+            phase->errors++;
+            
+            continue;
+        }
+        res = gpio_interrupt_wait(1000, &edge_ns);
+        if (res != 0)
+        {
+            phase->timeouts++;
+            (void)hdc2080_read_snapshot(&gs_handle, &snapshot);
+            
+            continue;
+        }
+        
+        /* read the data, the status read releases the pin for the next edge */
+        if (hdc2080_read_snapshot(&gs_handle, &snapshot) != 0)
+        {
+            phase->errors++;
+            
+            continue;
+        }
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        now_ns = (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+        phase->latency_ns[phase->num++] = (now_ns > edge_ns) ? (uint32_t)(now_ns - edge_ns) : 0;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     run one phase in its own thread
+ * @param[in] *phase pointer to a bench phase structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_bench_run(bench_phase_t *phase)
+{
+    pthread_t thread;
+    uint32_t p[5] = {500, 900, 990, 999, 1000};
+    uint32_t i;
+    
+    /* run */
+    phase->num = 0;
+    phase->timeouts = 0;
+    phase->errors = 0;
+    if (pthread_create(&thread, NULL, a_bench_thread, phase) != 0)
+    {
+        perror("jitter bench: create thread failed.\n");
+        
+        return 1;
+    }
+    if (pthread_join(thread, NULL) != 0)
+    {
+        perror("jitter bench: join thread failed.\n");
+        
+        return 1;
+    }
+    
+    /* print the percentiles */
+    hdc2080_interface_debug_print("jitter bench: %s, %d samples, %d timeouts, %d errors%s.\n", phase->name, phase->num,
+                                  phase->timeouts, phase->errors, (phase->rt_res != 0) ? ", real time mode is partial" : "");
+    if (phase->num == 0)
+    {
+        return 1;
+    }
+    qsort(phase->latency_ns, phase->num, sizeof(uint32_t), a_bench_compare);
+    hdc2080_interface_debug_print("jitter bench: %s edge to data min %0.1fus", phase->name, (float)phase->latency_ns[0] / 1000.0f);
+    for (i = 0; i < 5; i++)
+    {
+        if (p[i] == 1000)
+        {
+            hdc2080_interface_debug_print(" max %0.1fus", (float)phase->latency_ns[phase->num - 1] / 1000.0f);
+        }
+        else
+        {
+            hdc2080_interface_debug_print(" p%g %0.1fus", (double)p[i] / 10.0,
+                                          (float)phase->latency_ns[(uint64_t)(phase->num - 1) * p[i] / 1000] / 1000.0f);
+        }
+    }
+    hdc2080_interface_debug_print(".\n");
+    
+    return 0;
+}
+
+/**
+ * @brief     bench init
+ * @param[in] addr_pin address pin
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      one shot conversions with the DRDY flag on an active low latched pin
+ */
+static uint8_t a_bench_init(hdc2080_address_t addr_pin)
+{
+    hdc2080_handle_t *handle = &gs_handle;
+    uint8_t status;
+    
+    /* link interface function */
+    DRIVER_HDC2080_LINK_INIT(handle, hdc2080_handle_t);
+    DRIVER_HDC2080_LINK_IIC_INIT(handle, hdc2080_interface_iic_init);
+    DRIVER_HDC2080_LINK_IIC_DEINIT(handle, hdc2080_interface_iic_deinit);
+    DRIVER_HDC2080_LINK_IIC_READ(handle, hdc2080_interface_iic_read);
+    DRIVER_HDC2080_LINK_IIC_WRITE(handle, hdc2080_interface_iic_write);
+    DRIVER_HDC2080_LINK_DELAY_MS(handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(handle, hdc2080_interface_debug_print);
+    
+    /* init */
+    if ((hdc2080_set_addr_pin(handle, addr_pin) != 0) || (hdc2080_init(handle) != 0))
+    {
+        return 1;
+    }
+    if ((hdc2080_set_temperature_resolution(handle, HDC2080_RESOLUTION_14_BIT) != 0) ||
+        (hdc2080_set_humidity_resolution(handle, HDC2080_RESOLUTION_14_BIT) != 0) ||
+        (hdc2080_set_mode(handle, HDC2080_MODE_HUMIDITY_TEMPERATURE) != 0) ||
+        (hdc2080_set_auto_measurement_mode(handle, HDC2080_AUTO_MEASUREMENT_MODE_DISABLED) != 0) ||
+        (hdc2080_set_interrupt(handle, HDC2080_INTERRUPT_DRDY, HDC2080_BOOL_TRUE) != 0) ||
+        (hdc2080_set_interrupt_polarity(handle, HDC2080_INTERRUPT_POLARITY_LOW) != 0) ||
+        (hdc2080_set_interrupt_mode(handle, HDC2080_INTERRUPT_MODE_LEVEL) != 0) ||
+        (hdc2080_set_interrupt_pin(handle, HDC2080_BOOL_TRUE) != 0))
+    {
+        (void)hdc2080_deinit(handle);
+        
+        return 1;
+    }
+    
+    /* wait on the falling edges and release a stale flag */
+    if (gpio_interrupt_init(GPIO_EDGE_FALLING) != 0)
+    {
+        (void)hdc2080_deinit(handle);
+        
+        return 1;
+    }
+    (void)hdc2080_get_interrupt_status(handle, &status);
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 5 param is invalid
+ * @note      none
+ */
+int main(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "h";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"addr", required_argument, NULL, 1},
+        {"times", required_argument, NULL, 2},
+        {"rt-cpu", required_argument, NULL, 3},
+        {"rt-priority", required_argument, NULL, 4},
+        {NULL, 0, NULL, 0},
+    };
+    hdc2080_address_t addr_pin = HDC2080_ADDRESS_0;
+    uint32_t times = 1000;
+    rt_config_t rt = {0, 80, 1};
+    bench_phase_t phase;
+    uint8_t res;
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                hdc2080_interface_debug_print("Usage:\n");
+                hdc2080_interface_debug_print("  hdc2080_jitter_bench [--addr=<0 | 1>] [--times=<num>] [--rt-cpu=<cpu>] [--rt-priority=<1 - 99>]\n");
+                hdc2080_interface_debug_print("\n");
+                hdc2080_interface_debug_print("Options:\n");
+                hdc2080_interface_debug_print("      --addr=<0 | 1>             Set the iic address.([default: 0])\n");
+                hdc2080_interface_debug_print("  -h, --help                     Show the help.\n");
+                hdc2080_interface_debug_print("      --rt-cpu=<cpu>             Set the cpu of the real time phase.([default: 0])\n");
+                hdc2080_interface_debug_print("      --rt-priority=<1 - 99>     Set the SCHED_FIFO priority of the real time phase.([default: 80])\n");
+                hdc2080_interface_debug_print("      --times=<num>              Set the samples of every phase.([default: 1000])\n");
+                
+                return 0;
+            }
+            
+            /* address */
+            case 1 :
+            {
+                if (strcmp("0", optarg) == 0)
+                {
+                    addr_pin = HDC2080_ADDRESS_0;
+                }
+                else if (strcmp("1", optarg) == 0)
+                {
+                    addr_pin = HDC2080_ADDRESS_1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* times */
+            case 2 :
+            {
+                times = (uint32_t)atol(optarg);
+                if ((times == 0) || (times > BENCH_MAX_TIMES))
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* rt cpu */
+            case 3 :
+            {
+                rt.cpu = (int32_t)atol(optarg);
+                if (rt.cpu < 0)
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* rt priority */
+            case 4 :
+            {
+                rt.priority = (int32_t)atol(optarg);
+                if ((rt.priority < 1) || (rt.priority > 99))
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+    
+    /* init */
+    phase.latency_ns = (uint32_t *)malloc(sizeof(uint32_t) * times);
+    if (phase.latency_ns == NULL)
+    {
+        return 1;
+    }
+    if (a_bench_init(addr_pin) != 0)
+    {
+        free(phase.latency_ns);
+        
+        return 1;
+    }
+    
+    /* the normal phase runs first, the memory lock of the real time phase stays */
+    phase.name = "normal";
+    phase.rt = NULL;
+    phase.times = times;
+    res = a_bench_run(&phase);
+    if (res == 0)
+    {
+        phase.name = "rt";
+        phase.rt = &rt;
+        res = a_bench_run(&phase);
+    }
+    
+    /* deinit */
+    (void)gpio_interrupt_deinit();
+    (void)hdc2080_deinit(&gs_handle);
+    free(phase.latency_ns);
+    
+    return res;
+}
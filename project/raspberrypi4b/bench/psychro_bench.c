@@ -0,0 +1,439 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      psychro_bench.c
+ * @brief     psychro bench source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_psychro.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief psychro bench definition
+ */
+#define BENCH_T_NUM          3301        /**< -40C - 125C in 0.05C */
+#define BENCH_RH_NUM         201         /**< 0% - 100% in 0.5% */
+#define BENCH_NUM            (BENCH_T_NUM * BENCH_RH_NUM)        /**< grid size */
+#define BENCH_MAX_TIMES      1000        /**< max rounds */
+
+/**
+ * @brief psychro bench error structure definition
+ */
+typedef struct bench_error_s
+{
+    double dew_point;                /**< max dew point error in degrees */
+    double vapour_pressure;          /**< max vapour pressure error in hPa */
+    double vapour_pressure_rel;      /**< max relative vapour pressure error above 1hPa */
+    double absolute_humidity;        /**< max absolute humidity error in g/m3 */
+    double absolute_humidity_rel;    /**< max relative absolute humidity error above 1g/m3 */
+    double heat_index;               /**< max heat index error in degrees */
+} bench_error_t;
+
+/**
+ * @brief psychro bench array structure definition
+ */
+typedef struct bench_array_s
+{
+    float *t;                        /**< temperature */
+    float *rh;                       /**< humidity */
+    int16_t *t_centi;                /**< temperature in 0.01 degrees */
+    uint16_t *rh_centi;              /**< humidity in 0.01 percent */
+    float *dew_point;                /**< dew point */
+    float *vapour_pressure;          /**< vapour pressure */
+    float *absolute_humidity;        /**< absolute humidity */
+    float *heat_index;               /**< heat index */
+    hdc2080_psychro_t *psychro;      /**< single sample results */
+    hdc2080_psychro_centi_t *centi;  /**< fixed point results */
+} bench_array_t;
+
+/**
+ * @brief     get the monotonic time
+ * @return    time in ns
+ * @note      none
+ */
+static uint64_t a_bench_now_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief      exact formulas with libm in double
+ * @param[in]  t temperature in degrees
+ * @param[in]  rh humidity in percent
+ * @param[out] *out pointer to an output buffer
+ * @note       the inputs are clamped like the driver, the result is the accuracy reference,
+ *             the heat index jumps where the NWS switches the formula at an 80F average,
+ *             so within 0.01F of the switch out[4] holds the other formula, else it equals out[3]
+ */
+static void a_bench_exact(double t, double rh, double out[5])
+{
+    double x;
+    double e;
+    double f;
+    double simple;
+    double full;
+    
+    t = (t < -40.0) ? -40.0 : ((t > 125.0) ? 125.0 : t);
+    rh = (rh < 0.01) ? 0.01 : ((rh > 100.0) ? 100.0 : rh);
+    x = 17.62 * t / (243.12 + t);
+    out[0] = 243.12 * (log(rh / 100.0) + x) / (17.62 - (log(rh / 100.0) + x));
+    e = rh / 100.0 * 6.112 * exp(x);
+    out[1] = e;
+    out[2] = 216.7 * e / (273.15 + t);
+    f = t * 1.8 + 32.0;
+    simple = 0.5 * (f + 61.0 + (f - 68.0) * 1.2 + rh * 0.094);
+    full = -42.379 + 2.04901523 * f + 10.14333127 * rh - 0.22475541 * f * rh - 0.00683783 * f * f -
+           0.05481717 * rh * rh + 0.00122874 * f * f * rh + 0.00085282 * f * rh * rh - 0.00000199 * f * f * rh * rh;
+    if ((rh < 13.0) && (f >= 80.0) && (f <= 112.0))
+    {
+        full -= ((13.0 - rh) / 4.0) * sqrt((17.0 - fabs(f - 95.0)) / 17.0);
+    }
+    if ((rh > 85.0) && (f >= 80.0) && (f <= 87.0))
+    {
+        full += ((rh - 85.0) / 10.0) * ((87.0 - f) / 5.0);
+    }
+    out[3] = ((((simple + f) / 2.0) >= 80.0) ? (full - 32.0) : (simple - 32.0)) / 1.8;
+    out[4] = (fabs((simple + f) / 2.0 - 80.0) < 0.01) ? ((((simple + f) / 2.0) >= 80.0) ? (simple - 32.0) : (full - 32.0)) / 1.8 : out[3];
+}
+
+/**
+ * @brief      the formulas as a consumer writes them with float libm calls
+ * @param[in]  t temperature in degrees
+ * @param[in]  rh humidity in percent
+ * @param[out] *psychro pointer to an output buffer
+ * @note       this is the timing baseline
+ */
+static void a_bench_libm(float t, float rh, hdc2080_psychro_t *psychro)
+{
+    float x;
+    float gamma;
+    float e;
+    float f;
+    float simple;
+    float full;
+    
+    t = (t < -40.0f) ? -40.0f : ((t > 125.0f) ? 125.0f : t);
+    rh = (rh < 0.01f) ? 0.01f : ((rh > 100.0f) ? 100.0f : rh);
+    x = 17.62f * t / (243.12f + t);
+    gamma = logf(rh / 100.0f) + x;
+    psychro->dew_point = 243.12f * gamma / (17.62f - gamma);
+    e = rh / 100.0f * 6.112f * expf(x);
+    psychro->vapour_pressure = e;
+    psychro->absolute_humidity = 216.7f * e / (273.15f + t);
+    f = t * 1.8f + 32.0f;
+    simple = 0.5f * (f + 61.0f + (f - 68.0f) * 1.2f + rh * 0.094f);
+    full = -42.379f + 2.04901523f * f + 10.14333127f * rh - 0.22475541f * f * rh - 0.00683783f * f * f -
+           0.05481717f * rh * rh + 0.00122874f * f * f * rh + 0.00085282f * f * rh * rh - 0.00000199f * f * f * rh * rh;
+    if ((rh < 13.0f) && (f >= 80.0f) && (f <= 112.0f))
+    {
+        full -= ((13.0f - rh) / 4.0f) * sqrtf((17.0f - fabsf(f - 95.0f)) / 17.0f);
+    }
+    if ((rh > 85.0f) && (f >= 80.0f) && (f <= 87.0f))
+    {
+        full += ((rh - 85.0f) / 10.0f) * ((87.0f - f) / 5.0f);
+    }
+    f = (((simple + f) / 2.0f) >= 80.0f) ? full : simple;
+    psychro->heat_index = (f - 32.0f) / 1.8f;
+}
+
+/**
+ * @brief         update the max errors of a sample
+ * @param[in,out] *error pointer to an error structure
+ * @param[in]     *ref pointer to the reference
+ * @param[in]     dew_point dew point
+ * @param[in]     vapour_pressure vapour pressure
+ * @param[in]     absolute_humidity absolute humidity
+ * @param[in]     heat_index heat index
+ * @note          the relative errors skip the values below 1 where the 0.01 steps of the fixed point dominate
+ */
+static void a_bench_error(bench_error_t *error, const double ref[5], double dew_point, double vapour_pressure,
+                          double absolute_humidity, double heat_index)
+{
+    double d;
+    double d2;
+    
+    d = fabs(dew_point - ref[0]);
+    error->dew_point = (d > error->dew_point) ? d : error->dew_point;
+    d = fabs(vapour_pressure - ref[1]);
+    error->vapour_pressure = (d > error->vapour_pressure) ? d : error->vapour_pressure;
+    d = (ref[1] >= 1.0) ? (d / ref[1]) : 0.0;
+    error->vapour_pressure_rel = (d > error->vapour_pressure_rel) ? d : error->vapour_pressure_rel;
+    d = fabs(absolute_humidity - ref[2]);
+    error->absolute_humidity = (d > error->absolute_humidity) ? d : error->absolute_humidity;
+    d = (ref[2] >= 1.0) ? (d / ref[2]) : 0.0;
+    error->absolute_humidity_rel = (d > error->absolute_humidity_rel) ? d : error->absolute_humidity_rel;
+    d = fabs(heat_index - ref[3]);
+    d2 = fabs(heat_index - ref[4]);
+    d = (d2 < d) ? d2 : d;
+    error->heat_index = (d > error->heat_index) ? d : error->heat_index;
+}
+
+/**
+ * @brief     print and check the max errors
+ * @param[in] *name pointer to a variant name
+ * @param[in] *error pointer to an error structure
+ * @param[in] *limit pointer to the error limits
+ * @return    1 if a limit is exceeded, else 0
+ * @note      none
+ */
+static uint8_t a_bench_check(const char *name, const bench_error_t *error, const bench_error_t *limit)
+{
+    uint8_t res;
+    
+    res = ((error->dew_point > limit->dew_point) ||
+           (error->vapour_pressure > limit->vapour_pressure) || (error->vapour_pressure_rel > limit->vapour_pressure_rel) ||
+           (error->absolute_humidity > limit->absolute_humidity) || (error->absolute_humidity_rel > limit->absolute_humidity_rel) ||
+           (error->heat_index > limit->heat_index)) ? 1 : 0;
+    printf("psychro bench: %s max error dew point %0.4fC, vapour pressure %0.4fhPa (%0.2e), "
+           "absolute humidity %0.4fg/m3 (%0.2e), heat index %0.4fC %s.\n",
+           name, error->dew_point, error->vapour_pressure, error->vapour_pressure_rel,
+           error->absolute_humidity, error->absolute_humidity_rel, error->heat_index,
+           (res == 0) ? "ok" : "over the limit");
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+int main(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "h";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"times", required_argument, NULL, 1},
+        {NULL, 0, NULL, 0},
+    };
+    const bench_error_t limit_float = {0.005, 0.01, 2e-6, 0.01, 2e-6, 0.005};
+    const bench_error_t limit_centi = {0.01, 0.01, 5e-3, 0.01, 5e-3, 0.02};
+    uint32_t times = 10;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint64_t start;
+    uint64_t ns[5];
+    double ref[5];
+    bench_error_t error;
+    bench_array_t a;
+    uint8_t res;
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                printf("Usage:\n");
+                printf("  hdc2080_psychro_bench [--times=<num>]\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -h, --help                     Show the help.\n");
+                printf("      --times=<num>              Set the timed rounds over the grid.([default: 10])\n");
+                
+                return 0;
+            }
+            
+            /* times */
+            case 1 :
+            {
+                times = (uint32_t)atol(optarg);
+                if ((times == 0) || (times > BENCH_MAX_TIMES))
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+    
+    /* allocate the grid */
+    memset(&a, 0, sizeof(bench_array_t));
+    a.t = (float *)malloc(sizeof(float) * BENCH_NUM);
+    a.rh = (float *)malloc(sizeof(float) * BENCH_NUM);
+    a.t_centi = (int16_t *)malloc(sizeof(int16_t) * BENCH_NUM);
+    a.rh_centi = (uint16_t *)malloc(sizeof(uint16_t) * BENCH_NUM);
+    a.dew_point = (float *)malloc(sizeof(float) * BENCH_NUM);
+    a.vapour_pressure = (float *)malloc(sizeof(float) * BENCH_NUM);
+    a.absolute_humidity = (float *)malloc(sizeof(float) * BENCH_NUM);
+    a.heat_index = (float *)malloc(sizeof(float) * BENCH_NUM);
+    a.psychro = (hdc2080_psychro_t *)malloc(sizeof(hdc2080_psychro_t) * BENCH_NUM);
+    a.centi = (hdc2080_psychro_centi_t *)malloc(sizeof(hdc2080_psychro_centi_t) * BENCH_NUM);
+    res = 0;
+    if ((a.t == NULL) || (a.rh == NULL) || (a.t_centi == NULL) || (a.rh_centi == NULL) ||
+        (a.dew_point == NULL) || (a.vapour_pressure == NULL) || (a.absolute_humidity == NULL) ||
+        (a.heat_index == NULL) || (a.psychro == NULL) || (a.centi == NULL))
+    {
+        printf("psychro bench: malloc failed.\n");
+        res = 1;
+        
+        goto exit;
+    }
+    for (i = 0; i < BENCH_T_NUM; i++)
+    {
+        for (j = 0; j < BENCH_RH_NUM; j++)
+        {
+            k = i * BENCH_RH_NUM + j;
+            a.t_centi[k] = (int16_t)(-4000 + (int32_t)i * 5);
+            a.rh_centi[k] = (uint16_t)(j * 50);
+            a.t[k] = (float)a.t_centi[k] / 100.0f;
+            a.rh[k] = (float)a.rh_centi[k] / 100.0f;
+        }
+    }
+    
+    /* time the variants */
+    memset(ns, 0, sizeof(ns));
+    for (i = 0; i < times; i++)
+    {
+        start = a_bench_now_ns();
+        for (k = 0; k < BENCH_NUM; k++)
+        {
+            a_bench_libm(a.t[k], a.rh[k], &a.psychro[k]);
+        }
+        ns[0] += a_bench_now_ns() - start;
+        
+        start = a_bench_now_ns();
+        for (k = 0; k < BENCH_NUM; k++)
+        {
+            (void)hdc2080_psychro(a.t[k], a.rh[k], &a.psychro[k]);
+        }
+        ns[1] += a_bench_now_ns() - start;
+        
+        start = a_bench_now_ns();
+        (void)hdc2080_psychro_batch(a.t, a.rh, a.dew_point, a.vapour_pressure, a.absolute_humidity, a.heat_index, BENCH_NUM);
+        ns[2] += a_bench_now_ns() - start;
+        
+        start = a_bench_now_ns();
+        (void)hdc2080_psychro_batch(a.t, a.rh, a.dew_point, NULL, NULL, NULL, BENCH_NUM);
+        ns[3] += a_bench_now_ns() - start;
+        
+        start = a_bench_now_ns();
+        (void)hdc2080_psychro_batch_centi(a.t_centi, a.rh_centi, a.centi, BENCH_NUM);
+        ns[4] += a_bench_now_ns() - start;
+    }
+    printf("psychro bench: %d samples, %d rounds.\n", BENCH_NUM, times);
+    printf("psychro bench: libm %0.2fns/sample.\n", (double)ns[0] / times / BENCH_NUM);
+    printf("psychro bench: hdc2080_psychro %0.2fns/sample, %0.1fx.\n",
+           (double)ns[1] / times / BENCH_NUM, (double)ns[0] / (double)ns[1]);
+    printf("psychro bench: hdc2080_psychro_batch %0.2fns/sample, %0.1fx.\n",
+           (double)ns[2] / times / BENCH_NUM, (double)ns[0] / (double)ns[2]);
+    printf("psychro bench: hdc2080_psychro_batch dew point only %0.2fns/sample.\n", (double)ns[3] / times / BENCH_NUM);
+    printf("psychro bench: hdc2080_psychro_batch_centi %0.2fns/sample, %0.1fx.\n",
+           (double)ns[4] / times / BENCH_NUM, (double)ns[0] / (double)ns[4]);
+    
+    /* the batch must equal the single sample */
+    for (k = 0; k < BENCH_NUM; k++)
+    {
+        (void)hdc2080_psychro(a.t[k], a.rh[k], &a.psychro[k]);
+        if ((fabsf(a.psychro[k].dew_point - a.dew_point[k]) > 1e-4f) ||
+            (fabsf(a.psychro[k].heat_index - a.heat_index[k]) > 1e-3f) ||
+            (fabsf(a.psychro[k].vapour_pressure - a.vapour_pressure[k]) > a.vapour_pressure[k] * 1e-6f) ||
+            (fabsf(a.psychro[k].absolute_humidity - a.absolute_humidity[k]) > a.absolute_humidity[k] * 1e-6f))
+        {
+            printf("psychro bench: batch differs at %0.2fC %0.2f%%.\n", a.t[k], a.rh[k]);
+            res = 1;
+            
+            break;
+        }
+    }
+    
+    /* accuracy against the double libm reference */
+    memset(&error, 0, sizeof(bench_error_t));
+    for (k = 0; k < BENCH_NUM; k++)
+    {
+        a_bench_exact(a.t[k], a.rh[k], ref);
+        a_bench_error(&error, ref, a.dew_point[k], a.vapour_pressure[k], a.absolute_humidity[k], a.heat_index[k]);
+    }
+    res |= a_bench_check("float", &error, &limit_float);
+    memset(&error, 0, sizeof(bench_error_t));
+    for (k = 0; k < BENCH_NUM; k++)
+    {
+        a_bench_exact(a.t[k], a.rh[k], ref);
+        a_bench_error(&error, ref, a.centi[k].dew_point_centi / 100.0, a.centi[k].vapour_pressure_centi / 100.0,
+                      a.centi[k].absolute_humidity_centi / 100.0, a.centi[k].heat_index_centi / 100.0);
+    }
+    res |= a_bench_check("centi", &error, &limit_centi);
+    
+    exit:
+    free(a.t);
+    free(a.rh);
+    free(a.t_centi);
+    free(a.rh_centi);
+    free(a.dew_point);
+    free(a.vapour_pressure);
+    free(a.absolute_humidity);
+    free(a.heat_index);
+    free(a.psychro);
+    free(a.centi);
+    
+    return res;
+}
@@ -0,0 +1,959 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc2080d.c
+ * @brief     hdc2080d source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_interface.h"
+#include "acquire.h"
+#include "hdc2080d.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief daemon definition
+ */
+#define DAEMON_RING_SLOT         16        /**< ring slots of every sensor */
+#define DAEMON_MAX_CLIENT        16        /**< concurrent clients */
+#define DAEMON_CLIENT_BUF        64        /**< request buffer of a client */
+#define DAEMON_RESPONSE_BUF      256       /**< response buffer */
+
+/**
+ * @brief daemon sensor structure definition
+ */
+typedef struct daemon_sensor_s
+{
+    acquire_t acquire;                                     /**< acquisition thread */
+    hdc2080_ring_t ring;                                   /**< sample ring */
+    hdc2080_ring_sample_t slot[DAEMON_RING_SLOT];          /**< ring slots */
+    hdc2080_ring_sample_t latest;                          /**< cached latest sample */
+    uint8_t started;                                       /**< started flag */
+    uint8_t valid;                                         /**< latest is valid */
+} daemon_sensor_t;
+
+/**
+ * @brief daemon client structure definition
+ */
+typedef struct daemon_client_s
+{
+    int fd;                                 /**< client socket or -1 */
+    uint32_t len;                           /**< buffered bytes */
+    uint8_t buf[DAEMON_CLIENT_BUF];         /**< request buffer */
+} daemon_client_t;
+
+static daemon_sensor_t gs_sensor[HDC2080D_MAX_SENSOR];        /**< sensors */
+static daemon_client_t gs_client[DAEMON_MAX_CLIENT];          /**< clients */
+static uint32_t gs_queries;                                   /**< answered queries */
+static volatile sig_atomic_t gs_running;                      /**< running flag */
+
+/**
+ * @brief     signal handler
+ * @param[in] signum signal number
+ * @note      none
+ */
+static void a_daemon_signal(int signum)
+{
+    (void)signum;
+    gs_running = 0;
+}
+
+/**
+ * @brief daemon refresh the cache from the rings
+ * @note  none
+ */
+static void a_daemon_refresh(void)
+{
+    uint32_t i;
+    uint32_t num;
+    hdc2080_ring_sample_t batch[DAEMON_RING_SLOT];
+    
+    /* keep the last sample of every ring */
+    for (i = 0; i < HDC2080D_MAX_SENSOR; i++)
+    {
+        if (gs_sensor[i].started == 0)
+        {
+            continue;
+        }
+        if ((hdc2080_ring_pop(&gs_sensor[i].ring, batch, DAEMON_RING_SLOT, &num) == 0) && (num != 0))
+        {
+            gs_sensor[i].latest = batch[num - 1];
+            gs_sensor[i].valid = 1;
+        }
+    }
+}
+
+/**
+ * @brief     daemon send a whole buffer
+ * @param[in] fd client socket
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 send failed
+ * @note      a client that stops reading for 100ms is dropped
+ */
+static uint8_t a_daemon_send(int fd, const uint8_t *buf, size_t len)
+{
+    ssize_t n;
+    struct pollfd pfd;
+    
+    while (len > 0)
+    {
+        n = send(fd, buf, len, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n > 0)
+        {
+            buf += n;
+            len -= (size_t)n;
+        }
+        else if ((n < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+        {
+            /* wait until the socket drains */
+            pfd.fd = fd;
+            pfd.events = POLLOUT;
+            if (poll(&pfd, 1, 100) <= 0)
+            {
+                return 1;
+            }
+        }
+        else if ((n < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     daemon answer a binary request
+ * @param[in] fd client socket
+ * @param[in] *request pointer to a request
+ * @return    status code
+ *            - 0 success
+ *            - 1 answer failed
+ * @note      none
+ */
+static uint8_t a_daemon_answer_binary(int fd, const hdc2080d_request_t *request)
+{
+    uint8_t buf[DAEMON_RESPONSE_BUF];
+    hdc2080d_response_t response;
+    hdc2080d_record_t record;
+    hdc2080d_stats_t stats;
+    size_t len;
+    uint32_t i;
+    uint32_t dropped;
+    
+    /* check the index */
+    response.magic = HDC2080D_MAGIC;
+    response.status = HDC2080D_STATUS_OK;
+    response.num = 0;
+    len = sizeof(hdc2080d_response_t);
+    if ((request->index != HDC2080D_INDEX_ALL) &&
+        ((request->index >= HDC2080D_MAX_SENSOR) || (gs_sensor[request->index].started == 0)))
+    {
+        response.status = HDC2080D_STATUS_INVALID;
+    }
+    else if (request->cmd == HDC2080D_CMD_READ)
+    {
+        for (i = 0; i < HDC2080D_MAX_SENSOR; i++)
+        {
+            if (((request->index != HDC2080D_INDEX_ALL) && (request->index != i)) || (gs_sensor[i].valid == 0))
+            {
+                continue;
+            }
+            record.index = (uint8_t)i;
+            record.status = gs_sensor[i].latest.status;
+            record.sequence = gs_sensor[i].latest.sequence;
+            record.timestamp_us = gs_sensor[i].latest.timestamp_us;
+            record.temperature_centi = gs_sensor[i].latest.temperature_centi;
+            record.humidity_centi = gs_sensor[i].latest.humidity_centi;
+            memcpy(&buf[len], &record, sizeof(hdc2080d_record_t));
+            len += sizeof(hdc2080d_record_t);
+            response.num++;
+        }
+        if (response.num == 0)
+        {
+            response.status = HDC2080D_STATUS_EMPTY;
+        }
+    }
+    else if (request->cmd == HDC2080D_CMD_STATS)
+    {
+        for (i = 0; i < HDC2080D_MAX_SENSOR; i++)
+        {
+            if (((request->index != HDC2080D_INDEX_ALL) && (request->index != i)) || (gs_sensor[i].started == 0))
+            {
+                continue;
+            }
+            (void)hdc2080_ring_get_dropped(&gs_sensor[i].ring, &dropped);
+            stats.index = (uint8_t)i;
+            stats.samples = __atomic_load_n(&gs_sensor[i].acquire.samples, __ATOMIC_RELAXED);
+            stats.errors = __atomic_load_n(&gs_sensor[i].acquire.errors, __ATOMIC_RELAXED);
+            stats.dropped = dropped;
+            stats.overruns = __atomic_load_n(&gs_sensor[i].acquire.period.overruns, __ATOMIC_RELAXED);
+            stats.queries = gs_queries;
+            memcpy(&buf[len], &stats, sizeof(hdc2080d_stats_t));
+            len += sizeof(hdc2080d_stats_t);
+            response.num++;
+        }
+    }
+    else
+    {
+        response.status = HDC2080D_STATUS_INVALID;
+    }
+    memcpy(buf, &response, sizeof(hdc2080d_response_t));
+    
+    return a_daemon_send(fd, buf, len);
+}
+
+/**
+ * @brief     daemon format a centi value
+ * @param[out] *buf pointer to a text buffer
+ * @param[in]  len buffer length
+ * @param[in]  centi value in 0.01 units
+ * @note       none
+ */
+static void a_daemon_format_centi(char *buf, size_t len, int32_t centi)
+{
+    uint32_t value = (uint32_t)((centi < 0) ? -centi : centi);
+    
+    (void)snprintf(buf, len, "%s%u.%02u", (centi < 0) ? "-" : "", value / 100, value % 100);
+}
+
+/**
+ * @brief     daemon answer a text request
+ * @param[in] fd client socket
+ * @param[in] *line pointer to a request line
+ * @return    status code
+ *            - 0 success
+ *            - 1 answer failed
+ * @note      the commands are "read [index]" and "stats", every answer ends with "ok", "empty" or "invalid"
+ */
+static uint8_t a_daemon_answer_text(int fd, const char *line)
+{
+    char buf[DAEMON_RESPONSE_BUF];
+    char temperature[16];
+    char humidity[16];
+    size_t len;
+    uint32_t i;
+    uint32_t num;
+    uint32_t dropped;
+    uint32_t index;
+    uint8_t stats;
+    int n;
+    
+    /* parse the command and the optional index */
+    index = HDC2080D_INDEX_ALL;
+    if (strncmp(line, "read", 4) == 0)
+    {
+        stats = 0;
+        line += 4;
+    }
+    else if (strncmp(line, "stats", 5) == 0)
+    {
+        stats = 1;
+        line += 5;
+    }
+    else
+    {
+        return a_daemon_send(fd, (const uint8_t *)"invalid\n", 8);
+    }
+    if (*line == ' ')
+    {
+        index = (uint32_t)strtoul(line + 1, NULL, 10);
+        if ((index >= HDC2080D_MAX_SENSOR) || (gs_sensor[index].started == 0))
+        {
+            return a_daemon_send(fd, (const uint8_t *)"invalid\n", 8);
+        }
+    }
+    else if (*line != '\0')
+    {
+        return a_daemon_send(fd, (const uint8_t *)"invalid\n", 8);
+    }
+    else
+    {
+        
+    }
+    
+    /* one line per sensor */
+    len = 0;
+    num = 0;
+    for (i = 0; i < HDC2080D_MAX_SENSOR; i++)
+    {
+        if (((index != HDC2080D_INDEX_ALL) && (index != i)) || (gs_sensor[i].started == 0))
+        {
+            continue;
+        }
+        if (stats != 0)
+        {
+            (void)hdc2080_ring_get_dropped(&gs_sensor[i].ring, &dropped);
+            n = snprintf(&buf[len], sizeof(buf) - len, "%u samples %u errors %u dropped %u overruns %u queries %u\n", i,
+                         __atomic_load_n(&gs_sensor[i].acquire.samples, __ATOMIC_RELAXED),
+                         __atomic_load_n(&gs_sensor[i].acquire.errors, __ATOMIC_RELAXED),
+                         dropped, __atomic_load_n(&gs_sensor[i].acquire.period.overruns, __ATOMIC_RELAXED),
+                         gs_queries);
+        }
+        else if (gs_sensor[i].valid != 0)
+        {
+            a_daemon_format_centi(temperature, sizeof(temperature), gs_sensor[i].latest.temperature_centi);
+            a_daemon_format_centi(humidity, sizeof(humidity), gs_sensor[i].latest.humidity_centi);
+            n = snprintf(&buf[len], sizeof(buf) - len, "%u sequence %u timestamp %lluus temperature %sC humidity %s%%\n",
+                         i, gs_sensor[i].latest.sequence, (unsigned long long)gs_sensor[i].latest.timestamp_us,
+                         temperature, humidity);
+        }
+        else
+        {
+            continue;
+        }
+        if ((n < 0) || ((size_t)n >= sizeof(buf) - len))
+        {
+            return 1;
+        }
+        len += (size_t)n;
+        num++;
+    }
+    n = snprintf(&buf[len], sizeof(buf) - len, "%s\n", (num != 0) ? "ok" : "empty");
+    if ((n < 0) || ((size_t)n >= sizeof(buf) - len))
+    {
+        return 1;
+    }
+    len += (size_t)n;
+    
+    return a_daemon_send(fd, (const uint8_t *)buf, len);
+}
+
+/**
+ * @brief     daemon handle the buffered requests of a client
+ * @param[in] *client pointer to a client
+ * @return    status code
+ *            - 0 success
+ *            - 1 the client must be closed
+ * @note      a request starting with HDC2080D_MAGIC is binary, else it is a text line
+ */
+static uint8_t a_daemon_handle(daemon_client_t *client)
+{
+    hdc2080d_request_t request;
+    uint8_t *end;
+    uint32_t used;
+    
+    while (client->len > 0)
+    {
+        if (client->buf[0] == HDC2080D_MAGIC)
+        {
+            /* wait for the whole request */
+            if (client->len < sizeof(hdc2080d_request_t))
+            {
+                return 0;
+            }
+            memcpy(&request, client->buf, sizeof(hdc2080d_request_t));
+            used = sizeof(hdc2080d_request_t);
+            a_daemon_refresh();
+            gs_queries++;
+            if (a_daemon_answer_binary(client->fd, &request) != 0)
+            {
+                return 1;
+            }
+        }
+        else
+        {
+            /* wait for the whole line, an overlong line closes the client */
+            end = memchr(client->buf, '\n', client->len);
+            if (end == NULL)
+            {
+                return (client->len >= DAEMON_CLIENT_BUF) ? 1 : 0;
+            }
+            *end = '\0';
+            used = (uint32_t)(end - client->buf) + 1;
+            if ((end != client->buf) && (*(end - 1) == '\r'))
+            {
+                *(end - 1) = '\0';
+            }
+            a_daemon_refresh();
+            gs_queries++;
+            if (a_daemon_answer_text(client->fd, (const char *)client->buf) != 0)
+            {
+                return 1;
+            }
+        }
+        
+        /* drop the handled request */
+        client->len -= used;
+        memmove(client->buf, &client->buf[used], client->len);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     daemon serve the socket
+ * @param[in] *path pointer to a socket path
+ * @param[in] period_ms sample period
+ * @param[in] *rt pointer to a real time config or NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 serve failed
+ * @note      only the acquisition threads run in the real time mode
+ */
+static uint8_t a_daemon_serve(const char *path, uint32_t period_ms, const rt_config_t *rt)
+{
+    struct sockaddr_un addr;
+    struct pollfd pfd[DAEMON_MAX_CLIENT + 1];
+    struct sigaction sa;
+    int listen_fd;
+    int fd;
+    int n;
+    uint32_t i;
+    uint32_t num;
+    ssize_t len;
+    uint8_t res;
+    
+    /* check the path */
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        hdc2080_interface_debug_print("hdc2080d: socket path is too long.\n");
+        
+        return 1;
+    }
+    
+    /* start one acquisition thread per sensor found, the handles stay initialized */
+    num = 0;
+    for (i = 0; i < HDC2080D_MAX_SENSOR; i++)
+    {
+        gs_sensor[i].started = 0;
+        gs_sensor[i].valid = 0;
+        if (hdc2080_ring_init(&gs_sensor[i].ring, gs_sensor[i].slot, DAEMON_RING_SLOT) != 0)
+        {
+            continue;
+        }
+        if (acquire_start_rt(&gs_sensor[i].acquire, (i == 0) ? HDC2080_ADDRESS_0 : HDC2080_ADDRESS_1,
+                             &gs_sensor[i].ring, period_ms * 1000, rt) != 0)
+        {
+            (void)hdc2080_ring_deinit(&gs_sensor[i].ring);
+            
+            continue;
+        }
+        gs_sensor[i].started = 1;
+        num++;
+    }
+    if (num == 0)
+    {
+        hdc2080_interface_debug_print("hdc2080d: no sensor found.\n");
+        
+        return 1;
+    }
+    
+    /* listen on the socket, a stale socket file is replaced */
+    res = 1;
+    listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd < 0)
+    {
+        perror("hdc2080d: socket failed.\n");
+        
+        goto stop;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    (void)unlink(path);
+    if ((bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) ||
+        (listen(listen_fd, DAEMON_MAX_CLIENT) < 0))
+    {
+        perror("hdc2080d: bind failed.\n");
+        (void)close(listen_fd);
+        
+        goto stop;
+    }
+    
+    /* stop on SIGINT and SIGTERM, poll returns on the signal */
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = a_daemon_signal;
+    (void)sigemptyset(&sa.sa_mask);
+    (void)sigaction(SIGINT, &sa, NULL);
+    (void)sigaction(SIGTERM, &sa, NULL);
+    for (i = 0; i < DAEMON_MAX_CLIENT; i++)
+    {
+        gs_client[i].fd = -1;
+        gs_client[i].len = 0;
+    }
+    gs_queries = 0;
+    gs_running = 1;
+    hdc2080_interface_debug_print("hdc2080d: serving %d sensors on %s every %dms.\n", num, path, period_ms);
+    
+    while (gs_running != 0)
+    {
+        /* wait for the listener and the clients, refresh the cache at least every 500ms */
+        pfd[0].fd = listen_fd;
+        pfd[0].events = POLLIN;
+        for (i = 0; i < DAEMON_MAX_CLIENT; i++)
+        {
+            pfd[i + 1].fd = gs_client[i].fd;
+            pfd[i + 1].events = POLLIN;
+            pfd[i + 1].revents = 0;
+        }
+        n = poll(pfd, DAEMON_MAX_CLIENT + 1, 500);
+        a_daemon_refresh();
+        if (n <= 0)
+        {
+            continue;
+        }
+        
+        /* accept a new client, it is closed at once when all slots are taken */
+        if ((pfd[0].revents & POLLIN) != 0)
+        {
+            fd = accept(listen_fd, NULL, NULL);
+            if (fd >= 0)
+            {
+                (void)fcntl(fd, F_SETFD, FD_CLOEXEC);
+                (void)fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+                for (i = 0; i < DAEMON_MAX_CLIENT; i++)
+                {
+                    if (gs_client[i].fd < 0)
+                    {
+                        gs_client[i].fd = fd;
+                        gs_client[i].len = 0;
+                        
+                        break;
+                    }
+                }
+                if (i == DAEMON_MAX_CLIENT)
+                {
+                    (void)close(fd);
+                }
+            }
+        }
+        
+        /* read and answer the clients */
+        for (i = 0; i < DAEMON_MAX_CLIENT; i++)
+        {
+            if ((gs_client[i].fd < 0) || (pfd[i + 1].revents == 0))
+            {
+                continue;
+            }
+            len = recv(gs_client[i].fd, &gs_client[i].buf[gs_client[i].len], DAEMON_CLIENT_BUF - gs_client[i].len, 0);
+            if ((len < 0) && ((errno == EAGAIN) || (errno == EINTR)))
+            {
+                continue;
+            }
+            if (len > 0)
+            {
+                gs_client[i].len += (uint32_t)len;
+                if (a_daemon_handle(&gs_client[i]) == 0)
+                {
+                    continue;
+                }
+            }
+            (void)close(gs_client[i].fd);
+            gs_client[i].fd = -1;
+        }
+    }
+    
+    /* close the clients and the socket */
+    for (i = 0; i < DAEMON_MAX_CLIENT; i++)
+    {
+        if (gs_client[i].fd >= 0)
+        {
+            (void)close(gs_client[i].fd);
+        }
+    }
+    (void)close(listen_fd);
+    (void)unlink(path);
+    hdc2080_interface_debug_print("hdc2080d: answered %d queries.\n", gs_queries);
+    res = 0;
+    
+    stop:
+    for (i = 0; i < HDC2080D_MAX_SENSOR; i++)
+    {
+        if (gs_sensor[i].started != 0)
+        {
+            (void)acquire_stop(&gs_sensor[i].acquire);
+            (void)hdc2080_ring_deinit(&gs_sensor[i].ring);
+        }
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     daemon send a query and print the answer
+ * @param[in] *path pointer to a socket path
+ * @param[in] cmd query command
+ * @param[in] index sensor index
+ * @param[in] text 1 for the text protocol
+ * @return    status code
+ *            - 0 success
+ *            - 1 query failed
+ * @note      none
+ */
+static uint8_t a_daemon_query(const char *path, hdc2080d_cmd_t cmd, uint8_t index, uint8_t text)
+{
+    struct sockaddr_un addr;
+    hdc2080d_request_t request;
+    hdc2080d_response_t response;
+    hdc2080d_record_t record;
+    hdc2080d_stats_t stats;
+    uint8_t buf[DAEMON_RESPONSE_BUF + 1];
+    size_t len;
+    size_t offset;
+    ssize_t n;
+    uint32_t i;
+    int fd;
+    
+    /* connect */
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        hdc2080_interface_debug_print("hdc2080d: socket path is too long.\n");
+        
+        return 1;
+    }
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        perror("hdc2080d: socket failed.\n");
+        
+        return 1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        perror("hdc2080d: connect failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    
+    /* send one request and read the answer until the daemon closes */
+    if (text != 0)
+    {
+        if (index == HDC2080D_INDEX_ALL)
+        {
+            len = (size_t)snprintf((char *)buf, sizeof(buf), "%s\n", (cmd == HDC2080D_CMD_READ) ? "read" : "stats");
+        }
+        else
+        {
+            len = (size_t)snprintf((char *)buf, sizeof(buf), "%s %d\n", (cmd == HDC2080D_CMD_READ) ? "read" : "stats", index);
+        }
+    }
+    else
+    {
+        request.magic = HDC2080D_MAGIC;
+        request.cmd = (uint8_t)cmd;
+        request.index = index;
+        memcpy(buf, &request, sizeof(request));
+        len = sizeof(request);
+    }
+    if ((send(fd, buf, len, MSG_NOSIGNAL) != (ssize_t)len) || (shutdown(fd, SHUT_WR) < 0))
+    {
+        perror("hdc2080d: send failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    len = 0;
+    while (len < DAEMON_RESPONSE_BUF)
+    {
+        n = recv(fd, &buf[len], DAEMON_RESPONSE_BUF - len, 0);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("hdc2080d: recv failed.\n");
+            (void)close(fd);
+            
+            return 1;
+        }
+        if (n == 0)
+        {
+            break;
+        }
+        len += (size_t)n;
+    }
+    (void)close(fd);
+    
+    /* print the text answer as it is */
+    if (text != 0)
+    {
+        buf[len] = '\0';
+        hdc2080_interface_debug_print("%s", (char *)buf);
+        
+        return ((len >= 3) && (memcmp(&buf[len - 3], "ok\n", 3) == 0)) ? 0 : 1;
+    }
+    
+    /* decode the binary answer */
+    if (len < sizeof(hdc2080d_response_t))
+    {
+        hdc2080_interface_debug_print("hdc2080d: response is too short.\n");
+        
+        return 1;
+    }
+    memcpy(&response, buf, sizeof(response));
+    if ((response.magic != HDC2080D_MAGIC) || (response.status != HDC2080D_STATUS_OK))
+    {
+        hdc2080_interface_debug_print("hdc2080d: response status is %d.\n", response.status);
+        
+        return 1;
+    }
+    offset = sizeof(hdc2080d_response_t);
+    for (i = 0; i < response.num; i++)
+    {
+        if (cmd == HDC2080D_CMD_READ)
+        {
+            if (offset + sizeof(record) > len)
+            {
+                return 1;
+            }
+            memcpy(&record, &buf[offset], sizeof(record));
+            offset += sizeof(record);
+            hdc2080_interface_debug_print("hdc2080d: sensor %d sequence is %d at %lluus.\n", record.index, record.sequence,
+                                          (unsigned long long)record.timestamp_us);
+            hdc2080_interface_debug_print("hdc2080d: sensor %d temperature is %0.2fC.\n", record.index, (float)record.temperature_centi / 100.0f);
+            hdc2080_interface_debug_print("hdc2080d: sensor %d humidity is %0.2f%%.\n", record.index, (float)record.humidity_centi / 100.0f);
+        }
+        else
+        {
+            if (offset + sizeof(stats) > len)
+            {
+                return 1;
+            }
+            memcpy(&stats, &buf[offset], sizeof(stats));
+            offset += sizeof(stats);
+            hdc2080_interface_debug_print("hdc2080d: sensor %d samples %d, errors %d, dropped %d, overruns %d, queries %d.\n",
+                                          stats.index, stats.samples, stats.errors, stats.dropped, stats.overruns, stats.queries);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 5 param is invalid
+ * @note      none
+ */
+int main(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "hq:s:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"query", required_argument, NULL, 'q'},
+        {"socket", required_argument, NULL, 's'},
+        {"index", required_argument, NULL, 1},
+        {"period", required_argument, NULL, 2},
+        {"text", no_argument, NULL, 3},
+        {"rt-cpu", required_argument, NULL, 4},
+        {"rt-priority", required_argument, NULL, 5},
+        {NULL, 0, NULL, 0},
+    };
+    const char *path = HDC2080D_SOCKET_PATH;
+    uint32_t period_ms = 1000;
+    uint8_t index = HDC2080D_INDEX_ALL;
+    uint8_t query = 0;
+    uint8_t text = 0;
+    hdc2080d_cmd_t cmd = HDC2080D_CMD_READ;
+    rt_config_t rt = {-1, 0, 1};
+    uint8_t rt_enable = 0;
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                hdc2080_interface_debug_print("Usage:\n");
+                hdc2080_interface_debug_print("  hdc2080d [-s <path> | --socket=<path>] [--period=<ms>] [--rt-cpu=<cpu>] [--rt-priority=<1 - 99>]\n");
+                hdc2080_interface_debug_print("  hdc2080d (-q <read | stats> | --query=<read | stats>) [-s <path> | --socket=<path>] [--index=<0 | 1>] [--text]\n");
+                hdc2080_interface_debug_print("\n");
+                hdc2080_interface_debug_print("Options:\n");
+                hdc2080_interface_debug_print("  -h, --help                     Show the help.\n");
+                hdc2080_interface_debug_print("      --index=<0 | 1>            Query one sensor.([default: all])\n");
+                hdc2080_interface_debug_print("      --period=<ms>              Set the sample period.([default: 1000])\n");
+                hdc2080_interface_debug_print("  -q <read | stats>, --query=<read | stats>\n");
+                hdc2080_interface_debug_print("                                 Query a running daemon.\n");
+                hdc2080_interface_debug_print("      --rt-cpu=<cpu>             Pin the acquisition threads to a cpu and lock the memory.\n");
+                hdc2080_interface_debug_print("      --rt-priority=<1 - 99>     Run the acquisition threads with SCHED_FIFO and lock the memory.\n");
+                hdc2080_interface_debug_print("  -s <path>, --socket=<path>     Set the socket path.([default: %s])\n", HDC2080D_SOCKET_PATH);
+                hdc2080_interface_debug_print("      --text                     Query with the text protocol.\n");
+                
+                return 0;
+            }
+            
+            /* query */
+            case 'q' :
+            {
+                if (strcmp("read", optarg) == 0)
+                {
+                    cmd = HDC2080D_CMD_READ;
+                }
+                else if (strcmp("stats", optarg) == 0)
+                {
+                    cmd = HDC2080D_CMD_STATS;
+                }
+                else
+                {
+                    return 5;
+                }
+                query = 1;
+                
+                break;
+            }
+            
+            /* socket */
+            case 's' :
+            {
+                path = optarg;
+                
+                break;
+            }
+            
+            /* index */
+            case 1 :
+            {
+                if (strcmp("0", optarg) == 0)
+                {
+                    index = 0;
+                }
+                else if (strcmp("1", optarg) == 0)
+                {
+                    index = 1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* period */
+            case 2 :
+            {
+                period_ms = (uint32_t)atol(optarg);
+                if ((period_ms < 10) || (period_ms > 60000))
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* text */
+            case 3 :
+            {
+                text = 1;
+                
+                break;
+            }
+            
+            /* rt cpu */
+            case 4 :
+            {
+                rt.cpu = (int32_t)atol(optarg);
+                if (rt.cpu < 0)
+                {
+                    return 5;
+                }
+                rt_enable = 1;
+                
+                break;
+            }
+            
+            /* rt priority */
+            case 5 :
+            {
+                rt.priority = (int32_t)atol(optarg);
+                if ((rt.priority < 1) || (rt.priority > 99))
+                {
+                    return 5;
+                }
+                rt_enable = 1;
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+    
+    /* run as the client or as the daemon */
+    if (query != 0)
+    {
+        return a_daemon_query(path, cmd, index, text);
+    }
+    else
+    {
+        return a_daemon_serve(path, period_ms, (rt_enable != 0) ? &rt : NULL);
+    }
+}
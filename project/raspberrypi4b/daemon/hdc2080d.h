@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc2080d.h
+ * @brief     hdc2080d protocol header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef HDC2080D_H
+#define HDC2080D_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup hdc2080d hdc2080d protocol
+ * @brief    hdc2080d protocol modules
+ * @{
+ */
+
+/**
+ * @brief hdc2080d protocol definition
+ */
+#define HDC2080D_SOCKET_PATH        "/tmp/hdc2080d.sock"        /**< default socket path */
+#define HDC2080D_MAGIC              0xA5                        /**< first byte of a binary request and response */
+#define HDC2080D_INDEX_ALL          0xFF                        /**< all sensors */
+#define HDC2080D_MAX_SENSOR         2                           /**< one sensor per address */
+
+/**
+ * @brief hdc2080d command enumeration definition
+ */
+typedef enum
+{
+    HDC2080D_CMD_READ  = 0x01,        /**< latest sample */
+    HDC2080D_CMD_STATS = 0x02,        /**< acquisition statistics */
+} hdc2080d_cmd_t;
+
+/**
+ * @brief hdc2080d status enumeration definition
+ */
+typedef enum
+{
+    HDC2080D_STATUS_OK      = 0x00,        /**< ok */
+    HDC2080D_STATUS_INVALID = 0x01,        /**< invalid request */
+    HDC2080D_STATUS_EMPTY   = 0x02,        /**< no sample yet */
+} hdc2080d_status_t;
+
+/**
+ * @brief hdc2080d request structure definition
+ */
+typedef struct hdc2080d_request_s
+{
+    uint8_t magic;        /**< HDC2080D_MAGIC */
+    uint8_t cmd;          /**< hdc2080d_cmd_t */
+    uint8_t index;        /**< sensor index or HDC2080D_INDEX_ALL */
+} hdc2080d_request_t;
+
+/**
+ * @brief hdc2080d response structure definition
+ */
+typedef struct hdc2080d_response_s
+{
+    uint8_t magic;         /**< HDC2080D_MAGIC */
+    uint8_t status;        /**< hdc2080d_status_t */
+    uint8_t num;           /**< records after the header */
+} hdc2080d_response_t;
+
+/**
+ * @brief hdc2080d read record structure definition
+ */
+typedef struct __attribute__((packed)) hdc2080d_record_s
+{
+    uint8_t index;                    /**< sensor index */
+    uint8_t status;                   /**< interrupt and drdy status */
+    uint32_t sequence;                /**< sample sequence */
+    uint64_t timestamp_us;            /**< monotonic time of the sample */
+    int16_t temperature_centi;        /**< temperature in 0.01 degrees */
+    uint16_t humidity_centi;          /**< humidity in 0.01 percent */
+} hdc2080d_record_t;
+
+/**
+ * @brief hdc2080d stats record structure definition
+ */
+typedef struct __attribute__((packed)) hdc2080d_stats_s
+{
+    uint8_t index;            /**< sensor index */
+    uint32_t samples;         /**< acquired samples */
+    uint32_t errors;          /**< failed reads */
+    uint32_t dropped;         /**< samples dropped on a full ring */
+    uint32_t overruns;        /**< sample deadlines missed */
+    uint32_t queries;         /**< answered queries of the daemon */
+} hdc2080d_stats_t;
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      gpio.c
+ * @brief     gpio source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "gpio.h"
+#include <gpiod.h>
+#include <errno.h>
+#include <stdio.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+static struct gpiod_chip *gs_chip = NULL;        /**< gpio chip */
+static struct gpiod_line *gs_line = NULL;        /**< gpio interrupt line */
+static int gs_epoll_fd = -1;                     /**< epoll fd */
+
+/**
+ * @brief     gpio interrupt init
+ * @param[in] edge interrupt edge
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the edge events of the interrupt pin are added to an epoll set
+ */
+uint8_t gpio_interrupt_init(gpio_edge_t edge)
+{
+    int res;
+    struct epoll_event event;
+    
+    /* open the gpio chip */
+    gs_chip = gpiod_chip_open(GPIO_DEVICE_NAME);
+    if (gs_chip == NULL)
+    {
+        perror("gpio: open chip failed.\n");
+        
+        return 1;
+    }
+    
+    /* get the gpio line */
+    gs_line = gpiod_chip_get_line(gs_chip, GPIO_INTERRUPT_PIN);
+    if (gs_line == NULL)
+    {
+        perror("gpio: get line failed.\n");
+        gpiod_chip_close(gs_chip);
+        
+        return 1;
+    }
+    
+    /* request the edge events */
+    if (edge == GPIO_EDGE_RISING)
+    {
+        res = gpiod_line_request_rising_edge_events(gs_line, "hdc2080");
+    }
+    else
+    {
+        res = gpiod_line_request_falling_edge_events(gs_line, "hdc2080");
+    }
+    if (res < 0)
+    {
+        perror("gpio: request line event failed.\n");
+        gpiod_chip_close(gs_chip);
+        
+        return 1;
+    }
+    
+    /* add the event fd to the epoll set */
+    gs_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (gs_epoll_fd < 0)
+    {
+        perror("gpio: create epoll failed.\n");
+        gpiod_line_release(gs_line);
+        gpiod_chip_close(gs_chip);
+        
+        return 1;
+    }
+    event.events = EPOLLIN;
+    event.data.fd = gpiod_line_event_get_fd(gs_line);
+    if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, event.data.fd, &event) < 0)
+    {
+        perror("gpio: add epoll failed.\n");
+        (void)close(gs_epoll_fd);
+        gs_epoll_fd = -1;
+        gpiod_line_release(gs_line);
+        gpiod_chip_close(gs_chip);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  gpio interrupt deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_interrupt_deinit(void)
+{
+    /* check the init */
+    if (gs_epoll_fd < 0)
+    {
+        return 1;
+    }
+    
+    /* close all */
+    (void)close(gs_epoll_fd);
+    gs_epoll_fd = -1;
+    gpiod_line_release(gs_line);
+    gpiod_chip_close(gs_chip);
+    
+    return 0;
+}
+
+/**
+ * @brief      wait for an interrupt edge
+ * @param[in]  timeout_ms timeout in ms, -1 waits forever
+ * @param[out] *timestamp_ns pointer to an edge time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ *             - 4 timeout
+ * @note       the thread sleeps in epoll_wait, the edge time is on the CLOCK_MONOTONIC scale
+ */
+uint8_t gpio_interrupt_wait(int32_t timeout_ms, uint64_t *timestamp_ns)
+{
+    int res;
+    struct epoll_event event;
+    struct gpiod_line_event line_event;
+    
+    /* sleep until an edge, a signal restarts the wait */
+    do
+    {
+        res = epoll_wait(gs_epoll_fd, &event, 1, timeout_ms);
+    } while ((res < 0) && (errno == EINTR));
+    if (res < 0)
+    {
+        perror("gpio: epoll wait failed.\n");
+        
+        return 1;
+    }
+    if (res == 0)
+    {
+        return 4;
+    }
+    
+    /* read the edge, the kernel stamps it with the monotonic clock */
+    if (gpiod_line_event_read_fd(event.data.fd, &line_event) < 0)
+    {
+        perror("gpio: read line event failed.\n");
+        
+        return 1;
+    }
+    *timestamp_ns = (uint64_t)line_event.ts.tv_sec * 1000000000ULL + (uint64_t)line_event.ts.tv_nsec;
+    
+    return 0;
+}
@@ -36,6 +36,7 @@
 
 #include "driver_hdc2080_interface.h"
 #include "iic.h"
+#include "iic_lock.h"
 #include <stdarg.h>
 
 /**
@@ -53,10 +54,16 @@ static int gs_fd;                           /**< iic handle */
  * @return status code
  *         - 0 success
  *         - 1 iic init failed
- * @note   none
+ * @note   the bus lock is reserved first so the lock hooks never run unlocked
  */
 uint8_t hdc2080_interface_iic_init(void)
 {
+    /* the bus lock must exist before the driver locks the bus */
+    if (iic_lock_reserve(IIC_DEVICE_NAME) != 0)
+    {
+        return 1;
+    }
+    
     return iic_init(IIC_DEVICE_NAME, &gs_fd);
 }
 
@@ -104,6 +111,152 @@ uint8_t hdc2080_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return iic_read(gs_fd, addr, reg, buf, len);
 }
 
+/**
+ * @brief         interface iic bus init with a bus context
+ * @param[in,out] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 iic init failed
+ * @note          the context name is the iic device such as /dev/i2c-1, every context opens its own handle,
+ *                the bus lock is reserved first so the lock hooks never run unlocked
+ */
+uint8_t hdc2080_interface_iic_init_ctx(void *ctx)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    int fd;
+    
+    /* the bus lock must exist before the driver locks the bus */
+    if (iic_lock_reserve(bus->name) != 0)
+    {
+        return 1;
+    }
+    if (iic_init(bus->name, &fd) != 0)
+    {
+        return 1;
+    }
+    bus->fd = fd;
+    
+    return 0;
+}
+
+/**
+ * @brief         interface iic bus deinit with a bus context
+ * @param[in,out] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 iic deinit failed
+ * @note          none
+ */
+uint8_t hdc2080_interface_iic_deinit_ctx(void *ctx)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    
+    return iic_deinit(bus->fd);
+}
+
+/**
+ * @brief      interface iic bus read with a bus context
+ * @param[in]  *ctx pointer to an hdc2080_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t hdc2080_interface_iic_read_ctx(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    
+    return iic_read(bus->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with a bus context
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t hdc2080_interface_iic_write_ctx(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    
+    return iic_write(bus->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief         interface iic bus batch read
+ * @param[in]     *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @param[in,out] *batch pointer to a batch entry table
+ * @param[in]     num batch entry number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          the entries are packed into as few I2C_RDWR calls as the kernel message limit allows
+ */
+uint8_t hdc2080_interface_iic_read_batch(void *ctx, hdc2080_iic_batch_t *batch, uint16_t num)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    iic_batch_t entry[16];
+    uint16_t n;
+    uint16_t i;
+    
+    while (num > 0)
+    {
+        /* copy a chunk of entries */
+        n = (num > 16) ? 16 : num;
+        for (i = 0; i < n; i++)
+        {
+            entry[i].addr = batch[i].addr;
+            entry[i].reg = batch[i].reg;
+            entry[i].buf = batch[i].buf;
+            entry[i].len = batch[i].len;
+        }
+        
+        /* read the chunk in one call */
+        if (iic_read_batch((bus != NULL) ? bus->fd : gs_fd, entry, n) != 0)
+        {
+            return 1;
+        }
+        batch += n;
+        num -= n;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface bus lock
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @note      the handles with the same device name share one recursive lock, it is reserved when the bus opens
+ */
+void hdc2080_interface_lock(void *ctx)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    
+    (void)iic_lock((bus != NULL) ? bus->name : IIC_DEVICE_NAME);
+}
+
+/**
+ * @brief     interface bus unlock
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @note      none
+ */
+void hdc2080_interface_unlock(void *ctx)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    
+    (void)iic_unlock((bus != NULL) ? bus->name : IIC_DEVICE_NAME);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -114,6 +267,16 @@ void hdc2080_interface_delay_ms(uint32_t ms)
     usleep(1000 * ms);
 }
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void hdc2080_interface_delay_us(uint32_t us)
+{
+    usleep(us);
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
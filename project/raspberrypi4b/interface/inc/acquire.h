@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      acquire.h
+ * @brief     acquire header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef ACQUIRE_H
+#define ACQUIRE_H
+
+#include "driver_hdc2080_ring.h"
+#include "driver_hdc2080_interface.h"
+#include "shm_publish.h"
+#include "period.h"
+#include "rt.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup acquire acquire function
+ * @brief    acquire function modules
+ * @{
+ */
+
+/**
+ * @brief acquire iic device definition
+ */
+#ifndef ACQUIRE_IIC_DEVICE_NAME
+    #define ACQUIRE_IIC_DEVICE_NAME "/dev/i2c-1"        /**< iic device of the sensors */
+#endif
+
+/**
+ * @brief acquire structure definition
+ */
+typedef struct acquire_s
+{
+    hdc2080_handle_t handle;          /**< hdc2080 handle owned by the thread */
+    hdc2080_interface_bus_t bus;      /**< bus context owned by the handle */
+    hdc2080_ring_t *ring;             /**< sample ring */
+    shm_publish_t *publish;           /**< shared memory segment */
+    uint32_t index;                   /**< sensor index in the segment */
+    period_t period;                  /**< sample deadlines and jitter */
+    rt_config_t rt;                   /**< real time config */
+    uint8_t rt_enable;                /**< apply the real time config in the thread */
+    uint32_t running;                 /**< running flag */
+    uint32_t samples;                 /**< pushed samples */
+    uint32_t errors;                  /**< failed reads */
+    pthread_t thread;                 /**< acquisition thread */
+} acquire_t;
+
+/**
+ * @brief     start the acquisition thread
+ * @param[in] *acquire pointer to an acquire structure
+ * @param[in] addr_pin address pin
+ * @param[in] *ring pointer to an initialized ring or NULL
+ * @param[in] period_us sample period
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the thread triggers a 14 bit humidity and temperature conversion every period
+ *            and is the only producer of the ring, a NULL ring only publishes the samples
+ */
+uint8_t acquire_start(acquire_t *acquire, hdc2080_address_t addr_pin, hdc2080_ring_t *ring, uint32_t period_us);
+
+/**
+ * @brief     start the acquisition thread in the real time mode
+ * @param[in] *acquire pointer to an acquire structure
+ * @param[in] addr_pin address pin
+ * @param[in] *ring pointer to an initialized ring or NULL
+ * @param[in] period_us sample period
+ * @param[in] *rt pointer to an rt config
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the thread pins, raises and locks itself before the first sample,
+ *            a step the process may not do is printed and the thread runs without it
+ */
+uint8_t acquire_start_rt(acquire_t *acquire, hdc2080_address_t addr_pin, hdc2080_ring_t *ring, uint32_t period_us,
+                         const rt_config_t *rt);
+
+/**
+ * @brief     publish the samples to a shared memory segment
+ * @param[in] *acquire pointer to an acquire structure
+ * @param[in] *publish pointer to a created segment or NULL to stop publishing
+ * @param[in] index sensor index in the segment
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      it may be called while the thread runs, the thread is the only writer of the slot
+ */
+uint8_t acquire_publish(acquire_t *acquire, shm_publish_t *publish, uint32_t index);
+
+/**
+ * @brief     stop the acquisition thread
+ * @param[in] *acquire pointer to an acquire structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      it returns within one period, samples, errors and the period statistics are final afterwards
+ */
+uint8_t acquire_stop(acquire_t *acquire);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      gpio.h
+ * @brief     gpio header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef GPIO_H
+#define GPIO_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup gpio gpio function
+ * @brief    gpio function modules
+ * @{
+ */
+
+/**
+ * @brief gpio device name definition
+ */
+#define GPIO_DEVICE_NAME "/dev/gpiochip0"
+
+/**
+ * @brief gpio interrupt pin definition
+ */
+#define GPIO_INTERRUPT_PIN 17
+
+/**
+ * @brief gpio edge enumeration definition
+ */
+typedef enum
+{
+    GPIO_EDGE_FALLING = 0x00,        /**< falling edge */
+    GPIO_EDGE_RISING  = 0x01,        /**< rising edge */
+} gpio_edge_t;
+
+/**
+ * @brief     gpio interrupt init
+ * @param[in] edge interrupt edge
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the edge events of the interrupt pin are added to an epoll set
+ */
+uint8_t gpio_interrupt_init(gpio_edge_t edge);
+
+/**
+ * @brief  gpio interrupt deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_interrupt_deinit(void);
+
+/**
+ * @brief      wait for an interrupt edge
+ * @param[in]  timeout_ms timeout in ms, -1 waits forever
+ * @param[out] *timestamp_ns pointer to an edge time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ *             - 4 timeout
+ * @note       the thread sleeps in epoll_wait, the edge time is on the CLOCK_MONOTONIC scale
+ */
+uint8_t gpio_interrupt_wait(int32_t timeout_ms, uint64_t *timestamp_ns);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
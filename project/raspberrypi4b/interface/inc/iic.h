@@ -53,6 +53,17 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief iic batch read entry structure definition
+ */
+typedef struct iic_batch_s
+{
+    uint8_t addr;        /**< iic device write address */
+    uint8_t reg;         /**< iic register address */
+    uint8_t *buf;        /**< pointer to a data buffer */
+    uint16_t len;        /**< length of the data buffer */
+} iic_batch_t;
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -115,6 +126,19 @@ uint8_t iic_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
  */
 uint8_t iic_read_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief         iic bus batch read
+ * @param[in]     fd iic handle
+ * @param[in,out] *batch pointer to a batch entry table
+ * @param[in]     num batch entry number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          the register pointer write and the data read of every entry are packed into one I2C_RDWR call,
+ *                up to the kernel message limit per call, addr = device_address_7bits << 1
+ */
+uint8_t iic_read_batch(int fd, iic_batch_t *batch, uint16_t num);
+
 /**
  * @brief     iic bus write command
  * @param[in] fd iic handle
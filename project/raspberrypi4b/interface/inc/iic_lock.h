@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_lock.h
+ * @brief     iic lock header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef IIC_LOCK_H
+#define IIC_LOCK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup iic_lock iic lock function
+ * @brief    iic lock function modules
+ * @{
+ */
+
+/**
+ * @brief max bus lock number definition
+ */
+#define IIC_LOCK_MAX_BUS        16        /**< 16 buses */
+
+/**
+ * @brief     reserve the lock of an iic bus
+ * @param[in] *name pointer to an iic device name
+ * @return    status code
+ *            - 0 success
+ *            - 1 reserve failed
+ * @note      call it when the bus opens, a reserved lock is never released so the later lock and unlock
+ *            of the same name can not fail for a full lock table
+ */
+uint8_t iic_lock_reserve(const char *name);
+
+/**
+ * @brief     lock an iic bus
+ * @param[in] *name pointer to an iic device name
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      one recursive lock per device name, so a thread may lock the bus again around several driver calls
+ */
+uint8_t iic_lock(const char *name);
+
+/**
+ * @brief     unlock an iic bus
+ * @param[in] *name pointer to an iic device name
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlock failed
+ * @note      none
+ */
+uint8_t iic_unlock(const char *name);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      period.h
+ * @brief     period header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef PERIOD_H
+#define PERIOD_H
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup period period function
+ * @brief    period function modules
+ * @{
+ */
+
+/**
+ * @brief period structure definition
+ */
+typedef struct period_s
+{
+    struct timespec next;         /**< next absolute CLOCK_MONOTONIC deadline */
+    uint32_t period_us;           /**< period */
+    uint32_t ticks;               /**< deadlines served */
+    uint32_t overruns;            /**< deadlines missed and skipped */
+    uint64_t late_sum_ns;         /**< sum of the wake latency */
+    uint32_t late_min_ns;         /**< min wake latency */
+    uint32_t late_max_ns;         /**< max wake latency */
+} period_t;
+
+/**
+ * @brief     init the period
+ * @param[in] *period pointer to a period structure
+ * @param[in] period_us period
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the first deadline is one period after the init
+ */
+uint8_t period_init(period_t *period, uint32_t period_us);
+
+/**
+ * @brief      sleep until the next deadline
+ * @param[in]  *period pointer to a period structure
+ * @param[out] *missed pointer to a missed deadline number buffer or NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ * @note       the deadlines stay on the grid of the first one, work longer than a period
+ *             skips the missed deadlines and counts them as overruns instead of shifting the grid
+ */
+uint8_t period_wait(period_t *period, uint32_t *missed);
+
+/**
+ * @brief     print the period statistics
+ * @param[in] *period pointer to a period structure
+ * @param[in] *name pointer to a name
+ * @note      none
+ */
+void period_print(period_t *period, const char *name);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      rt.h
+ * @brief     rt header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RT_H
+#define RT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup rt rt function
+ * @brief    rt function modules
+ * @{
+ */
+
+/**
+ * @brief rt definition
+ */
+#define RT_STACK_PREFAULT        (64 * 1024)        /**< stack touched before the memory is locked */
+
+/**
+ * @brief rt config structure definition
+ */
+typedef struct rt_config_s
+{
+    int32_t cpu;                /**< cpu to pin the thread to or -1 */
+    int32_t priority;           /**< SCHED_FIFO priority 1 - 99 or 0 to keep SCHED_OTHER */
+    uint8_t lock_memory;        /**< prefault the stack and lock all pages */
+} rt_config_t;
+
+/**
+ * @brief     apply a real time config to the calling thread
+ * @param[in] *config pointer to an rt config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply failed
+ * @note      the memory lock is process wide and stays, every step is tried and a failed step is printed,
+ *            SCHED_FIFO needs CAP_SYS_NICE or an RLIMIT_RTPRIO and locking needs a large enough RLIMIT_MEMLOCK
+ */
+uint8_t rt_apply(const rt_config_t *config);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
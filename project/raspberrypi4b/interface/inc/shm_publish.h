@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      shm_publish.h
+ * @brief     shm publish header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SHM_PUBLISH_H
+#define SHM_PUBLISH_H
+
+#include "driver_hdc2080_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup shm_publish shm publish function
+ * @brief    shm publish function modules
+ * @{
+ */
+
+/**
+ * @brief shm publish definition
+ */
+#define SHM_PUBLISH_NAME              "/hdc2080"          /**< default segment name */
+#define SHM_PUBLISH_MAX_SENSOR        8                   /**< max sensors of one segment */
+#define SHM_PUBLISH_MAGIC             0x32434448U         /**< "HDC2" */
+#define SHM_PUBLISH_VERSION           1                   /**< segment layout version */
+
+/**
+ * @brief shm publish slot structure definition
+ */
+typedef struct shm_publish_slot_s
+{
+    uint32_t seq;                        /**< odd while the writer updates the slot */
+    uint32_t count;                      /**< published samples */
+    hdc2080_ring_sample_t sample;        /**< latest sample */
+} HDC2080_RING_ALIGN shm_publish_slot_t;
+
+/**
+ * @brief shm publish segment structure definition
+ */
+typedef struct shm_publish_segment_s
+{
+    uint32_t magic;                                        /**< segment magic */
+    uint32_t version;                                      /**< segment layout version */
+    uint32_t sensor;                                       /**< sensor number */
+    shm_publish_slot_t slot[SHM_PUBLISH_MAX_SENSOR];       /**< one slot per sensor */
+} shm_publish_segment_t;
+
+/**
+ * @brief shm publish structure definition
+ */
+typedef struct shm_publish_s
+{
+    char name[32];                        /**< segment name */
+    shm_publish_segment_t *segment;       /**< mapped segment */
+    uint8_t writer;                       /**< 1 for the writer */
+} shm_publish_t;
+
+/**
+ * @brief     create the segment as the writer
+ * @param[in] *publish pointer to a shm publish structure
+ * @param[in] *name pointer to a segment name
+ * @param[in] sensor sensor number
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      there must be only one writer of a segment
+ */
+uint8_t shm_publish_create(shm_publish_t *publish, const char *name, uint32_t sensor);
+
+/**
+ * @brief     open the segment as a reader
+ * @param[in] *publish pointer to a shm publish structure
+ * @param[in] *name pointer to a segment name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the segment is mapped read only, any number of processes may open it
+ */
+uint8_t shm_publish_open(shm_publish_t *publish, const char *name);
+
+/**
+ * @brief     close the segment
+ * @param[in] *publish pointer to a shm publish structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also removes the segment name
+ */
+uint8_t shm_publish_close(shm_publish_t *publish);
+
+/**
+ * @brief     publish the latest sample of a sensor
+ * @param[in] *publish pointer to a shm publish structure
+ * @param[in] index sensor index
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      it never waits for the readers
+ */
+uint8_t shm_publish_write(shm_publish_t *publish, uint32_t index, const hdc2080_ring_sample_t *sample);
+
+/**
+ * @brief     start a zero copy read of a slot
+ * @param[in] *slot pointer to a mapped slot
+ * @return    sequence to pass to shm_publish_read_retry
+ * @note      the fields of the slot may be read in place until shm_publish_read_retry
+ */
+uint32_t shm_publish_read_begin(const shm_publish_slot_t *slot);
+
+/**
+ * @brief     check a zero copy read of a slot
+ * @param[in] *slot pointer to a mapped slot
+ * @param[in] seq sequence of shm_publish_read_begin
+ * @return    1 if the read must be retried, else 0
+ * @note      none
+ */
+uint8_t shm_publish_read_retry(const shm_publish_slot_t *slot, uint32_t seq);
+
+/**
+ * @brief      read a consistent copy of the latest sample of a sensor
+ * @param[in]  *publish pointer to a shm publish structure
+ * @param[in]  index sensor index
+ * @param[out] *sample pointer to a sample buffer
+ * @param[out] *count pointer to a published sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 4 nothing published yet
+ * @note       it retries only while the writer is updating the same slot
+ */
+uint8_t shm_publish_read(shm_publish_t *publish, uint32_t index, hdc2080_ring_sample_t *sample, uint32_t *count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,276 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      acquire.c
+ * @brief     acquire source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "acquire.h"
+#include "driver_hdc2080_interface.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief     acquisition thread
+ * @param[in] *arg pointer to an acquire structure
+ * @return    NULL
+ * @note      none
+ */
+static void *a_acquire_thread(void *arg)
+{
+    acquire_t *acquire = (acquire_t *)arg;
+    hdc2080_snapshot_t snapshot;
+    hdc2080_ring_sample_t sample;
+    shm_publish_t *publish;
+    struct timespec now;
+    
+    /* the real time mode is set up by the thread itself */
+    if (acquire->rt_enable != 0)
+    {
+        (void)rt_apply(&acquire->rt);
+    }
+    while (__atomic_load_n(&acquire->running, __ATOMIC_ACQUIRE) != 0)
+    {
+        /* sleep to the next deadline of the grid, a stall skips deadlines but never shifts the grid */
+        if (period_wait(&acquire->period, NULL) != 0)
+        {
+            break;
+        }
+        
+        /* trigger, wait for the conversion and read all registers in one transfer */
+        if ((hdc2080_read_poll(&acquire->handle) == 0) &&
+            (hdc2080_read_snapshot(&acquire->handle, &snapshot) == 0))
+        {
+            (void)clock_gettime(CLOCK_MONOTONIC, &now);
+            sample.timestamp_us = (uint64_t)now.tv_sec * 1000000ULL + (uint64_t)(now.tv_nsec / 1000);
+            sample.temperature_raw = snapshot.temperature_raw;
+            sample.temperature_centi = snapshot.temperature_centi;
+            sample.humidity_raw = snapshot.humidity_raw;
+            sample.humidity_centi = snapshot.humidity_centi;
+            sample.status = snapshot.status;
+            
+            /* the ring numbers the sample and a full ring drops it and counts it, without a ring nothing is dropped */
+            if (acquire->ring != NULL)
+            {
+                if (hdc2080_ring_push(acquire->ring, &sample) == 0)
+                {
+                    (void)__atomic_fetch_add(&acquire->samples, 1, __ATOMIC_RELAXED);
+                }
+            }
+            else
+            {
+                sample.sequence = __atomic_fetch_add(&acquire->samples, 1, __ATOMIC_RELAXED);
+            }
+            
+            /* overwrite the latest sample of the segment */
+            publish = __atomic_load_n(&acquire->publish, __ATOMIC_ACQUIRE);
+            if (publish != NULL)
+            {
+                (void)shm_publish_write(publish, __atomic_load_n(&acquire->index, __ATOMIC_ACQUIRE), &sample);
+            }
+        }
+        else
+        {
+            (void)__atomic_fetch_add(&acquire->errors, 1, __ATOMIC_RELAXED);
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     start the acquisition thread in the real time mode
+ * @param[in] *acquire pointer to an acquire structure
+ * @param[in] addr_pin address pin
+ * @param[in] *ring pointer to an initialized ring or NULL
+ * @param[in] period_us sample period
+ * @param[in] *rt pointer to an rt config
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the thread pins, raises and locks itself before the first sample,
+ *            a step the process may not do is printed and the thread runs without it
+ */
+uint8_t acquire_start_rt(acquire_t *acquire, hdc2080_address_t addr_pin, hdc2080_ring_t *ring, uint32_t period_us,
+                         const rt_config_t *rt)
+{
+    hdc2080_handle_t *handle;
+    
+    /* check the params */
+    if ((acquire == NULL) || (period_us == 0))
+    {
+        return 1;
+    }
+    handle = &acquire->handle;
+    memset(&acquire->bus, 0, sizeof(hdc2080_interface_bus_t));
+    strncpy(acquire->bus.name, ACQUIRE_IIC_DEVICE_NAME, sizeof(acquire->bus.name) - 1);
+    acquire->bus.fd = -1;
+    
+    /* link interface function, every handle opens and closes its own fd */
+    DRIVER_HDC2080_LINK_INIT(handle, hdc2080_handle_t);
+    DRIVER_HDC2080_LINK_CONTEXT(handle, &acquire->bus);
+    DRIVER_HDC2080_LINK_IIC_INIT_CTX(handle, hdc2080_interface_iic_init_ctx);
+    DRIVER_HDC2080_LINK_IIC_DEINIT_CTX(handle, hdc2080_interface_iic_deinit_ctx);
+    DRIVER_HDC2080_LINK_IIC_READ_CTX(handle, hdc2080_interface_iic_read_ctx);
+    DRIVER_HDC2080_LINK_IIC_WRITE_CTX(handle, hdc2080_interface_iic_write_ctx);
+    DRIVER_HDC2080_LINK_DELAY_MS(handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_LOCK(handle, hdc2080_interface_lock);
+    DRIVER_HDC2080_LINK_UNLOCK(handle, hdc2080_interface_unlock);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(handle, hdc2080_interface_debug_print);
+    
+    /* init the sensor */
+    if (hdc2080_set_addr_pin(handle, addr_pin) != 0)
+    {
+        return 1;
+    }
+    if (hdc2080_init(handle) != 0)
+    {
+        return 1;
+    }
+    if ((hdc2080_set_temperature_resolution(handle, HDC2080_RESOLUTION_14_BIT) != 0) ||
+        (hdc2080_set_humidity_resolution(handle, HDC2080_RESOLUTION_14_BIT) != 0) ||
+        (hdc2080_set_mode(handle, HDC2080_MODE_HUMIDITY_TEMPERATURE) != 0) ||
+        (hdc2080_set_auto_measurement_mode(handle, HDC2080_AUTO_MEASUREMENT_MODE_DISABLED) != 0))
+    {
+        (void)hdc2080_deinit(handle);
+        
+        return 1;
+    }
+    
+    /* start the thread */
+    acquire->ring = ring;
+    acquire->rt_enable = (rt != NULL) ? 1 : 0;
+    if (rt != NULL)
+    {
+        acquire->rt = *rt;
+    }
+    acquire->publish = NULL;
+    acquire->index = 0;
+    if (period_init(&acquire->period, period_us) != 0)
+    {
+        (void)hdc2080_deinit(handle);
+        
+        return 1;
+    }
+    acquire->samples = 0;
+    acquire->errors = 0;
+    __atomic_store_n(&acquire->running, 1, __ATOMIC_RELEASE);
+    if (pthread_create(&acquire->thread, NULL, a_acquire_thread, acquire) != 0)
+    {
+        perror("acquire: create thread failed.\n");
+        __atomic_store_n(&acquire->running, 0, __ATOMIC_RELEASE);
+        (void)hdc2080_deinit(handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     start the acquisition thread
+ * @param[in] *acquire pointer to an acquire structure
+ * @param[in] addr_pin address pin
+ * @param[in] *ring pointer to an initialized ring or NULL
+ * @param[in] period_us sample period
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the thread triggers a 14 bit humidity and temperature conversion every period
+ *            and is the only producer of the ring, a NULL ring only publishes the samples
+ */
+uint8_t acquire_start(acquire_t *acquire, hdc2080_address_t addr_pin, hdc2080_ring_t *ring, uint32_t period_us)
+{
+    return acquire_start_rt(acquire, addr_pin, ring, period_us, NULL);
+}
+
+/**
+ * @brief     publish the samples to a shared memory segment
+ * @param[in] *acquire pointer to an acquire structure
+ * @param[in] *publish pointer to a created segment or NULL to stop publishing
+ * @param[in] index sensor index in the segment
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      it may be called while the thread runs, the thread is the only writer of the slot
+ */
+uint8_t acquire_publish(acquire_t *acquire, shm_publish_t *publish, uint32_t index)
+{
+    /* check the params */
+    if ((acquire == NULL) ||
+        ((publish != NULL) && ((publish->segment == NULL) || (index >= publish->segment->sensor))))
+    {
+        return 1;
+    }
+    
+    /* the index is visible before the segment */
+    __atomic_store_n(&acquire->index, index, __ATOMIC_RELEASE);
+    __atomic_store_n(&acquire->publish, publish, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief     stop the acquisition thread
+ * @param[in] *acquire pointer to an acquire structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      it returns within one period, samples and errors are final afterwards
+ */
+uint8_t acquire_stop(acquire_t *acquire)
+{
+    /* check the acquire */
+    if (acquire == NULL)
+    {
+        return 1;
+    }
+    
+    /* stop and join the thread */
+    __atomic_store_n(&acquire->running, 0, __ATOMIC_RELEASE);
+    if (pthread_join(acquire->thread, NULL) != 0)
+    {
+        perror("acquire: join thread failed.\n");
+        
+        return 1;
+    }
+    
+    /* close the sensor */
+    if (hdc2080_deinit(&acquire->handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
@@ -226,6 +226,66 @@ uint8_t iic_read_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uin
     return 0;
 }
 
+/**
+ * @brief         iic bus batch read
+ * @param[in]     fd iic handle
+ * @param[in,out] *batch pointer to a batch entry table
+ * @param[in]     num batch entry number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          the register pointer write and the data read of every entry are packed into one I2C_RDWR call,
+ *                up to the kernel message limit per call, addr = device_address_7bits << 1
+ */
+uint8_t iic_read_batch(int fd, iic_batch_t *batch, uint16_t num)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+    uint16_t n;
+    uint16_t i;
+    
+    while (num > 0)
+    {
+        /* two messages per entry */
+        n = (num > I2C_RDWR_IOCTL_MAX_MSGS / 2) ? (I2C_RDWR_IOCTL_MAX_MSGS / 2) : num;
+        
+        /* clear ioctl data */
+        memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+        
+        /* clear msgs data */
+        memset(msgs, 0, sizeof(struct i2c_msg) * n * 2);
+        
+        /* set the param */
+        for (i = 0; i < n; i++)
+        {
+            msgs[i * 2].addr = batch[i].addr >> 1;
+            msgs[i * 2].flags = 0;
+            msgs[i * 2].buf = &batch[i].reg;
+            msgs[i * 2].len = 1;
+            msgs[i * 2 + 1].addr = batch[i].addr >> 1;
+            msgs[i * 2 + 1].flags = I2C_M_RD;
+            msgs[i * 2 + 1].buf = batch[i].buf;
+            msgs[i * 2 + 1].len = batch[i].len;
+        }
+        i2c_rdwr_data.msgs = msgs;
+        i2c_rdwr_data.nmsgs = n * 2;
+        
+        /* transmit */
+        if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+        {
+            perror("iic: read failed.\n");
+            
+            return 1;
+        }
+        
+        /* next chunk */
+        batch += n;
+        num -= n;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief     iic bus write command
  * @param[in] fd iic handle
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_lock.c
+ * @brief     iic lock source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "iic_lock.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief iic bus lock structure definition
+ */
+typedef struct iic_lock_bus_s
+{
+    char name[32];                  /**< iic device name */
+    pthread_mutex_t mutex;          /**< bus mutex */
+} iic_lock_bus_t;
+
+static pthread_mutex_t gs_table_mutex = PTHREAD_MUTEX_INITIALIZER;        /**< lock table mutex */
+static iic_lock_bus_t gs_bus[IIC_LOCK_MAX_BUS];                           /**< bus locks */
+static uint32_t gs_bus_number = 0;                                        /**< used bus locks */
+
+/**
+ * @brief     find or create a bus lock
+ * @param[in] *name pointer to an iic device name
+ * @return    pointer to a bus lock or NULL
+ * @note      none
+ */
+static iic_lock_bus_t *a_iic_lock_find(const char *name)
+{
+    pthread_mutexattr_t attr;
+    iic_lock_bus_t *bus = NULL;
+    uint32_t i;
+    
+    /* lock the table */
+    pthread_mutex_lock(&gs_table_mutex);
+    
+    /* find the bus */
+    for (i = 0; i < gs_bus_number; i++)
+    {
+        if (strncmp(gs_bus[i].name, name, 31) == 0)
+        {
+            bus = &gs_bus[i];
+            
+            break;
+        }
+    }
+    
+    /* create a recursive lock */
+    if ((bus == NULL) && (gs_bus_number < IIC_LOCK_MAX_BUS))
+    {
+        bus = &gs_bus[gs_bus_number];
+        memset(bus->name, 0, sizeof(bus->name));
+        strncpy(bus->name, name, 31);
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+        pthread_mutex_init(&bus->mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+        gs_bus_number++;
+    }
+    
+    /* unlock the table */
+    pthread_mutex_unlock(&gs_table_mutex);
+    
+    return bus;
+}
+
+/**
+ * @brief     reserve the lock of an iic bus
+ * @param[in] *name pointer to an iic device name
+ * @return    status code
+ *            - 0 success
+ *            - 1 reserve failed
+ * @note      call it when the bus opens, a reserved lock is never released so the later lock and unlock
+ *            of the same name can not fail for a full lock table
+ */
+uint8_t iic_lock_reserve(const char *name)
+{
+    /* find or create the bus lock */
+    if (a_iic_lock_find(name) == NULL)
+    {
+        fprintf(stderr, "iic: too many bus locks.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     lock an iic bus
+ * @param[in] *name pointer to an iic device name
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      one recursive lock per device name, so a thread may lock the bus again around several driver calls
+ */
+uint8_t iic_lock(const char *name)
+{
+    iic_lock_bus_t *bus;
+    
+    /* get the bus lock */
+    bus = a_iic_lock_find(name);
+    if (bus == NULL)
+    {
+        fprintf(stderr, "iic: too many bus locks.\n");
+        
+        return 1;
+    }
+    
+    /* lock the bus */
+    if (pthread_mutex_lock(&bus->mutex) != 0)
+    {
+        perror("iic: lock failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     unlock an iic bus
+ * @param[in] *name pointer to an iic device name
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlock failed
+ * @note      none
+ */
+uint8_t iic_unlock(const char *name)
+{
+    iic_lock_bus_t *bus;
+    
+    /* get the bus lock */
+    bus = a_iic_lock_find(name);
+    if (bus == NULL)
+    {
+        fprintf(stderr, "iic: too many bus locks.\n");
+        
+        return 1;
+    }
+    
+    /* unlock the bus */
+    if (pthread_mutex_unlock(&bus->mutex) != 0)
+    {
+        perror("iic: unlock failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      period.c
+ * @brief     period source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "period.h"
+#include "driver_hdc2080_interface.h"
+#include <errno.h>
+#include <stdio.h>
+
+/**
+ * @brief     get the signed difference of two times
+ * @param[in] *a pointer to a time
+ * @param[in] *b pointer to a time
+ * @return    a - b in nanoseconds
+ * @note      none
+ */
+static int64_t a_period_diff_ns(const struct timespec *a, const struct timespec *b)
+{
+    return (int64_t)(a->tv_sec - b->tv_sec) * 1000000000LL + (int64_t)(a->tv_nsec - b->tv_nsec);
+}
+
+/**
+ * @brief     add nanoseconds to a time
+ * @param[in] *ts pointer to a time
+ * @param[in] ns nanoseconds
+ * @note      none
+ */
+static void a_period_add_ns(struct timespec *ts, uint64_t ns)
+{
+    /* add and carry */
+    ts->tv_sec += (time_t)(ns / 1000000000ULL);
+    ts->tv_nsec += (long)(ns % 1000000000ULL);
+    if (ts->tv_nsec >= 1000000000L)
+    {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+/**
+ * @brief     init the period
+ * @param[in] *period pointer to a period structure
+ * @param[in] period_us period
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the first deadline is one period after the init
+ */
+uint8_t period_init(period_t *period, uint32_t period_us)
+{
+    /* check the params */
+    if ((period == NULL) || (period_us == 0))
+    {
+        return 1;
+    }
+    
+    /* start the grid now */
+    if (clock_gettime(CLOCK_MONOTONIC, &period->next) != 0)
+    {
+        perror("period: get time failed.\n");
+        
+        return 1;
+    }
+    period->period_us = period_us;
+    period->ticks = 0;
+    period->overruns = 0;
+    period->late_sum_ns = 0;
+    period->late_min_ns = UINT32_MAX;
+    period->late_max_ns = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      sleep until the next deadline
+ * @param[in]  *period pointer to a period structure
+ * @param[out] *missed pointer to a missed deadline number buffer or NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ * @note       the deadlines stay on the grid of the first one, work longer than a period
+ *             skips the missed deadlines and counts them as overruns instead of shifting the grid
+ */
+uint8_t period_wait(period_t *period, uint32_t *missed)
+{
+    struct timespec now;
+    uint64_t period_ns;
+    int64_t late;
+    uint32_t skip;
+    int res;
+    
+    /* check the period */
+    if ((period == NULL) || (period->period_us == 0))
+    {
+        return 1;
+    }
+    period_ns = (uint64_t)period->period_us * 1000ULL;
+    
+    /* skip the deadlines already passed by more than one period */
+    skip = 0;
+    a_period_add_ns(&period->next, period_ns);
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    late = a_period_diff_ns(&now, &period->next);
+    if (late >= (int64_t)period_ns)
+    {
+        skip = (uint32_t)((uint64_t)late / period_ns);
+        a_period_add_ns(&period->next, (uint64_t)skip * period_ns);
+    }
+    
+    /* sleep to the absolute deadline, a signal resumes the same deadline */
+    do
+    {
+        res = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &period->next, NULL);
+    } while (res == EINTR);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* the wake latency behind the deadline is the jitter */
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    late = a_period_diff_ns(&now, &period->next);
+    if (late < 0)
+    {
+        late = 0;
+    }
+    if (late > (int64_t)UINT32_MAX)
+    {
+        late = (int64_t)UINT32_MAX;
+    }
+    period->late_sum_ns += (uint64_t)late;
+    if ((uint32_t)late < period->late_min_ns)
+    {
+        period->late_min_ns = (uint32_t)late;
+    }
+    if ((uint32_t)late > period->late_max_ns)
+    {
+        period->late_max_ns = (uint32_t)late;
+    }
+    period->overruns += skip;
+    period->ticks++;
+    if (missed != NULL)
+    {
+        *missed = skip;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     print the period statistics
+ * @param[in] *period pointer to a period structure
+ * @param[in] *name pointer to a name
+ * @note      none
+ */
+void period_print(period_t *period, const char *name)
+{
+    /* check the period */
+    if ((period == NULL) || (period->ticks == 0))
+    {
+        return;
+    }
+    
+    hdc2080_interface_debug_print("%s: period %dus, ticks %d, overruns %d, jitter min %0.1fus avg %0.1fus max %0.1fus.\n",
+                                  name, period->period_us, period->ticks, period->overruns,
+                                  (float)period->late_min_ns / 1000.0f,
+                                  (float)((double)period->late_sum_ns / (double)period->ticks) / 1000.0f,
+                                  (float)period->late_max_ns / 1000.0f);
+}
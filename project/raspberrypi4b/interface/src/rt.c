@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      rt.c
+ * @brief     rt source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE        /**< cpu affinity */
+#endif
+
+#include "rt.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/**
+ * @brief touch the stack pages so they are mapped before they are locked
+ * @note  none
+ */
+static void a_rt_prefault_stack(void)
+{
+    volatile uint8_t stack[RT_STACK_PREFAULT];
+    uint32_t i;
+    
+    /* one write per page is enough */
+    for (i = 0; i < RT_STACK_PREFAULT; i += 4096)
+    {
+        stack[i] = 0;
+    }
+    (void)stack[0];
+}
+
+/**
+ * @brief     apply a real time config to the calling thread
+ * @param[in] *config pointer to an rt config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply failed
+ * @note      the memory lock is process wide and stays, every step is tried and a failed step is printed,
+ *            SCHED_FIFO needs CAP_SYS_NICE or an RLIMIT_RTPRIO and locking needs a large enough RLIMIT_MEMLOCK
+ */
+uint8_t rt_apply(const rt_config_t *config)
+{
+    cpu_set_t set;
+    struct sched_param param;
+    uint8_t res;
+    int err;
+    
+    /* check the config */
+    if ((config == NULL) || (config->priority < 0) || (config->priority > 99))
+    {
+        return 1;
+    }
+    res = 0;
+    
+    /* lock the current and future pages, the stack is faulted in first */
+    if (config->lock_memory != 0)
+    {
+        a_rt_prefault_stack();
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        {
+            perror("rt: lock memory failed.\n");
+            res = 1;
+        }
+    }
+    
+    /* pin the thread */
+    if (config->cpu >= 0)
+    {
+        CPU_ZERO(&set);
+        CPU_SET(config->cpu, &set);
+        err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+        if (err != 0)
+        {
+            (void)fprintf(stderr, "rt: set affinity failed, %s.\n", strerror(err));
+            res = 1;
+        }
+    }
+    
+    /* raise the policy */
+    if (config->priority > 0)
+    {
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = config->priority;
+        err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (err != 0)
+        {
+            (void)fprintf(stderr, "rt: set SCHED_FIFO failed, %s.\n", strerror(err));
+            res = 1;
+        }
+    }
+    
+    return res;
+}
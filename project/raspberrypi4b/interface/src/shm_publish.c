@@ -0,0 +1,295 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      shm_publish.c
+ * @brief     shm publish source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "shm_publish.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief     create the segment as the writer
+ * @param[in] *publish pointer to a shm publish structure
+ * @param[in] *name pointer to a segment name
+ * @param[in] sensor sensor number
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      there must be only one writer of a segment
+ */
+uint8_t shm_publish_create(shm_publish_t *publish, const char *name, uint32_t sensor)
+{
+    int fd;
+    void *addr;
+    
+    /* check the params */
+    if ((publish == NULL) || (name == NULL) || (strlen(name) >= sizeof(publish->name)) ||
+        (sensor == 0) || (sensor > SHM_PUBLISH_MAX_SENSOR))
+    {
+        return 1;
+    }
+    
+    /* create and size the segment */
+    fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        perror("shm: open failed.\n");
+        
+        return 1;
+    }
+    if (ftruncate(fd, sizeof(shm_publish_segment_t)) < 0)
+    {
+        perror("shm: truncate failed.\n");
+        (void)close(fd);
+        (void)shm_unlink(name);
+        
+        return 1;
+    }
+    
+    /* map it, the mapping stays valid after the close */
+    addr = mmap(NULL, sizeof(shm_publish_segment_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED)
+    {
+        perror("shm: map failed.\n");
+        (void)shm_unlink(name);
+        
+        return 1;
+    }
+    
+    /* clear all slots and publish the header last */
+    publish->segment = (shm_publish_segment_t *)addr;
+    memset(publish->segment, 0, sizeof(shm_publish_segment_t));
+    publish->segment->version = SHM_PUBLISH_VERSION;
+    publish->segment->sensor = sensor;
+    __atomic_store_n(&publish->segment->magic, SHM_PUBLISH_MAGIC, __ATOMIC_RELEASE);
+    strcpy(publish->name, name);
+    publish->writer = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief     open the segment as a reader
+ * @param[in] *publish pointer to a shm publish structure
+ * @param[in] *name pointer to a segment name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the segment is mapped read only, any number of processes may open it
+ */
+uint8_t shm_publish_open(shm_publish_t *publish, const char *name)
+{
+    int fd;
+    void *addr;
+    struct stat st;
+    
+    /* check the params */
+    if ((publish == NULL) || (name == NULL) || (strlen(name) >= sizeof(publish->name)))
+    {
+        return 1;
+    }
+    
+    /* open the segment and check the size */
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        perror("shm: open failed.\n");
+        
+        return 1;
+    }
+    if ((fstat(fd, &st) < 0) || ((size_t)st.st_size < sizeof(shm_publish_segment_t)))
+    {
+        (void)fprintf(stderr, "shm: segment size is invalid.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    
+    /* map it read only */
+    addr = mmap(NULL, sizeof(shm_publish_segment_t), PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED)
+    {
+        perror("shm: map failed.\n");
+        
+        return 1;
+    }
+    
+    /* check the layout */
+    publish->segment = (shm_publish_segment_t *)addr;
+    if ((__atomic_load_n(&publish->segment->magic, __ATOMIC_ACQUIRE) != SHM_PUBLISH_MAGIC) ||
+        (publish->segment->version != SHM_PUBLISH_VERSION))
+    {
+        (void)fprintf(stderr, "shm: segment layout is invalid.\n");
+        (void)munmap(addr, sizeof(shm_publish_segment_t));
+        
+        return 1;
+    }
+    strcpy(publish->name, name);
+    publish->writer = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     close the segment
+ * @param[in] *publish pointer to a shm publish structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also removes the segment name
+ */
+uint8_t shm_publish_close(shm_publish_t *publish)
+{
+    /* check the params */
+    if ((publish == NULL) || (publish->segment == NULL))
+    {
+        return 1;
+    }
+    
+    /* unmap, the readers keep their own mappings */
+    (void)munmap(publish->segment, sizeof(shm_publish_segment_t));
+    publish->segment = NULL;
+    if (publish->writer != 0)
+    {
+        (void)shm_unlink(publish->name);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     publish the latest sample of a sensor
+ * @param[in] *publish pointer to a shm publish structure
+ * @param[in] index sensor index
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      it never waits for the readers
+ */
+uint8_t shm_publish_write(shm_publish_t *publish, uint32_t index, const hdc2080_ring_sample_t *sample)
+{
+    shm_publish_slot_t *slot;
+    uint32_t seq;
+    
+    /* check the params */
+    if ((publish == NULL) || (publish->segment == NULL) || (publish->writer == 0) ||
+        (index >= publish->segment->sensor) || (sample == NULL))
+    {
+        return 1;
+    }
+    slot = &publish->segment->slot[index];
+    
+    /* an odd sequence marks the update */
+    seq = slot->seq;
+    __atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->sample = *sample;
+    slot->count++;
+    __atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief     start a zero copy read of a slot
+ * @param[in] *slot pointer to a mapped slot
+ * @return    sequence to pass to shm_publish_read_retry
+ * @note      the fields of the slot may be read in place until shm_publish_read_retry
+ */
+uint32_t shm_publish_read_begin(const shm_publish_slot_t *slot)
+{
+    return __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief     check a zero copy read of a slot
+ * @param[in] *slot pointer to a mapped slot
+ * @param[in] seq sequence of shm_publish_read_begin
+ * @return    1 if the read must be retried, else 0
+ * @note      none
+ */
+uint8_t shm_publish_read_retry(const shm_publish_slot_t *slot, uint32_t seq)
+{
+    /* keep the field reads before the second sequence load */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    
+    return (((seq & 1) != 0) || (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != seq)) ? 1 : 0;
+}
+
+/**
+ * @brief      read a consistent copy of the latest sample of a sensor
+ * @param[in]  *publish pointer to a shm publish structure
+ * @param[in]  index sensor index
+ * @param[out] *sample pointer to a sample buffer
+ * @param[out] *count pointer to a published sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 4 nothing published yet
+ * @note       it retries only while the writer is updating the same slot
+ */
+uint8_t shm_publish_read(shm_publish_t *publish, uint32_t index, hdc2080_ring_sample_t *sample, uint32_t *count)
+{
+    const shm_publish_slot_t *slot;
+    uint32_t seq;
+    
+    /* check the params */
+    if ((publish == NULL) || (publish->segment == NULL) ||
+        (index >= publish->segment->sensor) || (sample == NULL) || (count == NULL))
+    {
+        return 1;
+    }
+    slot = &publish->segment->slot[index];
+    
+    /* copy until no update overlapped */
+    do
+    {
+        seq = shm_publish_read_begin(slot);
+        *sample = slot->sample;
+        *count = slot->count;
+    } while (shm_publish_read_retry(slot, seq) != 0);
+    if (*count == 0)
+    {
+        return 4;
+    }
+    
+    return 0;
+}
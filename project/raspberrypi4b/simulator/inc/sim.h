@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim.h
+ * @brief     sim header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sim sim function
+ * @brief    hdc2080 register level simulator modules
+ * @{
+ */
+
+/**
+ * @brief sim limit definition
+ */
+#define SIM_MAX_DEVICES        16         /**< max simulated devices */
+#define SIM_DEFAULT_BUS        1          /**< default bus number */
+
+/**
+ * @brief sim statistics structure definition
+ */
+typedef struct sim_stats_s
+{
+    uint64_t transactions;        /**< bus transactions */
+    uint64_t messages;            /**< bus messages, a repeated start begins a new message */
+    uint64_t read_bytes;          /**< data bytes read */
+    uint64_t write_bytes;         /**< data bytes written */
+    uint64_t nacks;               /**< address nacks */
+    uint64_t bus_ns;              /**< virtual time spent on the bus */
+    uint64_t delay_ns;            /**< virtual time spent in delays */
+    uint64_t delays;              /**< delay calls */
+    uint64_t conversions;         /**< finished conversions */
+} sim_stats_t;
+
+/**
+ * @brief  sim init
+ * @return status code
+ *         - 0 success
+ * @note   the clock is set to 0 and two devices are added on the default bus at 0x40 and 0x41,
+ *         every other api calls it once automatically, the clock never falls behind the real time since the init
+ */
+uint8_t sim_init(void);
+
+/**
+ * @brief  sim deinit
+ * @return status code
+ *         - 0 success
+ * @note   all devices are removed
+ */
+uint8_t sim_deinit(void);
+
+/**
+ * @brief     add a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits iic address
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the device starts with the power on register values, 25C and 50%
+ */
+uint8_t sim_add_device(uint8_t bus, uint8_t addr);
+
+/**
+ * @brief     remove a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits iic address
+ * @return    status code
+ *            - 0 success
+ *            - 1 remove failed
+ * @note      none
+ */
+uint8_t sim_remove_device(uint8_t bus, uint8_t addr);
+
+/**
+ * @brief     set the environment of a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits iic address
+ * @param[in] temperature ambient temperature in degrees
+ * @param[in] humidity ambient humidity in percent
+ * @return    status code
+ *            - 0 success
+ *            - 1 no device
+ * @note      none
+ */
+uint8_t sim_set_environment(uint8_t bus, uint8_t addr, float temperature, float humidity);
+
+/**
+ * @brief     set the measurement noise of a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits iic address
+ * @param[in] temperature_sigma temperature noise standard deviation in degrees
+ * @param[in] humidity_sigma humidity noise standard deviation in percent
+ * @param[in] seed noise seed
+ * @return    status code
+ *            - 0 success
+ *            - 1 no device
+ * @note      the noise is gaussian and reproducible for the same seed
+ */
+uint8_t sim_set_noise(uint8_t bus, uint8_t addr, float temperature_sigma, float humidity_sigma, uint32_t seed);
+
+/**
+ * @brief     set the bus speed
+ * @param[in] hz bus clock
+ * @return    status code
+ *            - 0 success
+ *            - 1 hz is invalid
+ * @note      default is 400khz, every bit costs 1 / hz of virtual time
+ */
+uint8_t sim_set_bus_speed(uint32_t hz);
+
+/**
+ * @brief  get the virtual clock
+ * @return virtual time in ns
+ * @note   none
+ */
+uint64_t sim_get_time_ns(void);
+
+/**
+ * @brief     advance the virtual clock
+ * @param[in] ns time to advance
+ * @note      it is counted as a delay in the statistics
+ */
+void sim_delay_ns(uint64_t ns);
+
+/**
+ * @brief      run one bus transaction
+ * @param[in]  bus bus number
+ * @param[in]  addr 7 bits iic address
+ * @param[in]  *wbuf pointer to a write buffer, the first byte is the register pointer
+ * @param[in]  wlen write length, 0 skips the write message
+ * @param[out] *rbuf pointer to a read buffer
+ * @param[in]  rlen read length, 0 skips the read message
+ * @return     status code
+ *             - 0 success
+ *             - 1 nack
+ * @note       a write followed by a read uses a repeated start, reads auto increment the register pointer
+ */
+uint8_t sim_transfer(uint8_t bus, uint8_t addr, const uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @brief      get the interrupt pin level of a device
+ * @param[in]  bus bus number
+ * @param[in]  addr 7 bits iic address
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no device
+ * @note       a disabled pin is high impedance and reads as 1 with the pull up
+ */
+uint8_t sim_get_int_pin(uint8_t bus, uint8_t addr, uint8_t *level);
+
+/**
+ * @brief      read a register without bus access
+ * @param[in]  bus bus number
+ * @param[in]  addr 7 bits iic address
+ * @param[in]  reg register address
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no device
+ * @note       no side effects, status flags are not cleared
+ */
+uint8_t sim_peek(uint8_t bus, uint8_t addr, uint8_t reg, uint8_t *value);
+
+/**
+ * @brief      get the statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @note       none
+ */
+void sim_get_stats(sim_stats_t *stats);
+
+/**
+ * @brief  reset the statistics
+ * @note   none
+ */
+void sim_reset_stats(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
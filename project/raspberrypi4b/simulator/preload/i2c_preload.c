@@ -0,0 +1,533 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      i2c_preload.c
+ * @brief     i2c preload source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE        /**< RTLD_NEXT */
+#endif
+
+#include "sim.h"
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief preload definition
+ */
+#define PRELOAD_DEVICE_PREFIX        "/dev/i2c-"                 /**< intercepted device names */
+#define PRELOAD_REPORT_ENV           "HDC2080_I2C_REPORT"        /**< report path, stderr if unset */
+#define PRELOAD_DEVICES_ENV          "HDC2080_I2C_DEVICES"       /**< fitted addresses, 0x40,0x41 if unset */
+#define PRELOAD_MAX_FD               1024                        /**< max emulated fd */
+
+/**
+ * @brief preload ioctl enumeration definition
+ */
+typedef enum
+{
+    PRELOAD_IOCTL_RDWR  = 0,        /**< I2C_RDWR */
+    PRELOAD_IOCTL_SLAVE = 1,        /**< I2C_SLAVE and I2C_SLAVE_FORCE */
+    PRELOAD_IOCTL_FUNCS = 2,        /**< I2C_FUNCS */
+    PRELOAD_IOCTL_OTHER = 3,        /**< any other request */
+    PRELOAD_IOCTL_NUM   = 4,        /**< request kinds */
+} preload_ioctl_t;
+
+/**
+ * @brief preload stats structure definition
+ */
+typedef struct preload_stats_s
+{
+    uint64_t calls;              /**< ioctl calls */
+    uint64_t errors;             /**< failed calls */
+    uint64_t messages;           /**< i2c messages */
+    uint64_t read_bytes;         /**< bytes read */
+    uint64_t write_bytes;        /**< bytes written */
+    uint64_t wall_ns;            /**< time spent in the emulated calls */
+    uint64_t wall_min_ns;        /**< min call time */
+    uint64_t wall_max_ns;        /**< max call time */
+    uint64_t bus_ns;             /**< modelled bus time */
+} preload_stats_t;
+
+static int (*gs_open)(const char *, int, ...);                 /**< real open */
+static int (*gs_openat)(int, const char *, int, ...);          /**< real openat */
+static int (*gs_close)(int);                                   /**< real close */
+static int (*gs_ioctl)(int, unsigned long, ...);               /**< real ioctl */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;   /**< adapter lock */
+static uint16_t gs_bus[PRELOAD_MAX_FD];                        /**< bus + 1 of an emulated fd or 0 */
+static uint64_t gs_opens;                                      /**< emulated opens */
+static preload_stats_t gs_stats[PRELOAD_IOCTL_NUM];            /**< stats of every request kind */
+
+/**
+ * @brief preload ioctl name definition
+ */
+static const char *const gsc_name[PRELOAD_IOCTL_NUM] = {"I2C_RDWR", "I2C_SLAVE", "I2C_FUNCS", "other"};
+
+/**
+ * @brief fit the devices of the default bus
+ * @note  HDC2080_I2C_DEVICES is a comma separated list such as 0x40, an empty list leaves the bus empty
+ */
+static void a_preload_devices(void)
+{
+    const char *list;
+    char *end;
+    long addr;
+    
+    /* keep the default devices */
+    list = getenv(PRELOAD_DEVICES_ENV);
+    if (list == NULL)
+    {
+        return;
+    }
+    
+    /* replace them with the listed ones */
+    (void)sim_remove_device(SIM_DEFAULT_BUS, 0x40);
+    (void)sim_remove_device(SIM_DEFAULT_BUS, 0x41);
+    while (*list != '\0')
+    {
+        addr = strtol(list, &end, 0);
+        if (end == list)
+        {
+            break;
+        }
+        (void)sim_add_device(SIM_DEFAULT_BUS, (uint8_t)addr);
+        list = (*end == ',') ? end + 1 : end;
+    }
+}
+
+/**
+ * @brief resolve the real functions
+ * @note  it runs at the first intercepted call, which may come before the constructors of the program
+ */
+static void a_preload_resolve(void)
+{
+    gs_open = (int (*)(const char *, int, ...))dlsym(RTLD_NEXT, "open");
+    gs_openat = (int (*)(int, const char *, int, ...))dlsym(RTLD_NEXT, "openat");
+    gs_close = (int (*)(int))dlsym(RTLD_NEXT, "close");
+    gs_ioctl = (int (*)(int, unsigned long, ...))dlsym(RTLD_NEXT, "ioctl");
+    a_preload_devices();
+}
+
+/**
+ * @brief preload destructor
+ * @note  the report is json and goes to the file of HDC2080_I2C_REPORT or to stderr
+ */
+__attribute__((destructor)) static void a_preload_report(void)
+{
+    const char *path;
+    FILE *out;
+    uint32_t i;
+    
+    /* open the report */
+    path = getenv(PRELOAD_REPORT_ENV);
+    out = (path != NULL) ? fopen(path, "w") : stderr;
+    if (out == NULL)
+    {
+        out = stderr;
+    }
+    
+    /* one entry per request kind */
+    fprintf(out, "{\n  \"bench\": \"i2c_preload\",\n  \"opens\": %llu,\n  \"ioctls\": [", (unsigned long long)gs_opens);
+    for (i = 0; i < PRELOAD_IOCTL_NUM; i++)
+    {
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"calls\": %llu, \"errors\": %llu, \"messages\": %llu, "
+                "\"read_bytes\": %llu, \"write_bytes\": %llu, \"wall_ns_min\": %llu, \"wall_ns_avg\": %llu, "
+                "\"wall_ns_max\": %llu, \"bus_ns\": %llu}",
+                (i != 0) ? "," : "", gsc_name[i],
+                (unsigned long long)gs_stats[i].calls, (unsigned long long)gs_stats[i].errors,
+                (unsigned long long)gs_stats[i].messages, (unsigned long long)gs_stats[i].read_bytes,
+                (unsigned long long)gs_stats[i].write_bytes,
+                (unsigned long long)gs_stats[i].wall_min_ns,
+                (unsigned long long)((gs_stats[i].calls != 0) ? gs_stats[i].wall_ns / gs_stats[i].calls : 0),
+                (unsigned long long)gs_stats[i].wall_max_ns, (unsigned long long)gs_stats[i].bus_ns);
+    }
+    fprintf(out, "\n  ]\n}\n");
+    if (out != stderr)
+    {
+        (void)fclose(out);
+    }
+}
+
+/**
+ * @brief     get the monotonic time
+ * @return    time in ns
+ * @note      none
+ */
+static uint64_t a_preload_now_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     open an emulated device if the path is an i2c-dev node
+ * @param[in] *path pointer to a path
+ * @param[in] flags open flags
+ * @return    fd, -1 on error or -2 if the path is not emulated
+ * @note      the fd is a real /dev/null fd, so poll, dup and close keep working
+ */
+static int a_preload_open(const char *path, int flags)
+{
+    char *end;
+    long bus;
+    int fd;
+    
+    /* match /dev/i2c-<n> */
+    if ((path == NULL) || (strncmp(path, PRELOAD_DEVICE_PREFIX, strlen(PRELOAD_DEVICE_PREFIX)) != 0))
+    {
+        return -2;
+    }
+    bus = strtol(path + strlen(PRELOAD_DEVICE_PREFIX), &end, 10);
+    if ((*end != '\0') || (bus < 0) || (bus > 255))
+    {
+        return -2;
+    }
+    
+    /* back the fd by /dev/null */
+    fd = gs_open("/dev/null", O_RDWR | (flags & O_CLOEXEC));
+    if (fd < 0)
+    {
+        return -1;
+    }
+    if (fd >= PRELOAD_MAX_FD)
+    {
+        (void)gs_close(fd);
+        errno = EMFILE;
+        
+        return -1;
+    }
+    pthread_mutex_lock(&gs_mutex);
+    gs_bus[fd] = (uint16_t)(bus + 1);
+    gs_opens++;
+    pthread_mutex_unlock(&gs_mutex);
+    
+    return fd;
+}
+
+/**
+ * @brief     run the messages of one I2C_RDWR call on the model
+ * @param[in] bus bus number
+ * @param[in] *data pointer to the ioctl data
+ * @param[in] *stats pointer to the stats of the call
+ * @return    transferred messages or -1 with errno set
+ * @note      a write followed by a read of the same address is one repeated start transfer
+ */
+static int a_preload_rdwr(uint8_t bus, struct i2c_rdwr_ioctl_data *data, preload_stats_t *stats)
+{
+    struct i2c_msg *msg;
+    uint32_t i;
+    uint8_t res;
+    
+    /* check the data like the kernel */
+    if ((data == NULL) || (data->msgs == NULL) || (data->nmsgs == 0) || (data->nmsgs > I2C_RDWR_IOCTL_MAX_MSGS))
+    {
+        errno = EINVAL;
+        
+        return -1;
+    }
+    for (i = 0; i < data->nmsgs; i++)
+    {
+        if (((data->msgs[i].flags & I2C_M_TEN) != 0) || ((data->msgs[i].len != 0) && (data->msgs[i].buf == NULL)))
+        {
+            errno = EINVAL;
+            
+            return -1;
+        }
+    }
+    
+    /* transfer */
+    i = 0;
+    while (i < data->nmsgs)
+    {
+        msg = &data->msgs[i];
+        if (((msg->flags & I2C_M_RD) == 0) && (i + 1 < data->nmsgs) &&
+            ((data->msgs[i + 1].flags & I2C_M_RD) != 0) && (data->msgs[i + 1].addr == msg->addr))
+        {
+            res = sim_transfer(bus, (uint8_t)msg->addr, msg->buf, msg->len, data->msgs[i + 1].buf, data->msgs[i + 1].len);
+            stats->write_bytes += msg->len;
+            stats->read_bytes += data->msgs[i + 1].len;
+            i += 2;
+        }
+        else if ((msg->flags & I2C_M_RD) != 0)
+        {
+            res = sim_transfer(bus, (uint8_t)msg->addr, NULL, 0, msg->buf, msg->len);
+            stats->read_bytes += msg->len;
+            i++;
+        }
+        else
+        {
+            res = sim_transfer(bus, (uint8_t)msg->addr, msg->buf, msg->len, NULL, 0);
+            stats->write_bytes += msg->len;
+            i++;
+        }
+        if (res != 0)
+        {
+            errno = ENXIO;
+            
+            return -1;
+        }
+    }
+    stats->messages += data->nmsgs;
+    
+    return (int)data->nmsgs;
+}
+
+/**
+ * @brief     open
+ * @param[in] *path pointer to a path
+ * @param[in] flags open flags
+ * @return    fd or -1
+ * @note      none
+ */
+int open(const char *path, int flags, ...)
+{
+    va_list args;
+    mode_t mode = 0;
+    int fd;
+    
+    if ((flags & (O_CREAT | O_TMPFILE)) != 0)
+    {
+        va_start(args, flags);
+        mode = (mode_t)va_arg(args, int);
+        va_end(args);
+    }
+    if (gs_open == NULL)
+    {
+        a_preload_resolve();
+    }
+    fd = a_preload_open(path, flags);
+    
+    return (fd != -2) ? fd : gs_open(path, flags, mode);
+}
+
+/**
+ * @brief     open64
+ * @param[in] *path pointer to a path
+ * @param[in] flags open flags
+ * @return    fd or -1
+ * @note      none
+ */
+int open64(const char *path, int flags, ...)
+{
+    va_list args;
+    mode_t mode = 0;
+    int fd;
+    
+    if ((flags & (O_CREAT | O_TMPFILE)) != 0)
+    {
+        va_start(args, flags);
+        mode = (mode_t)va_arg(args, int);
+        va_end(args);
+    }
+    if (gs_open == NULL)
+    {
+        a_preload_resolve();
+    }
+    fd = a_preload_open(path, flags);
+    
+    return (fd != -2) ? fd : gs_open(path, flags | O_LARGEFILE, mode);
+}
+
+/**
+ * @brief     openat
+ * @param[in] dirfd directory fd
+ * @param[in] *path pointer to a path
+ * @param[in] flags open flags
+ * @return    fd or -1
+ * @note      only absolute i2c-dev paths are emulated
+ */
+int openat(int dirfd, const char *path, int flags, ...)
+{
+    va_list args;
+    mode_t mode = 0;
+    int fd;
+    
+    if ((flags & (O_CREAT | O_TMPFILE)) != 0)
+    {
+        va_start(args, flags);
+        mode = (mode_t)va_arg(args, int);
+        va_end(args);
+    }
+    if (gs_open == NULL)
+    {
+        a_preload_resolve();
+    }
+    fd = a_preload_open(path, flags);
+    
+    return (fd != -2) ? fd : gs_openat(dirfd, path, flags, mode);
+}
+
+/**
+ * @brief     close
+ * @param[in] fd file descriptor
+ * @return    0 or -1
+ * @note      none
+ */
+int close(int fd)
+{
+    if (gs_close == NULL)
+    {
+        a_preload_resolve();
+    }
+    if ((fd >= 0) && (fd < PRELOAD_MAX_FD))
+    {
+        pthread_mutex_lock(&gs_mutex);
+        gs_bus[fd] = 0;
+        pthread_mutex_unlock(&gs_mutex);
+    }
+    
+    return gs_close(fd);
+}
+
+/**
+ * @brief     ioctl
+ * @param[in] fd file descriptor
+ * @param[in] request ioctl request
+ * @return    request result or -1
+ * @note      I2C_RDWR, I2C_SLAVE, I2C_SLAVE_FORCE, I2C_FUNCS, I2C_TIMEOUT and I2C_RETRIES are emulated
+ */
+int ioctl(int fd, unsigned long request, ...)
+{
+    va_list args;
+    void *arg;
+    preload_stats_t call;
+    sim_stats_t before;
+    sim_stats_t after;
+    preload_ioctl_t kind;
+    uint64_t start;
+    uint64_t ns;
+    uint16_t bus;
+    int res;
+    int err;
+    
+    va_start(args, request);
+    arg = va_arg(args, void *);
+    va_end(args);
+    
+    /* pass the other fds through */
+    if (gs_ioctl == NULL)
+    {
+        a_preload_resolve();
+    }
+    bus = ((fd >= 0) && (fd < PRELOAD_MAX_FD)) ? gs_bus[fd] : 0;
+    if (bus == 0)
+    {
+        return gs_ioctl(fd, request, arg);
+    }
+    
+    /* the adapter lock serializes the calls like the kernel */
+    pthread_mutex_lock(&gs_mutex);
+    memset(&call, 0, sizeof(call));
+    start = a_preload_now_ns();
+    sim_get_stats(&before);
+    switch (request)
+    {
+        case I2C_RDWR :
+        {
+            kind = PRELOAD_IOCTL_RDWR;
+            res = a_preload_rdwr((uint8_t)(bus - 1), (struct i2c_rdwr_ioctl_data *)arg, &call);
+            
+            break;
+        }
+        case I2C_SLAVE :
+        case I2C_SLAVE_FORCE :
+        {
+            kind = PRELOAD_IOCTL_SLAVE;
+            if ((unsigned long)arg > 0x7F)
+            {
+                errno = EINVAL;
+                res = -1;
+            }
+            else
+            {
+                res = 0;
+            }
+            
+            break;
+        }
+        case I2C_FUNCS :
+        {
+            kind = PRELOAD_IOCTL_FUNCS;
+            *(unsigned long *)arg = I2C_FUNC_I2C;
+            res = 0;
+            
+            break;
+        }
+        case I2C_TIMEOUT :
+        case I2C_RETRIES :
+        {
+            kind = PRELOAD_IOCTL_OTHER;
+            res = 0;
+            
+            break;
+        }
+        default :
+        {
+            kind = PRELOAD_IOCTL_OTHER;
+            errno = ENOTTY;
+            res = -1;
+            
+            break;
+        }
+    }
+    err = errno;
+    sim_get_stats(&after);
+    ns = a_preload_now_ns() - start;
+    
+    /* account the call */
+    gs_stats[kind].calls++;
+    gs_stats[kind].errors += (res < 0) ? 1 : 0;
+    gs_stats[kind].messages += call.messages;
+    gs_stats[kind].read_bytes += call.read_bytes;
+    gs_stats[kind].write_bytes += call.write_bytes;
+    gs_stats[kind].wall_ns += ns;
+    gs_stats[kind].wall_min_ns = ((gs_stats[kind].calls == 1) || (ns < gs_stats[kind].wall_min_ns)) ? ns : gs_stats[kind].wall_min_ns;
+    gs_stats[kind].wall_max_ns = (ns > gs_stats[kind].wall_max_ns) ? ns : gs_stats[kind].wall_max_ns;
+    gs_stats[kind].bus_ns += after.bus_ns - before.bus_ns;
+    pthread_mutex_unlock(&gs_mutex);
+    errno = err;
+    
+    return res;
+}
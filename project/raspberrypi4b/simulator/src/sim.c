@@ -0,0 +1,882 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim.c
+ * @brief     sim source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "sim.h"
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief register definition
+ */
+#define SIM_REG_TEMPERATURE_LOW        0x00        /**< temperature low register */
+#define SIM_REG_HUMIDITY_LOW           0x02        /**< humidity low register */
+#define SIM_REG_STATUS                 0x04        /**< interrupt drdy register */
+#define SIM_REG_TEMPERATURE_MAX        0x05        /**< temperature max register */
+#define SIM_REG_HUMIDITY_MAX           0x06        /**< humidity max register */
+#define SIM_REG_INTERRUPT_ENABLE       0x07        /**< interrupt enable register */
+#define SIM_REG_TEMP_OFFSET_ADJUST     0x08        /**< temp offset adjust register */
+#define SIM_REG_HUM_OFFSET_ADJUST      0x09        /**< hum offset adjust register */
+#define SIM_REG_TEMP_THR_L             0x0A        /**< temp thr low register */
+#define SIM_REG_TEMP_THR_H             0x0B        /**< temp thr high register */
+#define SIM_REG_RH_THR_L               0x0C        /**< rh thr low register */
+#define SIM_REG_RH_THR_H               0x0D        /**< rh thr high register */
+#define SIM_REG_CONF                   0x0E        /**< conf register */
+#define SIM_REG_MEASUREMENT            0x0F        /**< measurement register */
+
+/**
+ * @brief sim device structure definition
+ */
+typedef struct sim_device_s
+{
+    uint8_t used;                 /**< used flag */
+    uint8_t bus;                  /**< bus number */
+    uint8_t addr;                 /**< 7 bits address */
+    uint8_t reg[256];             /**< register file */
+    uint8_t pointer;              /**< register pointer */
+    uint8_t converting;           /**< conversion in progress */
+    uint64_t done_ns;             /**< conversion end time */
+    uint8_t auto_running;         /**< auto measurement running */
+    uint64_t next_auto_ns;        /**< next auto measurement time */
+    float temperature;            /**< ambient temperature */
+    float humidity;               /**< ambient humidity */
+    float temperature_sigma;      /**< temperature noise */
+    float humidity_sigma;         /**< humidity noise */
+    uint32_t seed;                /**< noise state */
+} sim_device_t;
+
+/**
+ * @brief sim world structure definition
+ */
+typedef struct sim_world_s
+{
+    uint8_t inited;                          /**< inited flag */
+    uint64_t now_ns;                         /**< virtual clock */
+    uint64_t real_origin_ns;                 /**< monotonic time of the init */
+    uint32_t bus_hz;                         /**< bus speed */
+    sim_stats_t stats;                       /**< statistics */
+    sim_device_t dev[SIM_MAX_DEVICES];       /**< devices */
+} sim_world_t;
+
+static sim_world_t gs_world;                                          /**< simulated world */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;          /**< world lock */
+
+/**
+ * @brief temperature conversion time definition
+ */
+static const uint32_t gsc_temperature_ns[4] = {610000, 350000, 225000, 225000};
+
+/**
+ * @brief humidity conversion time definition
+ */
+static const uint32_t gsc_humidity_ns[4] = {660000, 400000, 275000, 275000};
+
+/**
+ * @brief auto measurement period definition
+ */
+static const uint64_t gsc_auto_period_ns[8] =
+{
+    0ULL, 120000000000ULL, 60000000000ULL, 10000000000ULL,
+    5000000000ULL, 1000000000ULL, 500000000ULL, 200000000ULL,
+};
+
+/**
+ * @brief     reset the device registers
+ * @param[in] *dev pointer to a device
+ * @note      none
+ */
+static void a_sim_device_reset(sim_device_t *dev)
+{
+    /* clear data, status and config */
+    memset(dev->reg, 0, 0x10);
+    
+    /* threshold defaults */
+    dev->reg[SIM_REG_TEMP_THR_L] = 0x01;
+    dev->reg[SIM_REG_TEMP_THR_H] = 0xFF;
+    dev->reg[SIM_REG_RH_THR_L] = 0x00;
+    dev->reg[SIM_REG_RH_THR_H] = 0xFF;
+    
+    /* id registers */
+    dev->reg[0xFC] = 0x49;
+    dev->reg[0xFD] = 0x54;
+    dev->reg[0xFE] = 0xD0;
+    dev->reg[0xFF] = 0x07;
+    
+    /* stop the measurement */
+    dev->converting = 0;
+    dev->auto_running = 0;
+}
+
+/**
+ * @brief     find a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits address
+ * @return    pointer to a device or NULL
+ * @note      none
+ */
+static sim_device_t *a_sim_find(uint8_t bus, uint8_t addr)
+{
+    uint32_t i;
+    
+    for (i = 0; i < SIM_MAX_DEVICES; i++)
+    {
+        if ((gs_world.dev[i].used != 0) && (gs_world.dev[i].bus == bus) && (gs_world.dev[i].addr == addr))
+        {
+            return &gs_world.dev[i];
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     add a device without lock
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits address
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      none
+ */
+static uint8_t a_sim_add(uint8_t bus, uint8_t addr)
+{
+    uint32_t i;
+    
+    /* check the address */
+    if ((addr > 0x7F) || (a_sim_find(bus, addr) != NULL))
+    {
+        return 1;
+    }
+    
+    /* find a free slot */
+    for (i = 0; i < SIM_MAX_DEVICES; i++)
+    {
+        if (gs_world.dev[i].used == 0)
+        {
+            memset(&gs_world.dev[i], 0, sizeof(sim_device_t));
+            gs_world.dev[i].used = 1;
+            gs_world.dev[i].bus = bus;
+            gs_world.dev[i].addr = addr;
+            gs_world.dev[i].temperature = 25.0f;
+            gs_world.dev[i].humidity = 50.0f;
+            gs_world.dev[i].seed = 1;
+            a_sim_device_reset(&gs_world.dev[i]);
+            
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief  init the world without lock
+ * @note   none
+ */
+static void a_sim_init(void)
+{
+    struct timespec ts;
+    
+    memset(&gs_world, 0, sizeof(sim_world_t));
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    gs_world.real_origin_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    gs_world.bus_hz = 400000;
+    gs_world.inited = 1;
+    (void)a_sim_add(SIM_DEFAULT_BUS, 0x40);
+    (void)a_sim_add(SIM_DEFAULT_BUS, 0x41);
+}
+
+/**
+ * @brief  lock the world
+ * @note   the world is initialized at the first use
+ */
+static void a_sim_lock(void)
+{
+    struct timespec ts;
+    uint64_t real_ns;
+    
+    pthread_mutex_lock(&gs_mutex);
+    if (gs_world.inited == 0)
+    {
+        a_sim_init();
+    }
+    
+    /* the virtual clock never falls behind the real time, so real sleeps let the devices run too */
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    real_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec - gs_world.real_origin_ns;
+    if (real_ns > gs_world.now_ns)
+    {
+        gs_world.now_ns = real_ns;
+    }
+}
+
+/**
+ * @brief  unlock the world
+ * @note   none
+ */
+static void a_sim_unlock(void)
+{
+    pthread_mutex_unlock(&gs_mutex);
+}
+
+/**
+ * @brief         get a gaussian noise sample
+ * @param[in,out] *seed pointer to a noise state
+ * @return        standard normal sample
+ * @note          xorshift32 with box muller
+ */
+static float a_sim_gauss(uint32_t *seed)
+{
+    uint32_t x;
+    float u1;
+    float u2;
+    
+    x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    u1 = ((float)(x >> 8) + 1.0f) / 16777217.0f;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    u2 = (float)(x >> 8) / 16777216.0f;
+    *seed = x;
+    
+    return sqrtf(-2.0f * logf(u1)) * cosf(6.2831853f * u2);
+}
+
+/**
+ * @brief     convert a physical value to a raw word
+ * @param[in] value scaled value in the range 0.0 - 1.0
+ * @param[in] resolution resolution bits
+ * @return    raw word
+ * @note      the unused low bits are cleared
+ */
+static uint16_t a_sim_quantize(float value, uint8_t resolution)
+{
+    const uint16_t mask[4] = {0xFFFC, 0xFFE0, 0xFF80, 0xFF80};
+    float raw;
+    
+    raw = value * 65536.0f;
+    if (raw < 0.0f)
+    {
+        raw = 0.0f;
+    }
+    if (raw > 65535.0f)
+    {
+        raw = 65535.0f;
+    }
+    
+    return (uint16_t)raw & mask[resolution & 0x03];
+}
+
+/**
+ * @brief     get the conversion time
+ * @param[in] *dev pointer to a device
+ * @return    conversion time in ns
+ * @note      none
+ */
+static uint64_t a_sim_conversion_ns(sim_device_t *dev)
+{
+    uint8_t meas;
+    uint64_t ns;
+    
+    meas = dev->reg[SIM_REG_MEASUREMENT];
+    ns = gsc_temperature_ns[(meas >> 6) & 0x03];
+    if (((meas >> 1) & 0x03) == 0)
+    {
+        ns += gsc_humidity_ns[(meas >> 4) & 0x03];
+    }
+    
+    return ns;
+}
+
+/**
+ * @brief     finish a conversion
+ * @param[in] *dev pointer to a device
+ * @note      data, max, status and trigger registers are updated
+ */
+static void a_sim_measure(sim_device_t *dev)
+{
+    uint8_t meas;
+    uint8_t conf;
+    uint8_t status;
+    uint8_t t_msb;
+    uint8_t h_msb;
+    uint16_t raw;
+    float t;
+    float h;
+    
+    meas = dev->reg[SIM_REG_MEASUREMENT];
+    conf = dev->reg[SIM_REG_CONF];
+    
+    /* temperature with offset and noise */
+    t = dev->temperature + (float)((int8_t)dev->reg[SIM_REG_TEMP_OFFSET_ADJUST]) * 0.16f;
+    if (dev->temperature_sigma > 0.0f)
+    {
+        t += a_sim_gauss(&dev->seed) * dev->temperature_sigma;
+    }
+    raw = a_sim_quantize((t + 40.5f) / 165.0f, (meas >> 6) & 0x03);
+    dev->reg[SIM_REG_TEMPERATURE_LOW] = raw & 0xFF;
+    dev->reg[SIM_REG_TEMPERATURE_LOW + 1] = raw >> 8;
+    t_msb = raw >> 8;
+    if (t_msb > dev->reg[SIM_REG_TEMPERATURE_MAX])
+    {
+        dev->reg[SIM_REG_TEMPERATURE_MAX] = t_msb;
+    }
+    
+    /* humidity with offset and noise */
+    h_msb = dev->reg[SIM_REG_HUMIDITY_LOW + 1];
+    if (((meas >> 1) & 0x03) == 0)
+    {
+        h = dev->humidity + (float)((int8_t)dev->reg[SIM_REG_HUM_OFFSET_ADJUST]) * 0.2f;
+        if (dev->humidity_sigma > 0.0f)
+        {
+            h += a_sim_gauss(&dev->seed) * dev->humidity_sigma;
+        }
+        raw = a_sim_quantize(h / 100.0f, (meas >> 4) & 0x03);
+        dev->reg[SIM_REG_HUMIDITY_LOW] = raw & 0xFF;
+        dev->reg[SIM_REG_HUMIDITY_LOW + 1] = raw >> 8;
+        h_msb = raw >> 8;
+        if (h_msb > dev->reg[SIM_REG_HUMIDITY_MAX])
+        {
+            dev->reg[SIM_REG_HUMIDITY_MAX] = h_msb;
+        }
+    }
+    
+    /* threshold comparators */
+    status = 0;
+    if (t_msb > dev->reg[SIM_REG_TEMP_THR_H])
+    {
+        status |= 1 << 6;
+    }
+    if (t_msb < dev->reg[SIM_REG_TEMP_THR_L])
+    {
+        status |= 1 << 5;
+    }
+    if (h_msb > dev->reg[SIM_REG_RH_THR_H])
+    {
+        status |= 1 << 4;
+    }
+    if (h_msb < dev->reg[SIM_REG_RH_THR_L])
+    {
+        status |= 1 << 3;
+    }
+    
+    /* comparator mode follows the condition, level mode latches it */
+    if ((conf & 0x01) != 0)
+    {
+        dev->reg[SIM_REG_STATUS] = (dev->reg[SIM_REG_STATUS] & 0x80) | status;
+    }
+    else
+    {
+        dev->reg[SIM_REG_STATUS] |= status;
+    }
+    
+    /* data ready */
+    dev->reg[SIM_REG_STATUS] |= 1 << 7;
+    
+    /* trigger bit self clears */
+    dev->reg[SIM_REG_MEASUREMENT] &= ~(1 << 0);
+    dev->converting = 0;
+    gs_world.stats.conversions++;
+}
+
+/**
+ * @brief     run the device until the virtual clock
+ * @param[in] *dev pointer to a device
+ * @note      conversions and auto measurements are processed in time order
+ */
+static void a_sim_update(sim_device_t *dev)
+{
+    uint64_t period;
+    
+    while (1)
+    {
+        if ((dev->converting != 0) && (dev->done_ns <= gs_world.now_ns) &&
+            ((dev->auto_running == 0) || (dev->done_ns <= dev->next_auto_ns)))
+        {
+            /* conversion done */
+            a_sim_measure(dev);
+        }
+        else if ((dev->auto_running != 0) && (dev->next_auto_ns <= gs_world.now_ns))
+        {
+            /* start the next auto conversion */
+            period = gsc_auto_period_ns[(dev->reg[SIM_REG_CONF] >> 4) & 0x07];
+            dev->converting = 1;
+            dev->done_ns = dev->next_auto_ns + a_sim_conversion_ns(dev);
+            dev->next_auto_ns += period;
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     write a register
+ * @param[in] *dev pointer to a device
+ * @param[in] reg register address
+ * @param[in] value written value
+ * @note      read only registers ignore the write
+ */
+static void a_sim_write_reg(sim_device_t *dev, uint8_t reg, uint8_t value)
+{
+    uint8_t amm;
+    
+    if ((reg < SIM_REG_TEMPERATURE_MAX) || (reg > SIM_REG_MEASUREMENT))
+    {
+        return;
+    }
+    if (reg == SIM_REG_CONF)
+    {
+        /* soft reset */
+        if ((value & 0x80) != 0)
+        {
+            a_sim_device_reset(dev);
+            
+            return;
+        }
+        amm = (value >> 4) & 0x07;
+        dev->reg[reg] = value;
+        if (amm == 0)
+        {
+            /* stop auto measurement */
+            dev->auto_running = 0;
+        }
+        else if (dev->auto_running != 0)
+        {
+            /* follow the new period */
+            dev->next_auto_ns = gs_world.now_ns + gsc_auto_period_ns[amm];
+        }
+        else
+        {
+            
+        }
+        
+        return;
+    }
+    if (reg == SIM_REG_MEASUREMENT)
+    {
+        dev->reg[reg] = value;
+        if (((value & 0x01) != 0) && (dev->converting == 0))
+        {
+            /* start the conversion */
+            dev->converting = 1;
+            dev->done_ns = gs_world.now_ns + a_sim_conversion_ns(dev);
+            amm = (dev->reg[SIM_REG_CONF] >> 4) & 0x07;
+            if (amm != 0)
+            {
+                dev->auto_running = 1;
+                dev->next_auto_ns = gs_world.now_ns + gsc_auto_period_ns[amm];
+            }
+        }
+        
+        return;
+    }
+    dev->reg[reg] = value;
+}
+
+/**
+ * @brief     advance the clock by the bus time
+ * @param[in] bits bus bits
+ * @note      none
+ */
+static void a_sim_bus_time(uint64_t bits)
+{
+    uint64_t ns;
+    
+    ns = bits * 1000000000ULL / gs_world.bus_hz;
+    gs_world.now_ns += ns;
+    gs_world.stats.bus_ns += ns;
+}
+
+/**
+ * @brief  sim init
+ * @return status code
+ *         - 0 success
+ * @note   the clock is set to 0 and two devices are added on the default bus at 0x40 and 0x41,
+ *         every other api calls it once automatically, the clock never falls behind the real time since the init
+ */
+uint8_t sim_init(void)
+{
+    pthread_mutex_lock(&gs_mutex);
+    a_sim_init();
+    pthread_mutex_unlock(&gs_mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief  sim deinit
+ * @return status code
+ *         - 0 success
+ * @note   all devices are removed
+ */
+uint8_t sim_deinit(void)
+{
+    a_sim_lock();
+    memset(gs_world.dev, 0, sizeof(gs_world.dev));
+    a_sim_unlock();
+    
+    return 0;
+}
+
+/**
+ * @brief     add a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits iic address
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the device starts with the power on register values, 25C and 50%
+ */
+uint8_t sim_add_device(uint8_t bus, uint8_t addr)
+{
+    uint8_t res;
+    
+    a_sim_lock();
+    res = a_sim_add(bus, addr);
+    a_sim_unlock();
+    
+    return res;
+}
+
+/**
+ * @brief     remove a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits iic address
+ * @return    status code
+ *            - 0 success
+ *            - 1 remove failed
+ * @note      none
+ */
+uint8_t sim_remove_device(uint8_t bus, uint8_t addr)
+{
+    sim_device_t *dev;
+    
+    a_sim_lock();
+    dev = a_sim_find(bus, addr);
+    if (dev != NULL)
+    {
+        dev->used = 0;
+    }
+    a_sim_unlock();
+    
+    return (dev != NULL) ? 0 : 1;
+}
+
+/**
+ * @brief     set the environment of a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits iic address
+ * @param[in] temperature ambient temperature in degrees
+ * @param[in] humidity ambient humidity in percent
+ * @return    status code
+ *            - 0 success
+ *            - 1 no device
+ * @note      none
+ */
+uint8_t sim_set_environment(uint8_t bus, uint8_t addr, float temperature, float humidity)
+{
+    sim_device_t *dev;
+    
+    a_sim_lock();
+    dev = a_sim_find(bus, addr);
+    if (dev != NULL)
+    {
+        /* finish the pending work with the old values */
+        a_sim_update(dev);
+        dev->temperature = temperature;
+        dev->humidity = humidity;
+    }
+    a_sim_unlock();
+    
+    return (dev != NULL) ? 0 : 1;
+}
+
+/**
+ * @brief     set the measurement noise of a device
+ * @param[in] bus bus number
+ * @param[in] addr 7 bits iic address
+ * @param[in] temperature_sigma temperature noise standard deviation in degrees
+ * @param[in] humidity_sigma humidity noise standard deviation in percent
+ * @param[in] seed noise seed
+ * @return    status code
+ *            - 0 success
+ *            - 1 no device
+ * @note      the noise is gaussian and reproducible for the same seed
+ */
+uint8_t sim_set_noise(uint8_t bus, uint8_t addr, float temperature_sigma, float humidity_sigma, uint32_t seed)
+{
+    sim_device_t *dev;
+    
+    a_sim_lock();
+    dev = a_sim_find(bus, addr);
+    if (dev != NULL)
+    {
+        a_sim_update(dev);
+        dev->temperature_sigma = temperature_sigma;
+        dev->humidity_sigma = humidity_sigma;
+        dev->seed = (seed != 0) ? seed : 1;
+    }
+    a_sim_unlock();
+    
+    return (dev != NULL) ? 0 : 1;
+}
+
+/**
+ * @brief     set the bus speed
+ * @param[in] hz bus clock
+ * @return    status code
+ *            - 0 success
+ *            - 1 hz is invalid
+ * @note      default is 400khz, every bit costs 1 / hz of virtual time
+ */
+uint8_t sim_set_bus_speed(uint32_t hz)
+{
+    if (hz == 0)
+    {
+        return 1;
+    }
+    a_sim_lock();
+    gs_world.bus_hz = hz;
+    a_sim_unlock();
+    
+    return 0;
+}
+
+/**
+ * @brief  get the virtual clock
+ * @return virtual time in ns
+ * @note   none
+ */
+uint64_t sim_get_time_ns(void)
+{
+    uint64_t ns;
+    
+    a_sim_lock();
+    ns = gs_world.now_ns;
+    a_sim_unlock();
+    
+    return ns;
+}
+
+/**
+ * @brief     advance the virtual clock
+ * @param[in] ns time to advance
+ * @note      it is counted as a delay in the statistics
+ */
+void sim_delay_ns(uint64_t ns)
+{
+    a_sim_lock();
+    gs_world.now_ns += ns;
+    gs_world.stats.delay_ns += ns;
+    gs_world.stats.delays++;
+    a_sim_unlock();
+}
+
+/**
+ * @brief      run one bus transaction
+ * @param[in]  bus bus number
+ * @param[in]  addr 7 bits iic address
+ * @param[in]  *wbuf pointer to a write buffer, the first byte is the register pointer
+ * @param[in]  wlen write length, 0 skips the write message
+ * @param[out] *rbuf pointer to a read buffer
+ * @param[in]  rlen read length, 0 skips the read message
+ * @return     status code
+ *             - 0 success
+ *             - 1 nack
+ * @note       a write followed by a read uses a repeated start, reads auto increment the register pointer
+ */
+uint8_t sim_transfer(uint8_t bus, uint8_t addr, const uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    sim_device_t *dev;
+    uint16_t i;
+    uint8_t clear_status;
+    
+    a_sim_lock();
+    gs_world.stats.transactions++;
+    dev = a_sim_find(bus, addr);
+    if (dev == NULL)
+    {
+        /* start, address and nack, stop */
+        a_sim_bus_time(1 + 9 + 1);
+        gs_world.stats.messages++;
+        gs_world.stats.nacks++;
+        a_sim_unlock();
+        
+        return 1;
+    }
+    
+    /* write message */
+    if (wlen != 0)
+    {
+        a_sim_bus_time(1 + 9 * (1 + (uint64_t)wlen));
+        gs_world.stats.messages++;
+        gs_world.stats.write_bytes += wlen;
+        a_sim_update(dev);
+        dev->pointer = wbuf[0];
+        for (i = 1; i < wlen; i++)
+        {
+            a_sim_write_reg(dev, dev->pointer, wbuf[i]);
+            dev->pointer++;
+        }
+    }
+    
+    /* read message */
+    if (rlen != 0)
+    {
+        a_sim_bus_time(1 + 9 * (1 + (uint64_t)rlen));
+        gs_world.stats.messages++;
+        gs_world.stats.read_bytes += rlen;
+        a_sim_update(dev);
+        clear_status = 0;
+        for (i = 0; i < rlen; i++)
+        {
+            if (dev->pointer == SIM_REG_STATUS)
+            {
+                clear_status = 1;
+            }
+            rbuf[i] = dev->reg[dev->pointer];
+            dev->pointer++;
+        }
+        
+        /* the status register clears on read */
+        if (clear_status != 0)
+        {
+            dev->reg[SIM_REG_STATUS] = 0;
+        }
+    }
+    
+    /* stop */
+    a_sim_bus_time(1);
+    a_sim_unlock();
+    
+    return 0;
+}
+
+/**
+ * @brief      get the interrupt pin level of a device
+ * @param[in]  bus bus number
+ * @param[in]  addr 7 bits iic address
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no device
+ * @note       a disabled pin is high impedance and reads as 1 with the pull up
+ */
+uint8_t sim_get_int_pin(uint8_t bus, uint8_t addr, uint8_t *level)
+{
+    sim_device_t *dev;
+    uint8_t conf;
+    uint8_t active;
+    
+    a_sim_lock();
+    dev = a_sim_find(bus, addr);
+    if (dev == NULL)
+    {
+        a_sim_unlock();
+        
+        return 1;
+    }
+    a_sim_update(dev);
+    conf = dev->reg[SIM_REG_CONF];
+    if ((conf & (1 << 2)) == 0)
+    {
+        *level = 1;
+    }
+    else
+    {
+        active = ((dev->reg[SIM_REG_STATUS] & dev->reg[SIM_REG_INTERRUPT_ENABLE] & 0xF8) != 0) ? 1 : 0;
+        *level = ((conf & (1 << 1)) != 0) ? active : (uint8_t)!active;
+    }
+    a_sim_unlock();
+    
+    return 0;
+}
+
+/**
+ * @brief      read a register without bus access
+ * @param[in]  bus bus number
+ * @param[in]  addr 7 bits iic address
+ * @param[in]  reg register address
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no device
+ * @note       no side effects, status flags are not cleared
+ */
+uint8_t sim_peek(uint8_t bus, uint8_t addr, uint8_t reg, uint8_t *value)
+{
+    sim_device_t *dev;
+    
+    a_sim_lock();
+    dev = a_sim_find(bus, addr);
+    if (dev != NULL)
+    {
+        a_sim_update(dev);
+        *value = dev->reg[reg];
+    }
+    a_sim_unlock();
+    
+    return (dev != NULL) ? 0 : 1;
+}
+
+/**
+ * @brief      get the statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @note       none
+ */
+void sim_get_stats(sim_stats_t *stats)
+{
+    a_sim_lock();
+    *stats = gs_world.stats;
+    a_sim_unlock();
+}
+
+/**
+ * @brief  reset the statistics
+ * @note   none
+ */
+void sim_reset_stats(void)
+{
+    a_sim_lock();
+    memset(&gs_world.stats, 0, sizeof(sim_stats_t));
+    a_sim_unlock();
+}
@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim_gpio.c
+ * @brief     sim gpio source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "gpio.h"
+#include "sim.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief sim gpio definition
+ */
+#define SIM_GPIO_TICK_NS        100000        /**< 100us line sample period */
+#define SIM_GPIO_QUEUE          16            /**< queued edge times */
+
+static pthread_t gs_thread;                                         /**< line thread */
+static uint32_t gs_running = 0;                                     /**< running flag */
+static gpio_edge_t gs_edge;                                         /**< interrupt edge */
+static int gs_event_fd = -1;                                        /**< edge event fd */
+static int gs_epoll_fd = -1;                                        /**< epoll fd */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;        /**< queue lock */
+static uint64_t gs_queue[SIM_GPIO_QUEUE];                           /**< edge time queue */
+static uint32_t gs_head = 0;                                        /**< queue head */
+static uint32_t gs_tail = 0;                                        /**< queue tail */
+
+/**
+ * @brief  get the simulated line level
+ * @return line level
+ * @note   the line follows the first device with its interrupt pin enabled and is pulled up otherwise
+ */
+static uint8_t a_sim_gpio_level(void)
+{
+    uint8_t addr;
+    uint8_t conf;
+    uint8_t level;
+    
+    for (addr = 0x40; addr <= 0x41; addr++)
+    {
+        if ((sim_peek(SIM_DEFAULT_BUS, addr, 0x0E, &conf) == 0) && ((conf & (1 << 2)) != 0))
+        {
+            if (sim_get_int_pin(SIM_DEFAULT_BUS, addr, &level) == 0)
+            {
+                return level;
+            }
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     simulated line thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      the virtual clock follows the real time, so the line is sampled every tick
+ */
+static void *a_sim_gpio_thread(void *arg)
+{
+    uint8_t last;
+    uint8_t level;
+    uint64_t one = 1;
+    struct timespec next;
+    struct timespec now;
+    
+    (void)arg;
+    (void)clock_gettime(CLOCK_MONOTONIC, &next);
+    last = a_sim_gpio_level();
+    while (__atomic_load_n(&gs_running, __ATOMIC_ACQUIRE) != 0)
+    {
+        /* sleep one tick, the devices run for the same time */
+        next.tv_nsec += SIM_GPIO_TICK_NS;
+        if (next.tv_nsec >= 1000000000L)
+        {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000L;
+        }
+        (void)clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        
+        /* stamp the requested edge and wake the waiter */
+        level = a_sim_gpio_level();
+        if ((level != last) && ((level != 0) == (gs_edge == GPIO_EDGE_RISING)))
+        {
+            (void)clock_gettime(CLOCK_MONOTONIC, &now);
+            pthread_mutex_lock(&gs_mutex);
+            if (gs_head - gs_tail < SIM_GPIO_QUEUE)
+            {
+                gs_queue[gs_head % SIM_GPIO_QUEUE] = (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+                gs_head++;
+                if (write(gs_event_fd, &one, sizeof(one)) != sizeof(one))
+                {
+                    gs_head--;
+                }
+            }
+            pthread_mutex_unlock(&gs_mutex);
+        }
+        last = level;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     gpio interrupt init
+ * @param[in] edge interrupt edge
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the edges of the simulated line are signalled through an eventfd in an epoll set
+ */
+uint8_t gpio_interrupt_init(gpio_edge_t edge)
+{
+    struct epoll_event event;
+    
+    /* one read per edge */
+    gs_event_fd = eventfd(0, EFD_CLOEXEC | EFD_SEMAPHORE);
+    if (gs_event_fd < 0)
+    {
+        perror("gpio: create eventfd failed.\n");
+        
+        return 1;
+    }
+    
+    /* add the event fd to the epoll set */
+    gs_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (gs_epoll_fd < 0)
+    {
+        perror("gpio: create epoll failed.\n");
+        (void)close(gs_event_fd);
+        
+        return 1;
+    }
+    event.events = EPOLLIN;
+    event.data.fd = gs_event_fd;
+    if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, gs_event_fd, &event) < 0)
+    {
+        perror("gpio: add epoll failed.\n");
+        (void)close(gs_epoll_fd);
+        (void)close(gs_event_fd);
+        gs_epoll_fd = -1;
+        
+        return 1;
+    }
+    
+    /* start the line */
+    gs_edge = edge;
+    gs_head = 0;
+    gs_tail = 0;
+    __atomic_store_n(&gs_running, 1, __ATOMIC_RELEASE);
+    if (pthread_create(&gs_thread, NULL, a_sim_gpio_thread, NULL) != 0)
+    {
+        perror("gpio: create thread failed.\n");
+        (void)close(gs_epoll_fd);
+        (void)close(gs_event_fd);
+        gs_epoll_fd = -1;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  gpio interrupt deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_interrupt_deinit(void)
+{
+    /* check the init */
+    if (gs_epoll_fd < 0)
+    {
+        return 1;
+    }
+    
+    /* stop the line and close all */
+    __atomic_store_n(&gs_running, 0, __ATOMIC_RELEASE);
+    (void)pthread_join(gs_thread, NULL);
+    (void)close(gs_epoll_fd);
+    (void)close(gs_event_fd);
+    gs_epoll_fd = -1;
+    
+    return 0;
+}
+
+/**
+ * @brief      wait for an interrupt edge
+ * @param[in]  timeout_ms timeout in ms, -1 waits forever
+ * @param[out] *timestamp_ns pointer to an edge time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ *             - 4 timeout
+ * @note       the thread sleeps in epoll_wait, the edge time is on the CLOCK_MONOTONIC scale
+ */
+uint8_t gpio_interrupt_wait(int32_t timeout_ms, uint64_t *timestamp_ns)
+{
+    int res;
+    uint64_t count;
+    struct epoll_event event;
+    
+    /* sleep until an edge, a signal restarts the wait */
+    do
+    {
+        res = epoll_wait(gs_epoll_fd, &event, 1, timeout_ms);
+    } while ((res < 0) && (errno == EINTR));
+    if (res < 0)
+    {
+        perror("gpio: epoll wait failed.\n");
+        
+        return 1;
+    }
+    if (res == 0)
+    {
+        return 4;
+    }
+    
+    /* take one edge */
+    if (read(gs_event_fd, &count, sizeof(count)) != sizeof(count))
+    {
+        perror("gpio: read eventfd failed.\n");
+        
+        return 1;
+    }
+    pthread_mutex_lock(&gs_mutex);
+    *timestamp_ns = gs_queue[gs_tail % SIM_GPIO_QUEUE];
+    gs_tail++;
+    pthread_mutex_unlock(&gs_mutex);
+    
+    return 0;
+}
@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      simulator_driver_hdc2080_interface.c
+ * @brief     simulator driver hdc2080 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_interface.h"
+#include "sim.h"
+#include "iic_lock.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief simulator bus definition
+ */
+#define SIM_BUS             SIM_DEFAULT_BUS        /**< simulated iic bus */
+#define SIM_BUS_NAME        "/dev/i2c-1"           /**< simulated iic bus name */
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   the simulated devices keep their state between init and deinit like a powered chip
+ */
+uint8_t hdc2080_interface_iic_init(void)
+{
+    /* the bus lock must exist before the driver locks the bus */
+    return iic_lock_reserve(SIM_BUS_NAME);
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 iic deinit failed
+ * @note   none
+ */
+uint8_t hdc2080_interface_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t hdc2080_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t tmp[257];
+    
+    if (len > 256)
+    {
+        return 1;
+    }
+    tmp[0] = reg;
+    memcpy(&tmp[1], buf, len);
+    
+    return sim_transfer(SIM_BUS, addr >> 1, tmp, len + 1, NULL, 0);
+}
+
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t hdc2080_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return sim_transfer(SIM_BUS, addr >> 1, &reg, 1, buf, len);
+}
+
+/**
+ * @brief         interface iic bus init with a bus context
+ * @param[in,out] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 iic init failed
+ * @note          the simulated bus number is the trailing number of the context name such as /dev/i2c-1
+ */
+uint8_t hdc2080_interface_iic_init_ctx(void *ctx)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    const char *p;
+    
+    /* find the trailing number */
+    p = bus->name + strlen(bus->name);
+    while ((p > bus->name) && (p[-1] >= '0') && (p[-1] <= '9'))
+    {
+        p--;
+    }
+    if (*p == '\0')
+    {
+        return 1;
+    }
+    
+    /* the bus lock must exist before the driver locks the bus */
+    if (iic_lock_reserve(bus->name) != 0)
+    {
+        return 1;
+    }
+    bus->fd = atoi(p);
+    
+    return 0;
+}
+
+/**
+ * @brief         interface iic bus deinit with a bus context
+ * @param[in,out] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 iic deinit failed
+ * @note          none
+ */
+uint8_t hdc2080_interface_iic_deinit_ctx(void *ctx)
+{
+    (void)ctx;
+    
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read with a bus context
+ * @param[in]  *ctx pointer to an hdc2080_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t hdc2080_interface_iic_read_ctx(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    
+    return sim_transfer((uint8_t)bus->fd, addr >> 1, &reg, 1, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with a bus context
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t hdc2080_interface_iic_write_ctx(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    uint8_t tmp[257];
+    
+    if (len > 256)
+    {
+        return 1;
+    }
+    tmp[0] = reg;
+    memcpy(&tmp[1], buf, len);
+    
+    return sim_transfer((uint8_t)bus->fd, addr >> 1, tmp, len + 1, NULL, 0);
+}
+
+/**
+ * @brief         interface iic bus batch read
+ * @param[in]     *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @param[in,out] *batch pointer to a batch entry table
+ * @param[in]     num batch entry number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          every entry is a separate simulated transaction
+ */
+uint8_t hdc2080_interface_iic_read_batch(void *ctx, hdc2080_iic_batch_t *batch, uint16_t num)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    uint16_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (sim_transfer((bus != NULL) ? (uint8_t)bus->fd : SIM_BUS, batch[i].addr >> 1,
+                         &batch[i].reg, 1, batch[i].buf, batch[i].len) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface bus lock
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @note      the handles with the same device name share one recursive lock, it is reserved when the bus opens
+ */
+void hdc2080_interface_lock(void *ctx)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    
+    (void)iic_lock((bus != NULL) ? bus->name : SIM_BUS_NAME);
+}
+
+/**
+ * @brief     interface bus unlock
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @note      none
+ */
+void hdc2080_interface_unlock(void *ctx)
+{
+    hdc2080_interface_bus_t *bus = (hdc2080_interface_bus_t *)ctx;
+    
+    (void)iic_unlock((bus != NULL) ? bus->name : SIM_BUS_NAME);
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the virtual clock is advanced
+ */
+void hdc2080_interface_delay_ms(uint32_t ms)
+{
+    sim_delay_ns((uint64_t)ms * 1000000ULL);
+}
+
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      the virtual clock is advanced
+ */
+void hdc2080_interface_delay_us(uint32_t us)
+{
+    sim_delay_ns((uint64_t)us * 1000ULL);
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void hdc2080_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
@@ -37,11 +37,43 @@
 #include "driver_hdc2080_interrupt_test.h"
 #include "driver_hdc2080_register_test.h"
 #include "driver_hdc2080_read_test.h"
+#include "driver_hdc2080_scheduler_test.h"
+#include "driver_hdc2080_ring_test.h"
+#include "driver_hdc2080_stats_test.h"
+#include "driver_hdc2080_oversample_test.h"
+#include "driver_hdc2080_rate_test.h"
+#include "driver_hdc2080_change_test.h"
 #include "driver_hdc2080_basic.h"
 #include "driver_hdc2080_shot.h"
 #include "driver_hdc2080_interrupt.h"
+#include "driver_hdc2080_stats.h"
+#include "acquire.h"
+#include "period.h"
+#include "gpio.h"
 #include <getopt.h>
+#include <math.h>
 #include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief     print a stats summary
+ * @param[in] *name pointer to a summary name
+ * @param[in] *summary pointer to a summary
+ * @note      none
+ */
+static void a_print_summary(const char *name, const hdc2080_stats_summary_centi_t *summary)
+{
+    hdc2080_interface_debug_print("hdc2080: %s %d of %d samples in %dms.\n", name, summary->window, summary->count,
+                                  (uint32_t)((summary->last_us - summary->first_us) / 1000));
+    hdc2080_interface_debug_print("hdc2080: temperature min %0.2fC max %0.2fC mean %0.2fC ewma %0.2fC stddev %0.3fC.\n",
+                                  (float)summary->temperature.min / 100.0f, (float)summary->temperature.max / 100.0f,
+                                  (float)summary->temperature.mean / 100.0f, (float)summary->temperature.ewma / 100.0f,
+                                  sqrtf((float)summary->temperature.variance) / 100.0f);
+    hdc2080_interface_debug_print("hdc2080: humidity min %0.2f%% max %0.2f%% mean %0.2f%% ewma %0.2f%% stddev %0.3f%%.\n",
+                                  (float)summary->humidity.min / 100.0f, (float)summary->humidity.max / 100.0f,
+                                  (float)summary->humidity.mean / 100.0f, (float)summary->humidity.ewma / 100.0f,
+                                  sqrtf((float)summary->humidity.variance) / 100.0f);
+}
 
 /**
  * @brief     hdc2080 full function
@@ -249,6 +281,66 @@ uint8_t hdc2080(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_sched", type) == 0)
+    {
+        /* run scheduler test */
+        if (hdc2080_scheduler_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_ring", type) == 0)
+    {
+        /* run ring test */
+        if (hdc2080_ring_test(addr_pin, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_stats", type) == 0)
+    {
+        /* run stats test */
+        if (hdc2080_stats_test(addr_pin, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_oversample", type) == 0)
+    {
+        /* run oversample test */
+        if (hdc2080_oversample_test(addr_pin, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_rate", type) == 0)
+    {
+        /* run rate test */
+        if (hdc2080_rate_test(addr_pin, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_change", type) == 0)
+    {
+        /* run change test */
+        if (hdc2080_change_test(addr_pin, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("t_int", type) == 0)
     {
         /* run interrupt test */
@@ -270,6 +362,7 @@ uint8_t hdc2080(uint8_t argc, char **argv)
         uint32_t i;
         float temperature;
         float humidity;
+        period_t period;
         
         /* basic init */
         res = hdc2080_basic_init(addr_pin);
@@ -278,11 +371,20 @@ uint8_t hdc2080(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* sample every 2000ms on absolute deadlines */
+        res = period_init(&period, 2000000);
+        if (res != 0)
+        {
+            (void)hdc2080_basic_deinit();
+            
+            return 1;
+        }
+        
         /* loop */
         for (i = 0; i < times; i++)
         {
-            /* delay 2000ms */
-            hdc2080_interface_delay_ms(2000);
+            /* wait for the next deadline, the read and print time does not add up */
+            (void)period_wait(&period, NULL);
             
             /* read data */
             res = hdc2080_basic_read((float *)&temperature, (float *)&humidity);
@@ -300,6 +402,7 @@ uint8_t hdc2080(uint8_t argc, char **argv)
         }
         
         /* deinit */
+        period_print(&period, "hdc2080");
         (void)hdc2080_basic_deinit();
         
         return 0;
@@ -310,6 +413,7 @@ uint8_t hdc2080(uint8_t argc, char **argv)
         uint32_t i;
         float temperature;
         float humidity;
+        period_t period;
         
         /* shot init */
         res = hdc2080_shot_init(addr_pin);
@@ -318,11 +422,20 @@ uint8_t hdc2080(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* sample every 2000ms on absolute deadlines */
+        res = period_init(&period, 2000000);
+        if (res != 0)
+        {
+            (void)hdc2080_shot_deinit();
+            
+            return 1;
+        }
+        
         /* loop */
         for (i = 0; i < times; i++)
         {
-            /* delay 2000ms */
-            hdc2080_interface_delay_ms(2000);
+            /* wait for the next deadline, the read and print time does not add up */
+            (void)period_wait(&period, NULL);
             
             /* read data */
             res = hdc2080_shot_read((float *)&temperature, (float *)&humidity);
@@ -340,6 +453,7 @@ uint8_t hdc2080(uint8_t argc, char **argv)
         }
         
         /* deinit */
+        period_print(&period, "hdc2080");
         (void)hdc2080_shot_deinit();
         
         return 0;
@@ -347,9 +461,17 @@ uint8_t hdc2080(uint8_t argc, char **argv)
     else if (strcmp("e_int", type) == 0)
     {
         uint8_t res;
+        uint8_t status;
         uint32_t i;
+        uint32_t events;
+        uint32_t latency_us;
+        uint32_t latency_min_us;
+        uint32_t latency_max_us;
+        uint64_t latency_sum_us;
+        uint64_t edge_ns;
         float temperature;
         float humidity;
+        struct timespec now;
         
         /* interrupt init */
         res = hdc2080_interrupt_init(addr_pin,
@@ -362,16 +484,72 @@ uint8_t hdc2080(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* gpio init, the interrupt pin is active low */
+        res = gpio_interrupt_init(GPIO_EDGE_FALLING);
+        if (res != 0)
+        {
+            (void)hdc2080_interrupt_deinit();
+            
+            return 1;
+        }
+        
+        /* clear the stale flags so the next conversion makes an edge */
+        res = hdc2080_interrupt_irq_handler(&status);
+        if (res != 0)
+        {
+            (void)gpio_interrupt_deinit();
+            (void)hdc2080_interrupt_deinit();
+            
+            return 1;
+        }
+        
         /* loop */
+        events = 0;
+        latency_min_us = 0xFFFFFFFFU;
+        latency_max_us = 0;
+        latency_sum_us = 0;
         for (i = 0; i < times; i++)
         {
-            /* delay 2000ms */
-            hdc2080_interface_delay_ms(2000);
+            /* sleep until the interrupt pin edge */
+            res = gpio_interrupt_wait(5000, &edge_ns);
+            if (res == 4)
+            {
+                hdc2080_interface_debug_print("hdc2080: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+                hdc2080_interface_debug_print("hdc2080: no interrupt in 5000ms.\n");
+                
+                continue;
+            }
+            else if (res != 0)
+            {
+                (void)gpio_interrupt_deinit();
+                (void)hdc2080_interrupt_deinit();
+                
+                return 1;
+            }
             
             /* read data */
             res = hdc2080_interrupt_read((float *)&temperature, (float *)&humidity);
             if (res != 0)
             {
+                (void)gpio_interrupt_deinit();
+                (void)hdc2080_interrupt_deinit();
+                
+                return 1;
+            }
+            
+            /* wake to read latency */
+            (void)clock_gettime(CLOCK_MONOTONIC, &now);
+            latency_us = (uint32_t)((((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec) - edge_ns) / 1000);
+            latency_min_us = (latency_us < latency_min_us) ? latency_us : latency_min_us;
+            latency_max_us = (latency_us > latency_max_us) ? latency_us : latency_max_us;
+            latency_sum_us += latency_us;
+            events++;
+            
+            /* read and clear the status */
+            res = hdc2080_interrupt_irq_handler(&status);
+            if (res != 0)
+            {
+                (void)gpio_interrupt_deinit();
                 (void)hdc2080_interrupt_deinit();
                 
                 return 1;
@@ -381,30 +559,211 @@ uint8_t hdc2080(uint8_t argc, char **argv)
             hdc2080_interface_debug_print("hdc2080: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
             hdc2080_interface_debug_print("hdc2080: temperature is %0.2fC.\n", temperature);
             hdc2080_interface_debug_print("hdc2080: humidity is %0.2f%%.\n", humidity); 
-            
-            if (temperature > temperature_high)
+            hdc2080_interface_debug_print("hdc2080: wake to read latency is %dus.\n", latency_us);
+            if ((status & (1 << HDC2080_INTERRUPT_DRDY)) != 0)
+            {
+                hdc2080_interface_debug_print("hdc2080: data is ready.\n");
+            }
+            if ((status & (1 << HDC2080_INTERRUPT_TEMPERATURE_HIGH_THRESHOLD)) != 0)
             {
-                hdc2080_interface_debug_print("hdc2080: temperature is over high threshold and check the interrupt pin.\n");
+                hdc2080_interface_debug_print("hdc2080: temperature is over high threshold.\n");
             }
-            if (temperature < temperature_low)
+            if ((status & (1 << HDC2080_INTERRUPT_TEMPERATURE_LOW_THRESHOLD)) != 0)
             {
-                hdc2080_interface_debug_print("hdc2080: temperature is less than low threshold and check the interrupt pin.\n");
+                hdc2080_interface_debug_print("hdc2080: temperature is less than low threshold.\n");
             }
-            if (humidity > humidity_high)
+            if ((status & (1 << HDC2080_INTERRUPT_HUMIDITY_HIGH_THRESHOLD)) != 0)
             {
-                hdc2080_interface_debug_print("hdc2080: humidity is over high threshold and check the interrupt pin.\n");
+                hdc2080_interface_debug_print("hdc2080: humidity is over high threshold.\n");
             }
-            if (humidity < humidity_low)
+            if ((status & (1 << HDC2080_INTERRUPT_HUMIDITY_LOW_THRESHOLD)) != 0)
             {
-                hdc2080_interface_debug_print("hdc2080: humidity is less than low threshold and check the interrupt pin.\n");
+                hdc2080_interface_debug_print("hdc2080: humidity is less than low threshold.\n");
             }
         }
         
+        /* latency summary */
+        if (events != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: wake to read latency min %dus, avg %dus, max %dus.\n",
+                                          latency_min_us, (uint32_t)(latency_sum_us / events), latency_max_us);
+        }
+        
         /* deinit */
+        (void)gpio_interrupt_deinit();
         (void)hdc2080_interrupt_deinit();
         
         return 0;
     }
+    else if (strcmp("e_acquire", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t num;
+        uint32_t count;
+        uint32_t dropped;
+        acquire_t acquire;
+        hdc2080_ring_t ring;
+        hdc2080_ring_sample_t slot[64];
+        hdc2080_ring_sample_t batch[16];
+        hdc2080_stats_centi_t stats;
+        hdc2080_stats_summary_centi_t summary;
+        struct timespec ts = {0, 250000000L};
+        
+        /* summarize every 10 samples, a new sample weighs 1/8 in the ewma */
+        (void)hdc2080_stats_init_centi(&stats, 10, 65536 / 8);
+        
+        /* ring init */
+        res = hdc2080_ring_init(&ring, slot, 64);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* start the acquisition thread at 10Hz */
+        res = acquire_start(&acquire, addr_pin, &ring, 100000);
+        if (res != 0)
+        {
+            (void)hdc2080_ring_deinit(&ring);
+            
+            return 1;
+        }
+        
+        /* drain the samples in batches, the bus is never touched here */
+        count = 0;
+        while (count < times)
+        {
+            /* delay 250ms */
+            (void)nanosleep(&ts, NULL);
+            
+            /* pop a batch */
+            (void)hdc2080_ring_pop(&ring, batch, 16, &num);
+            for (i = 0; (i < num) && (count < times); i++)
+            {
+                count++;
+                
+                /* output */
+                hdc2080_interface_debug_print("hdc2080: %d/%d.\n", count, (uint32_t)times);
+                hdc2080_interface_debug_print("hdc2080: sequence is %d.\n", batch[i].sequence);
+                hdc2080_interface_debug_print("hdc2080: temperature is %0.2fC.\n", (float)batch[i].temperature_centi / 100.0f);
+                hdc2080_interface_debug_print("hdc2080: humidity is %0.2f%%.\n", (float)batch[i].humidity_centi / 100.0f);
+                
+                /* a full window is printed instead of the next raw sample on an uplink */
+                (void)hdc2080_stats_update_centi(&stats, batch[i].timestamp_us,
+                                                 batch[i].temperature_centi, batch[i].humidity_centi);
+                if (hdc2080_stats_get_window_centi(&stats, &summary) == 0)
+                {
+                    a_print_summary("window", &summary);
+                }
+            }
+        }
+        
+        /* the partial window */
+        if (hdc2080_stats_get_summary_centi(&stats, &summary) == 0)
+        {
+            a_print_summary("partial window", &summary);
+        }
+        
+        /* stop */
+        (void)acquire_stop(&acquire);
+        (void)hdc2080_ring_get_dropped(&ring, &dropped);
+        hdc2080_interface_debug_print("hdc2080: acquired %d samples, errors %d, dropped %d.\n",
+                                      acquire.samples, acquire.errors, dropped);
+        period_print(&acquire.period, "hdc2080");
+        (void)hdc2080_ring_deinit(&ring);
+        
+        return 0;
+    }
+    else if (strcmp("e_shm", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t j;
+        uint32_t count;
+        uint8_t started[2];
+        acquire_t acquire[2];
+        shm_publish_t writer;
+        shm_publish_t reader;
+        hdc2080_ring_sample_t sample;
+        struct timespec ts = {0, 250000000L};
+        
+        /* create the segment with one slot per address */
+        res = shm_publish_create(&writer, SHM_PUBLISH_NAME, 2);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* start a publishing thread at 10Hz for every sensor found */
+        for (j = 0; j < 2; j++)
+        {
+            started[j] = 0;
+            if (acquire_start(&acquire[j], (j == 0) ? HDC2080_ADDRESS_0 : HDC2080_ADDRESS_1, NULL, 100000) == 0)
+            {
+                (void)acquire_publish(&acquire[j], &writer, j);
+                started[j] = 1;
+            }
+        }
+        if ((started[0] == 0) && (started[1] == 0))
+        {
+            (void)shm_publish_close(&writer);
+            
+            return 1;
+        }
+        
+        /* read through an own read only mapping as any other process would */
+        res = shm_publish_open(&reader, SHM_PUBLISH_NAME);
+        if (res != 0)
+        {
+            for (j = 0; j < 2; j++)
+            {
+                if (started[j] != 0)
+                {
+                    (void)acquire_stop(&acquire[j]);
+                }
+            }
+            (void)shm_publish_close(&writer);
+            
+            return 1;
+        }
+        for (i = 0; i < times; i++)
+        {
+            /* delay 250ms */
+            (void)nanosleep(&ts, NULL);
+            
+            /* output the latest sample of every slot */
+            hdc2080_interface_debug_print("hdc2080: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            for (j = 0; j < 2; j++)
+            {
+                res = shm_publish_read(&reader, j, &sample, &count);
+                if (res != 0)
+                {
+                    hdc2080_interface_debug_print("hdc2080: sensor %d has no sample.\n", j);
+                    
+                    continue;
+                }
+                hdc2080_interface_debug_print("hdc2080: sensor %d sequence is %d at %lluus.\n", j, sample.sequence,
+                                              (unsigned long long)sample.timestamp_us);
+                hdc2080_interface_debug_print("hdc2080: sensor %d temperature is %0.2fC.\n", j, (float)sample.temperature_centi / 100.0f);
+                hdc2080_interface_debug_print("hdc2080: sensor %d humidity is %0.2f%%.\n", j, (float)sample.humidity_centi / 100.0f);
+            }
+        }
+        
+        /* stop */
+        (void)shm_publish_close(&reader);
+        for (j = 0; j < 2; j++)
+        {
+            if (started[j] != 0)
+            {
+                (void)acquire_stop(&acquire[j]);
+                hdc2080_interface_debug_print("hdc2080: sensor %d published %d samples, errors %d.\n",
+                                              j, acquire[j].samples, acquire[j].errors);
+            }
+        }
+        (void)shm_publish_close(&writer);
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -414,23 +773,31 @@ uint8_t hdc2080(uint8_t argc, char **argv)
         hdc2080_interface_debug_print("  hdc2080 (-p | --port)\n");
         hdc2080_interface_debug_print("  hdc2080 (-t reg | --test=reg) [--addr=<0 | 1>]\n");
         hdc2080_interface_debug_print("  hdc2080 (-t read | --test=read) [--addr=<0 | 1>] [--times=<num>]\n");
+        hdc2080_interface_debug_print("  hdc2080 (-t sched | --test=sched) [--times=<num>]\n");
+        hdc2080_interface_debug_print("  hdc2080 (-t ring | --test=ring) [--addr=<0 | 1>] [--times=<num>]\n");
+        hdc2080_interface_debug_print("  hdc2080 (-t stats | --test=stats) [--addr=<0 | 1>] [--times=<num>]\n");
+        hdc2080_interface_debug_print("  hdc2080 (-t oversample | --test=oversample) [--addr=<0 | 1>] [--times=<num>]\n");
+        hdc2080_interface_debug_print("  hdc2080 (-t rate | --test=rate) [--addr=<0 | 1>] [--times=<num>]\n");
+        hdc2080_interface_debug_print("  hdc2080 (-t change | --test=change) [--addr=<0 | 1>] [--times=<num>]\n");
         hdc2080_interface_debug_print("  hdc2080 (-t int | --test=int) [--addr=<0 | 1>] [--times=<num>] [--temperature-high=<deg>] "); 
         hdc2080_interface_debug_print("[--temperature-low=<deg>] [--humidity-high=<percent>] [--humidity-low=<percent>]\n");
         hdc2080_interface_debug_print("  hdc2080 (-e read | --example=read) [--addr=<0 | 1>] [--times=<num>]\n");
         hdc2080_interface_debug_print("  hdc2080 (-e shot | --example=shot) [--addr=<0 | 1>] [--times=<num>]\n");
+        hdc2080_interface_debug_print("  hdc2080 (-e acquire | --example=acquire) [--addr=<0 | 1>] [--times=<num>]\n");
+        hdc2080_interface_debug_print("  hdc2080 (-e shm | --example=shm) [--times=<num>]\n");
         hdc2080_interface_debug_print("  hdc2080 (-e int | --test=int) [--addr=<0 | 1>] [--times=<num>] [--temperature-high=<deg>] ");
         hdc2080_interface_debug_print("[--temperature-low=<deg>] [--humidity-high=<percent>] [--humidity-low=<percent>]\n");
         hdc2080_interface_debug_print("\n");
         hdc2080_interface_debug_print("Options:\n");
         hdc2080_interface_debug_print("      --addr=<0 | 1>             Set the iic address.([default: 0])\n");
-        hdc2080_interface_debug_print("  -e <read | shot | int>, --example=<read | shot | int>\n");
+        hdc2080_interface_debug_print("  -e <read | shot | acquire | shm | int>, --example=<read | shot | acquire | shm | int>\n");
         hdc2080_interface_debug_print("                                 Run the driver example.\n");
         hdc2080_interface_debug_print("  -h, --help                     Show the help.\n");
         hdc2080_interface_debug_print("      --humidity-high=<percent>  Set the humidity high threshold.([default: 0.0])\n");
         hdc2080_interface_debug_print("      --humidity-low=<percent>   Set the humidity low threshold.([default: 0.0])\n");
         hdc2080_interface_debug_print("  -i, --information              Show the chip information.\n");
         hdc2080_interface_debug_print("  -p, --port                     Display the pin connections of the current board.\n");
-        hdc2080_interface_debug_print("  -t <reg | read | int>, --test=<reg | read | int>\n");
+        hdc2080_interface_debug_print("  -t <reg | read | sched | ring | stats | oversample | rate | change | int>, --test=<reg | read | sched | ring | stats | oversample | rate | change | int>\n");
         hdc2080_interface_debug_print("                                 Run the driver test.\n");
         hdc2080_interface_debug_print("      --temperature-high=<deg>   Set the temperature high threshold.([default: 0.0])\n");
         hdc2080_interface_debug_print("      --temperature-low=<deg>    Set the temperature low threshold.([default: 0.0])\n");
@@ -461,6 +828,7 @@ uint8_t hdc2080(uint8_t argc, char **argv)
         /* print pin connection */
         hdc2080_interface_debug_print("hdc2080: SCL connected to GPIO3(BCM).\n");
         hdc2080_interface_debug_print("hdc2080: SDA connected to GPIO2(BCM).\n");
+        hdc2080_interface_debug_print("hdc2080: INT connected to GPIO17(BCM).\n");
         
         return 0;
     }
@@ -96,6 +96,120 @@ uint8_t hdc2080_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uin
     return iic_write(addr, reg, buf, len);
 }
 
+/**
+ * @brief         interface iic bus init with a bus context
+ * @param[in,out] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 iic init failed
+ * @note          there is one iic bus on this board and the context is not used
+ */
+uint8_t hdc2080_interface_iic_init_ctx(void *ctx)
+{
+    (void)ctx;
+    
+    return iic_init();
+}
+
+/**
+ * @brief         interface iic bus deinit with a bus context
+ * @param[in,out] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 iic deinit failed
+ * @note          none
+ */
+uint8_t hdc2080_interface_iic_deinit_ctx(void *ctx)
+{
+    (void)ctx;
+    
+    return iic_deinit();
+}
+
+/**
+ * @brief      interface iic bus read with a bus context
+ * @param[in]  *ctx pointer to an hdc2080_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t hdc2080_interface_iic_read_ctx(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)ctx;
+    
+    return iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with a bus context
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t hdc2080_interface_iic_write_ctx(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)ctx;
+    
+    return iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief         interface iic bus batch read
+ * @param[in]     *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @param[in,out] *batch pointer to a batch entry table
+ * @param[in]     num batch entry number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          the entries are read one after another
+ */
+uint8_t hdc2080_interface_iic_read_batch(void *ctx, hdc2080_iic_batch_t *batch, uint16_t num)
+{
+    uint16_t i;
+    
+    (void)ctx;
+    for (i = 0; i < num; i++)
+    {
+        if (iic_read(batch[i].addr, batch[i].reg, batch[i].buf, batch[i].len) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface bus lock
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @note      there is no thread on this board and the lock is empty
+ */
+void hdc2080_interface_lock(void *ctx)
+{
+    (void)ctx;
+}
+
+/**
+ * @brief     interface bus unlock
+ * @param[in] *ctx pointer to an hdc2080_interface_bus_t structure or NULL for the default bus
+ * @note      none
+ */
+void hdc2080_interface_unlock(void *ctx)
+{
+    (void)ctx;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -106,6 +220,16 @@ void hdc2080_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void hdc2080_interface_delay_us(uint32_t us)
+{
+    delay_us(us);
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
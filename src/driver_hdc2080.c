@@ -72,6 +72,18 @@
 #define HDC2080_REG_DEVICE_ID_LOW          0xFE        /**< device id low register */
 #define HDC2080_REG_DEVICE_ID_HIGH         0xFF        /**< device id high register */
 
+/**
+ * @brief read poll backoff definition
+ */
+#define HDC2080_POLL_BACKOFF_MIN_US        50           /**< first backoff 50us */
+#define HDC2080_POLL_BACKOFF_MAX_US        10000        /**< max backoff 10ms */
+
+/**
+ * @brief register cache definition
+ */
+#define HDC2080_CACHE_START                HDC2080_REG_INTERRUPT_ENABLE        /**< first cached register */
+#define HDC2080_CACHE_END                  HDC2080_REG_MEASUREMENT             /**< last cached register */
+
 /**
  * @brief      read data
  * @param[in]  *handle pointer to an hdc2080 handle structure
@@ -85,13 +97,23 @@
  */
 static uint8_t a_hdc2080_iic_read(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
-    if (handle->iic_read(handle->iic_addr, reg, buf, len) != 0)    /* read the register */
+    uint8_t res;
+    
+    if (handle->iic_read_ctx != NULL)                                                  /* check the context read */
+    {
+        res = handle->iic_read_ctx(handle->ctx, handle->iic_addr, reg, buf, len);      /* read the register */
+    }
+    else
+    {
+        res = handle->iic_read(handle->iic_addr, reg, buf, len);                       /* read the register */
+    }
+    if (res != 0)                                                                      /* check the result */
     {
-        return 1;                                                  /* return error */
+        return 1;                                                                      /* return error */
     }
     else
     {
-        return 0;                                                  /* success return 0 */
+        return 0;                                                                      /* success return 0 */
     }
 }
 
@@ -108,14 +130,246 @@ static uint8_t a_hdc2080_iic_read(hdc2080_handle_t *handle, uint8_t reg, uint8_t
  */
 static uint8_t a_hdc2080_iic_write(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
-    if (handle->iic_write(handle->iic_addr, reg, buf, len) != 0)    /* write the register */
+    uint8_t res;
+    
+    if (handle->iic_write_ctx != NULL)                                                 /* check the context write */
+    {
+        res = handle->iic_write_ctx(handle->ctx, handle->iic_addr, reg, buf, len);     /* write the register */
+    }
+    else
+    {
+        res = handle->iic_write(handle->iic_addr, reg, buf, len);                      /* write the register */
+    }
+    if (res != 0)                                                                      /* check the result */
+    {
+        return 1;                                                                      /* return error */
+    }
+    else
+    {
+        return 0;                                                                      /* success return 0 */
+    }
+}
+
+/**
+ * @brief     iic bus init
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+static uint8_t a_hdc2080_iic_init(hdc2080_handle_t *handle)
+{
+    if (handle->iic_init_ctx != NULL)                  /* check the context init */
+    {
+        return handle->iic_init_ctx(handle->ctx);      /* iic init */
+    }
+    else
+    {
+        return handle->iic_init();                     /* iic init */
+    }
+}
+
+/**
+ * @brief     iic bus deinit
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+static uint8_t a_hdc2080_iic_deinit(hdc2080_handle_t *handle)
+{
+    if (handle->iic_deinit_ctx != NULL)                  /* check the context deinit */
     {
-        return 1;                                                   /* return error */
+        return handle->iic_deinit_ctx(handle->ctx);      /* iic deinit */
     }
     else
     {
-        return 0;                                                   /* success return 0 */
+        return handle->iic_deinit();                     /* iic deinit */
+    }
+}
+
+/**
+ * @brief     lock the bus
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @note      nothing is done when the lock is not linked
+ */
+static void a_hdc2080_lock(hdc2080_handle_t *handle)
+{
+    if (handle->lock != NULL)            /* check lock */
+    {
+        handle->lock(handle->ctx);       /* lock */
+    }
+}
+
+/**
+ * @brief     unlock the bus
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @note      nothing is done when the unlock is not linked
+ */
+static void a_hdc2080_unlock(hdc2080_handle_t *handle)
+{
+    if (handle->unlock != NULL)          /* check unlock */
+    {
+        handle->unlock(handle->ctx);     /* unlock */
+    }
+}
+
+/**
+ * @brief     delay us
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] us time
+ * @note      delay_ms is used with a rounded up time when delay_us is not linked
+ */
+static void a_hdc2080_delay_us(hdc2080_handle_t *handle, uint32_t us)
+{
+    if (handle->delay_us != NULL)                  /* check delay_us */
+    {
+        handle->delay_us(us);                      /* delay us */
+    }
+    else
+    {
+        handle->delay_ms((us + 999) / 1000);       /* delay ms */
+    }
+}
+
+/**
+ * @brief     get the conversion time
+ * @param[in] meas measurement config register
+ * @return    conversion time in us
+ * @note      typical datasheet values, temperature 14/11/9 bit 610/350/225us, humidity 660/400/275us
+ */
+static uint32_t a_hdc2080_conversion_time_us(uint8_t meas)
+{
+    const uint16_t temperature_us[4] = {610, 350, 225, 225};
+    const uint16_t humidity_us[4] = {660, 400, 275, 275};
+    uint32_t us;
+    
+    us = temperature_us[(meas >> 6) & 0x03];                              /* temperature conversion */
+    if (((meas >> 1) & 0x03) == HDC2080_MODE_HUMIDITY_TEMPERATURE)        /* check humidity */
+    {
+        us += humidity_us[(meas >> 4) & 0x03];                            /* humidity conversion */
+    }
+    
+    return us;                                                            /* return time */
+}
+
+/**
+ * @brief     convert the raw temperature to centi degrees
+ * @param[in] raw raw temperature
+ * @return    temperature in 0.01 degrees
+ * @note      t = raw * 16500 / 65536 - 4050, rounded to nearest with integer multiply and shift only
+ */
+static int16_t a_hdc2080_temperature_to_centi(uint16_t raw)
+{
+    return (int16_t)((int32_t)(((uint32_t)raw * 16500U + 32768U) >> 16) - 4050);        /* convert temperature */
+}
+
+/**
+ * @brief     convert the raw humidity to centi percent
+ * @param[in] raw raw humidity
+ * @return    humidity in 0.01 percent
+ * @note      rh = raw * 10000 / 65536, rounded to nearest with integer multiply and shift only
+ */
+static uint16_t a_hdc2080_humidity_to_centi(uint16_t raw)
+{
+    return (uint16_t)(((uint32_t)raw * 10000U + 32768U) >> 16);        /* convert humidity */
+}
+
+/**
+ * @brief     sync the register cache with written data
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len buffer length
+ * @note      self clearing bits are never kept in the cache
+ */
+static void a_hdc2080_cache_sync(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint16_t addr;
+
+    for (i = 0; i < len; i++)                                                    /* check all bytes */
+    {
+        addr = (uint16_t)reg + i;                                                /* get register address */
+        if ((addr >= HDC2080_CACHE_START) && (addr <= HDC2080_CACHE_END))        /* check cached range */
+        {
+            handle->cache[addr - HDC2080_CACHE_START] = buf[i];                  /* save data */
+        }
+    }
+    handle->cache[HDC2080_REG_CONF - HDC2080_CACHE_START] &= ~(1 << 7);          /* soft reset bit self clears */
+    handle->cache[HDC2080_REG_MEASUREMENT - HDC2080_CACHE_START] &= ~(1 << 0);   /* trigger bit self clears */
+}
+
+/**
+ * @brief     fill the register cache
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill failed
+ * @note      none
+ */
+static uint8_t a_hdc2080_cache_fill(hdc2080_handle_t *handle)
+{
+    uint8_t buf[HDC2080_CACHE_END - HDC2080_CACHE_START + 1];
+
+    if (a_hdc2080_iic_read(handle, HDC2080_CACHE_START, buf,
+                           HDC2080_CACHE_END - HDC2080_CACHE_START + 1) != 0)   /* read all cached registers */
+    {
+        return 1;                                                               /* return error */
     }
+    a_hdc2080_cache_sync(handle, HDC2080_CACHE_START, buf,
+                         HDC2080_CACHE_END - HDC2080_CACHE_START + 1);          /* save to cache */
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      read one config register
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[in]  reg register address
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the cached value is returned without bus access when the cache is enabled
+ */
+static uint8_t a_hdc2080_config_read(hdc2080_handle_t *handle, uint8_t reg, uint8_t *value)
+{
+    if ((handle->cache_enable != 0) &&
+        (reg >= HDC2080_CACHE_START) && (reg <= HDC2080_CACHE_END))    /* check cache */
+    {
+        *value = handle->cache[reg - HDC2080_CACHE_START];             /* get cached value */
+
+        return 0;                                                      /* success return 0 */
+    }
+
+    return a_hdc2080_iic_read(handle, reg, value, 1);                  /* read the register */
+}
+
+/**
+ * @brief     write one config register
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] reg register address
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the cache is written through
+ */
+static uint8_t a_hdc2080_config_write(hdc2080_handle_t *handle, uint8_t reg, uint8_t value)
+{
+    if (a_hdc2080_iic_write(handle, reg, &value, 1) != 0)        /* write the register */
+    {
+        return 1;                                                /* return error */
+    }
+    if (handle->cache_enable != 0)                               /* check cache */
+    {
+        a_hdc2080_cache_sync(handle, reg, &value, 1);            /* update cache */
+    }
+
+    return 0;                                                    /* success return 0 */
 }
 
 /**
@@ -171,6 +425,7 @@ uint8_t hdc2080_get_addr_pin(hdc2080_handle_t *handle, hdc2080_address_t *addr_p
  *            - 4 read id failed
  *            - 5 id is invalid
  *            - 6 reset failed
+ *            - 7 fill register cache failed
  * @note      none
  */
 uint8_t hdc2080_init(hdc2080_handle_t *handle)
@@ -187,25 +442,25 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
     {
         return 3;                                                              /* return error */
     }
-    if (handle->iic_init == NULL)                                              /* check iic_init */
+    if ((handle->iic_init == NULL) && (handle->iic_init_ctx == NULL))          /* check iic_init */
     {
         handle->debug_print("hdc2080: iic_init is null.\n");                   /* iic_init is null */
         
         return 3;                                                              /* return error */
     }
-    if (handle->iic_deinit == NULL)                                            /* check iic_deinit */
+    if ((handle->iic_deinit == NULL) && (handle->iic_deinit_ctx == NULL))      /* check iic_deinit */
     {
         handle->debug_print("hdc2080: iic_deinit is null.\n");                 /* iic_deinit is null */
         
         return 3;                                                              /* return error */
     }
-    if (handle->iic_read == NULL)                                              /* check iic_read */
+    if ((handle->iic_read == NULL) && (handle->iic_read_ctx == NULL))          /* check iic_read */
     {
         handle->debug_print("hdc2080: iic_read is null.\n");                   /* iic_read is null */
         
         return 3;                                                              /* return error */
     }
-    if (handle->iic_write == NULL)                                             /* check iic_write */
+    if ((handle->iic_write == NULL) && (handle->iic_write_ctx == NULL))        /* check iic_write */
     {
         handle->debug_print("hdc2080: iic_write is null.\n");                  /* iic_write is null */
         
@@ -217,10 +472,18 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
         
         return 3;                                                              /* return error */
     }
+    if ((handle->lock == NULL) != (handle->unlock == NULL))                    /* check lock and unlock */
+    {
+        handle->debug_print("hdc2080: lock or unlock is null.\n");             /* lock is not paired */
+        
+        return 3;                                                              /* return error */
+    }
     
-    if (handle->iic_init() != 0)                                               /* iic init */
+    a_hdc2080_lock(handle);                                                    /* lock */
+    if (a_hdc2080_iic_init(handle) != 0)                                       /* iic init */
     {
         handle->debug_print("hdc2080: iic init failed.\n");                    /* iic init failed */
+        a_hdc2080_unlock(handle);                                              /* unlock */
         
         return 1;                                                              /* return error */
     }
@@ -228,7 +491,8 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("hdc2080: read manufacturer id failed.\n");        /* read manufacturer id failed */
-        (void)handle->iic_deinit();                                            /* iic deinit */
+        (void)a_hdc2080_iic_deinit(handle);                                    /* iic deinit */
+        a_hdc2080_unlock(handle);                                              /* unlock */
         
         return 4;                                                              /* return error */
     }
@@ -236,7 +500,8 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
     if (id != 0x5449)                                                          /* check id */
     {
         handle->debug_print("hdc2080: manufacturer id is invalid.\n");         /* read manufacturer id failed */
-        (void)handle->iic_deinit();                                            /* iic deinit */
+        (void)a_hdc2080_iic_deinit(handle);                                    /* iic deinit */
+        a_hdc2080_unlock(handle);                                              /* unlock */
         
         return 5;                                                              /* return error */
     }
@@ -244,7 +509,8 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("hdc2080: read device id failed.\n");              /* read device id failed */
-        (void)handle->iic_deinit();                                            /* iic deinit */
+        (void)a_hdc2080_iic_deinit(handle);                                    /* iic deinit */
+        a_hdc2080_unlock(handle);                                              /* unlock */
         
         return 4;                                                              /* return error */
     }
@@ -252,7 +518,8 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
     if (id != 0x07D0)                                                          /* check id */
     {
         handle->debug_print("hdc2080: device id is invalid.\n");               /* read device id failed */
-        (void)handle->iic_deinit();                                            /* iic deinit */
+        (void)a_hdc2080_iic_deinit(handle);                                    /* iic deinit */
+        a_hdc2080_unlock(handle);                                              /* unlock */
         
         return 5;                                                              /* return error */
     }
@@ -261,7 +528,8 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                 /* read config failed */
-        (void)handle->iic_deinit();                                            /* iic deinit */
+        (void)a_hdc2080_iic_deinit(handle);                                    /* iic deinit */
+        a_hdc2080_unlock(handle);                                              /* unlock */
         
         return 6;                                                              /* return error */
     }
@@ -271,12 +539,26 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                /* write config failed */
-        (void)handle->iic_deinit();                                            /* iic deinit */
+        (void)a_hdc2080_iic_deinit(handle);                                    /* iic deinit */
+        a_hdc2080_unlock(handle);                                              /* unlock */
         
         return 6;                                                              /* return error */
     }
     handle->delay_ms(100);                                                     /* delay 100ms */
+    if (handle->cache_enable != 0)                                             /* check register cache */
+    {
+        res = a_hdc2080_cache_fill(handle);                                    /* fill register cache */
+        if (res != 0)                                                          /* check result */
+        {
+            handle->debug_print("hdc2080: fill register cache failed.\n");     /* fill register cache failed */
+            (void)a_hdc2080_iic_deinit(handle);                                /* iic deinit */
+            a_hdc2080_unlock(handle);                                          /* unlock */
+            
+            return 7;                                                          /* return error */
+        }
+    }
     handle->inited = 1;                                                        /* flag finish initialization */
+    a_hdc2080_unlock(handle);                                                  /* unlock */
     
     return 0;                                                                  /* success return 0 */
 }
@@ -291,44 +573,457 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle)
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t hdc2080_deinit(hdc2080_handle_t *handle)
+uint8_t hdc2080_deinit(hdc2080_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t prev;
+    
+    if (handle == NULL)                                                  /* check handle */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (handle->inited != 1)                                             /* check handle initialization */
+    {
+        return 3;                                                        /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
+    if (res != 0)                                                        /* check result */
+    {
+        handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
+        
+        return 1;                                                        /* return error */
+    }
+    prev &= ~(7 << 4);                                                   /* clear settings */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_CONF, prev);        /* write config */
+    if (res != 0)                                                        /* check result */
+    {
+        handle->debug_print("hdc2080: write config failed.\n");          /* write config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
+        
+        return 1;                                                        /* return error */
+    }
+    if (a_hdc2080_iic_deinit(handle) != 0)                               /* iic deinit */
+    {
+        handle->debug_print("hdc2080: iic deinit failed.\n");            /* iic deinit failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
+        
+        return 1;                                                        /* return error */
+    }
+    handle->inited = 0;                                                  /* set closed flag */
+    a_hdc2080_unlock(handle);                                            /* unlock */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set register cache failed
+ *            - 2 handle is NULL
+ * @note      the cache keeps a write-through copy of the registers 0x07 - 0x0F,
+ *            it can be enabled before hdc2080_init and is filled during the init
+ */
+uint8_t hdc2080_set_register_cache(hdc2080_handle_t *handle, hdc2080_bool_t enable)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                    /* lock */
+    if ((enable == HDC2080_BOOL_TRUE) && (handle->inited == 1))                /* check initialization */
+    {
+        res = a_hdc2080_cache_fill(handle);                                    /* fill register cache */
+        if (res != 0)                                                          /* check result */
+        {
+            handle->debug_print("hdc2080: fill register cache failed.\n");     /* fill register cache failed */
+            a_hdc2080_unlock(handle);                                          /* unlock */
+            
+            return 1;                                                          /* return error */
+        }
+    }
+    handle->cache_enable = (uint8_t)enable;                                    /* set cache */
+    a_hdc2080_unlock(handle);                                                  /* unlock */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      get the register cache status
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t hdc2080_get_register_cache(hdc2080_handle_t *handle, hdc2080_bool_t *enable)
+{
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    
+    *enable = (hdc2080_bool_t)(handle->cache_enable);           /* get cache */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     apply a whole configuration
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply config failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 config is NULL
+ * @note      the registers 0x07 - 0x0F are written in one burst transaction
+ */
+uint8_t hdc2080_apply_config(hdc2080_handle_t *handle, const hdc2080_config_t *config)
+{
+    uint8_t res;
+    uint8_t buf[HDC2080_CACHE_END - HDC2080_CACHE_START + 1];
+    
+    if (handle == NULL)                                                                                            /* check handle */
+    {
+        return 2;                                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                                  /* return error */
+    }
+    if (config == NULL)                                                                                            /* check config */
+    {
+        return 4;                                                                                                  /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                                                        /* lock */
+    buf[0] = (uint8_t)(config->drdy_interrupt << HDC2080_INTERRUPT_DRDY);                                          /* set drdy interrupt */
+    buf[0] |= config->temperature_high_threshold_interrupt << HDC2080_INTERRUPT_TEMPERATURE_HIGH_THRESHOLD;        /* set temperature high threshold interrupt */
+    buf[0] |= config->temperature_low_threshold_interrupt << HDC2080_INTERRUPT_TEMPERATURE_LOW_THRESHOLD;          /* set temperature low threshold interrupt */
+    buf[0] |= config->humidity_high_threshold_interrupt << HDC2080_INTERRUPT_HUMIDITY_HIGH_THRESHOLD;              /* set humidity high threshold interrupt */
+    buf[0] |= config->humidity_low_threshold_interrupt << HDC2080_INTERRUPT_HUMIDITY_LOW_THRESHOLD;                /* set humidity low threshold interrupt */
+    buf[1] = (uint8_t)(config->temperature_offset);                                                                /* set temperature offset */
+    buf[2] = (uint8_t)(config->humidity_offset);                                                                   /* set humidity offset */
+    buf[3] = config->temperature_low_threshold;                                                                    /* set temperature low threshold */
+    buf[4] = config->temperature_high_threshold;                                                                   /* set temperature high threshold */
+    buf[5] = config->humidity_low_threshold;                                                                       /* set humidity low threshold */
+    buf[6] = config->humidity_high_threshold;                                                                      /* set humidity high threshold */
+    buf[7] = (uint8_t)((config->auto_measurement_mode << 4) | (config->heater << 3) |
+                       (config->interrupt_pin << 2) | (config->interrupt_polarity << 1) |
+                       (config->interrupt_mode << 0));                                                             /* set conf */
+    buf[8] = (uint8_t)((config->temperature_resolution << 6) | (config->humidity_resolution << 4) |
+                       (config->mode << 1) | (config->measurement << 0));                                          /* set measurement */
+    res = a_hdc2080_iic_write(handle, HDC2080_CACHE_START, buf,
+                              HDC2080_CACHE_END - HDC2080_CACHE_START + 1);                                        /* write all config registers */
+    if (res != 0)                                                                                                  /* check result */
+    {
+        handle->debug_print("hdc2080: write config failed.\n");                                                    /* write config failed */
+        a_hdc2080_unlock(handle);                                                                                  /* unlock */
+        
+        return 1;                                                                                                  /* return error */
+    }
+    if (handle->cache_enable != 0)                                                                                 /* check register cache */
+    {
+        a_hdc2080_cache_sync(handle, HDC2080_CACHE_START, buf,
+                             HDC2080_CACHE_END - HDC2080_CACHE_START + 1);                                         /* save to cache */
+    }
+    a_hdc2080_unlock(handle);                                                                                      /* unlock */
+    
+    return 0;                                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      get the whole configuration
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get config failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the registers 0x07 - 0x0F are read in one burst transaction or from the register cache
+ */
+uint8_t hdc2080_get_config(hdc2080_handle_t *handle, hdc2080_config_t *config)
+{
+    uint8_t res;
+    uint8_t buf[HDC2080_CACHE_END - HDC2080_CACHE_START + 1];
+    
+    if (handle == NULL)                                                                             /* check handle */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                   /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                                         /* lock */
+    if (handle->cache_enable != 0)                                                                  /* check register cache */
+    {
+        memcpy(buf, handle->cache, HDC2080_CACHE_END - HDC2080_CACHE_START + 1);                    /* copy the cache */
+    }
+    else
+    {
+        res = a_hdc2080_iic_read(handle, HDC2080_CACHE_START, buf,
+                                 HDC2080_CACHE_END - HDC2080_CACHE_START + 1);                      /* read all config registers */
+        if (res != 0)                                                                               /* check result */
+        {
+            handle->debug_print("hdc2080: read config failed.\n");                                  /* read config failed */
+            a_hdc2080_unlock(handle);                                                               /* unlock */
+            
+            return 1;                                                                               /* return error */
+        }
+    }
+    config->drdy_interrupt = (hdc2080_bool_t)((buf[0] >> 7) & 0x01);                                /* get drdy interrupt */
+    config->temperature_high_threshold_interrupt = (hdc2080_bool_t)((buf[0] >> 6) & 0x01);          /* get temperature high threshold interrupt */
+    config->temperature_low_threshold_interrupt = (hdc2080_bool_t)((buf[0] >> 5) & 0x01);           /* get temperature low threshold interrupt */
+    config->humidity_high_threshold_interrupt = (hdc2080_bool_t)((buf[0] >> 4) & 0x01);             /* get humidity high threshold interrupt */
+    config->humidity_low_threshold_interrupt = (hdc2080_bool_t)((buf[0] >> 3) & 0x01);              /* get humidity low threshold interrupt */
+    config->temperature_offset = (int8_t)(buf[1]);                                                  /* get temperature offset */
+    config->humidity_offset = (int8_t)(buf[2]);                                                     /* get humidity offset */
+    config->temperature_low_threshold = buf[3];                                                     /* get temperature low threshold */
+    config->temperature_high_threshold = buf[4];                                                    /* get temperature high threshold */
+    config->humidity_low_threshold = buf[5];                                                        /* get humidity low threshold */
+    config->humidity_high_threshold = buf[6];                                                       /* get humidity high threshold */
+    config->auto_measurement_mode = (hdc2080_auto_measurement_mode_t)((buf[7] >> 4) & 0x07);        /* get auto measurement mode */
+    config->heater = (hdc2080_bool_t)((buf[7] >> 3) & 0x01);                                        /* get heater */
+    config->interrupt_pin = (hdc2080_bool_t)((buf[7] >> 2) & 0x01);                                 /* get interrupt pin */
+    config->interrupt_polarity = (hdc2080_interrupt_polarity_t)((buf[7] >> 1) & 0x01);              /* get interrupt polarity */
+    config->interrupt_mode = (hdc2080_interrupt_mode_t)((buf[7] >> 0) & 0x01);                      /* get interrupt mode */
+    config->temperature_resolution = (hdc2080_resolution_t)((buf[8] >> 6) & 0x03);                  /* get temperature resolution */
+    config->humidity_resolution = (hdc2080_resolution_t)((buf[8] >> 4) & 0x03);                     /* get humidity resolution */
+    config->mode = (hdc2080_mode_t)((buf[8] >> 1) & 0x03);                                          /* get mode */
+    config->measurement = (hdc2080_bool_t)((buf[8] >> 0) & 0x01);                                   /* get measurement */
+    a_hdc2080_unlock(handle);                                                                       /* unlock */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     trigger a measurement without waiting
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 trigger measurement failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      use hdc2080_try_fetch to harvest the result
+ */
+uint8_t hdc2080_trigger_measurement(hdc2080_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t prev;
+    
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                    /* check handle initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
+    if (res != 0)                                                               /* check result */
+    {
+        handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
+        
+        return 1;                                                               /* return error */
+    }
+    prev &= ~(1 << 0);                                                          /* clear settings */
+    prev |= 1 << 0;                                                             /* set bool */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_MEASUREMENT, prev);        /* write config */
+    if (res != 0)                                                               /* check result */
+    {
+        handle->debug_print("hdc2080: write config failed.\n");                 /* write config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
+        
+        return 1;                                                               /* return error */
+    }
+    a_hdc2080_unlock(handle);                                                   /* unlock */
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the conversion time of the current measurement config
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *us pointer to a conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conversion time failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       typical datasheet time for the resolution and mode
+ */
+uint8_t hdc2080_get_conversion_time(hdc2080_handle_t *handle, uint32_t *us)
+{
+    uint8_t res;
+    uint8_t prev;
+    
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                    /* check handle initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
+    if (res != 0)                                                               /* check result */
+    {
+        handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
+        
+        return 1;                                                               /* return error */
+    }
+    *us = a_hdc2080_conversion_time_us(prev);                                   /* get conversion time */
+    a_hdc2080_unlock(handle);                                                   /* unlock */
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief      try to fetch the result of a triggered measurement
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 try fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 not ready
+ * @note       it never sleeps, the outputs are unchanged when the conversion is not ready
+ */
+uint8_t hdc2080_try_fetch(hdc2080_handle_t *handle, uint16_t *temperature_raw, float *temperature_s,
+                          uint16_t *humidity_raw, float *humidity_s)
+{
+    uint8_t res;
+    uint8_t prev;
+    uint8_t buf[4];
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                            /* lock */
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);               /* read config */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("hdc2080: read config failed.\n");                         /* read config failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
+        
+        return 1;                                                                      /* return error */
+    }
+    if (((prev >> 0) & 0x01) != 0)                                                     /* check flag */
+    {
+        a_hdc2080_unlock(handle);                                                      /* unlock */
+        
+        return 4;                                                                      /* not ready */
+    }
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_LOW, buf, 4);             /* read temperature and humidity */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("hdc2080: read temperature and humidity failed.\n");       /* read temperature and humidity failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
+        
+        return 1;                                                                      /* return error */
+    }
+    *temperature_raw = buf[0] | (uint16_t)(buf[1]) << 8;                               /* get temperature */
+    *temperature_s = (float)(*temperature_raw) / 65536.0f * 165.0f - 40.5f;            /* convert temperature */
+    *humidity_raw = buf[2] | (uint16_t)(buf[3]) << 8;                                  /* get humidity */
+    *humidity_s = (float)(*humidity_raw) / 65536.0f * 100.0f;                          /* convert humidity */
+    a_hdc2080_unlock(handle);                                                          /* unlock */
+    
+    return 0;                                                                          /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      try to fetch the result of a triggered measurement in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_centi pointer to a temperature buffer in 0.01 degrees
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_centi pointer to a humidity buffer in 0.01 percent
+ * @return     status code
+ *             - 0 success
+ *             - 1 try fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 not ready
+ * @note       it never sleeps, the outputs are unchanged when the conversion is not ready
+ */
+uint8_t hdc2080_try_fetch_centi(hdc2080_handle_t *handle, uint16_t *temperature_raw, int16_t *temperature_centi,
+                                uint16_t *humidity_raw, uint16_t *humidity_centi)
 {
     uint8_t res;
     uint8_t prev;
+    uint8_t buf[4];
     
-    if (handle == NULL)                                                  /* check handle */
+    if (handle == NULL)                                                                /* check handle */
     {
-        return 2;                                                        /* return error */
+        return 2;                                                                      /* return error */
     }
-    if (handle->inited != 1)                                             /* check handle initialization */
+    if (handle->inited != 1)                                                           /* check handle initialization */
     {
-        return 3;                                                        /* return error */
+        return 3;                                                                      /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
-    if (res != 0)                                                        /* check result */
+    a_hdc2080_lock(handle);                                                            /* lock */
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);               /* read config */
+    if (res != 0)                                                                      /* check result */
     {
-        handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        handle->debug_print("hdc2080: read config failed.\n");                         /* read config failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
         
-        return 1;                                                        /* return error */
+        return 1;                                                                      /* return error */
     }
-    prev &= ~(7 << 4);                                                   /* clear settings */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_CONF, &prev, 1);       /* write config */
-    if (res != 0)                                                        /* check result */
+    if (((prev >> 0) & 0x01) != 0)                                                     /* check flag */
     {
-        handle->debug_print("hdc2080: write config failed.\n");          /* write config failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
         
-        return 1;                                                        /* return error */
+        return 4;                                                                      /* not ready */
     }
-    if (handle->iic_deinit() != 0)                                       /* iic deinit */
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_LOW, buf, 4);             /* read temperature and humidity */
+    if (res != 0)                                                                      /* check result */
     {
-        handle->debug_print("hdc2080: iic deinit failed.\n");            /* iic deinit failed */
+        handle->debug_print("hdc2080: read temperature and humidity failed.\n");       /* read temperature and humidity failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
         
-        return 1;                                                        /* return error */
+        return 1;                                                                      /* return error */
     }
-    handle->inited = 0;                                                  /* set closed flag */
+    *temperature_raw = buf[0] | (uint16_t)(buf[1]) << 8;                               /* get temperature */
+    *temperature_centi = a_hdc2080_temperature_to_centi(*temperature_raw);             /* convert temperature */
+    *humidity_raw = buf[2] | (uint16_t)(buf[3]) << 8;                                  /* get humidity */
+    *humidity_centi = a_hdc2080_humidity_to_centi(*humidity_raw);                      /* convert humidity */
+    a_hdc2080_unlock(handle);                                                          /* unlock */
     
-    return 0;                                                            /* success return 0 */
+    return 0;                                                                          /* success return 0 */
 }
 
 /**
@@ -356,22 +1051,26 @@ uint8_t hdc2080_set_temperature_resolution(hdc2080_handle_t *handle, hdc2080_res
         return 3;                                                               /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
     prev &= ~(3 << 6);                                                          /* clear settings */
     prev |= resolution << 6;                                                    /* set resolution */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_MEASUREMENT, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_MEASUREMENT, prev);        /* write config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                 /* write config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
+    a_hdc2080_unlock(handle);                                                   /* unlock */
     
     return 0;                                                                   /* success return 0 */
 }
@@ -401,14 +1100,17 @@ uint8_t hdc2080_get_temperature_resolution(hdc2080_handle_t *handle, hdc2080_res
         return 3;                                                               /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
     *resolution = (hdc2080_resolution_t)((prev >> 6) & 0x3);                    /* get resolution */
+    a_hdc2080_unlock(handle);                                                   /* unlock */
     
     return 0;                                                                   /* success return 0 */
 }
@@ -438,22 +1140,26 @@ uint8_t hdc2080_set_humidity_resolution(hdc2080_handle_t *handle, hdc2080_resolu
         return 3;                                                               /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
     prev &= ~(3 << 4);                                                          /* clear settings */
     prev |= resolution << 4;                                                    /* set resolution */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_MEASUREMENT, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_MEASUREMENT, prev);        /* write config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                 /* write config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
+    a_hdc2080_unlock(handle);                                                   /* unlock */
     
     return 0;                                                                   /* success return 0 */
 }
@@ -483,14 +1189,17 @@ uint8_t hdc2080_get_humidity_resolution(hdc2080_handle_t *handle, hdc2080_resolu
         return 3;                                                               /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
     *resolution = (hdc2080_resolution_t)((prev >> 4) & 0x3);                    /* get resolution */
+    a_hdc2080_unlock(handle);                                                   /* unlock */
     
     return 0;                                                                   /* success return 0 */
 }
@@ -520,22 +1229,26 @@ uint8_t hdc2080_set_mode(hdc2080_handle_t *handle, hdc2080_mode_t mode)
         return 3;                                                               /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
     prev &= ~(3 << 1);                                                          /* clear settings */
     prev |= mode << 1;                                                          /* set mode */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_MEASUREMENT, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_MEASUREMENT, prev);        /* write config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                 /* write config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
+    a_hdc2080_unlock(handle);                                                   /* unlock */
     
     return 0;                                                                   /* success return 0 */
 }
@@ -565,14 +1278,17 @@ uint8_t hdc2080_get_mode(hdc2080_handle_t *handle, hdc2080_mode_t *mode)
         return 3;                                                               /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
     *mode = (hdc2080_mode_t)((prev >> 1) & 0x03);                               /* get mode */
+    a_hdc2080_unlock(handle);                                                   /* unlock */
     
     return 0;                                                                   /* success return 0 */
 }
@@ -602,22 +1318,26 @@ uint8_t hdc2080_set_measurement(hdc2080_handle_t *handle, hdc2080_bool_t enable)
         return 3;                                                               /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                     /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);        /* read config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
     prev &= ~(1 << 0);                                                          /* clear settings */
     prev |= enable << 0;                                                        /* set bool */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_MEASUREMENT, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_MEASUREMENT, prev);        /* write config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                 /* write config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
+    a_hdc2080_unlock(handle);                                                   /* unlock */
     
     return 0;                                                                   /* success return 0 */
 }
@@ -647,14 +1367,17 @@ uint8_t hdc2080_get_measurement(hdc2080_handle_t *handle, hdc2080_bool_t *enable
         return 3;                                                               /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                     /* lock */
     res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
     if (res != 0)                                                               /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
+        a_hdc2080_unlock(handle);                                               /* unlock */
         
         return 1;                                                               /* return error */
     }
     *enable = (hdc2080_bool_t)((prev >> 0) & 0x01);                             /* get bool */
+    a_hdc2080_unlock(handle);                                                   /* unlock */
     
     return 0;                                                                   /* success return 0 */
 }
@@ -674,34 +1397,49 @@ uint8_t hdc2080_soft_reset(hdc2080_handle_t *handle)
     uint8_t res;
     uint8_t prev;
     
-    if (handle == NULL)                                                  /* check handle */
+    if (handle == NULL)                                                           /* check handle */
     {
-        return 2;                                                        /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->inited != 1)                                             /* check handle initialization */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        return 3;                                                        /* return error */
+        return 3;                                                                 /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
-    if (res != 0)                                                        /* check result */
+    a_hdc2080_lock(handle);                                                       /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);                 /* read config */
+    if (res != 0)                                                                 /* check result */
     {
-        handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        handle->debug_print("hdc2080: read config failed.\n");                    /* read config failed */
+        a_hdc2080_unlock(handle);                                                 /* unlock */
         
-        return 1;                                                        /* return error */
+        return 1;                                                                 /* return error */
     }
-    prev &= ~(1 << 7);                                                   /* clear settings */
-    prev |= 1 << 7;                                                      /* set soft reset */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_CONF, &prev, 1);       /* write config */
-    if (res != 0)                                                        /* check result */
+    prev &= ~(1 << 7);                                                            /* clear settings */
+    prev |= 1 << 7;                                                               /* set soft reset */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_CONF, prev);                 /* write config */
+    if (res != 0)                                                                 /* check result */
     {
-        handle->debug_print("hdc2080: write config failed.\n");          /* write config failed */
+        handle->debug_print("hdc2080: write config failed.\n");                   /* write config failed */
+        a_hdc2080_unlock(handle);                                                 /* unlock */
         
-        return 1;                                                        /* return error */
+        return 1;                                                                 /* return error */
+    }
+    handle->delay_ms(100);                                                        /* delay 100ms */
+    if (handle->cache_enable != 0)                                                /* check register cache */
+    {
+        res = a_hdc2080_cache_fill(handle);                                       /* fill register cache */
+        if (res != 0)                                                             /* check result */
+        {
+            handle->debug_print("hdc2080: fill register cache failed.\n");        /* fill register cache failed */
+            a_hdc2080_unlock(handle);                                             /* unlock */
+            
+            return 1;                                                             /* return error */
+        }
     }
-    handle->delay_ms(100);                                               /* delay 100ms */
+    a_hdc2080_unlock(handle);                                                     /* unlock */
     
-    return 0;                                                            /* success return 0 */
+    return 0;                                                                     /* success return 0 */
 }
 
 /**
@@ -729,22 +1467,26 @@ uint8_t hdc2080_set_auto_measurement_mode(hdc2080_handle_t *handle, hdc2080_auto
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     prev &= ~(7 << 4);                                                   /* clear settings */
     prev |= mode << 4;                                                   /* set mode */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_CONF, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_CONF, prev);        /* write config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");          /* write config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -774,14 +1516,17 @@ uint8_t hdc2080_get_auto_measurement_mode(hdc2080_handle_t *handle, hdc2080_auto
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     *mode = (hdc2080_auto_measurement_mode_t)((prev >> 4) & 0x07);       /* get mode */
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -811,22 +1556,26 @@ uint8_t hdc2080_set_heater(hdc2080_handle_t *handle, hdc2080_bool_t enable)
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     prev &= ~(1 << 3);                                                   /* clear settings */
     prev |= enable << 3;                                                 /* set bool */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_CONF, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_CONF, prev);        /* write config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");          /* write config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -856,14 +1605,17 @@ uint8_t hdc2080_get_heater(hdc2080_handle_t *handle, hdc2080_bool_t *enable)
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     *enable = (hdc2080_bool_t)((prev >> 3) & 0x01);                      /* get bool */
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -893,22 +1645,26 @@ uint8_t hdc2080_set_interrupt_pin(hdc2080_handle_t *handle, hdc2080_bool_t enabl
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     prev &= ~(1 << 2);                                                   /* clear settings */
     prev |= enable << 2;                                                 /* set bool */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_CONF, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_CONF, prev);        /* write config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");          /* write config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -938,14 +1694,17 @@ uint8_t hdc2080_get_interrupt_pin(hdc2080_handle_t *handle, hdc2080_bool_t *enab
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     *enable = (hdc2080_bool_t)((prev >> 2) & 0x01);                      /* get bool */
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -975,22 +1734,26 @@ uint8_t hdc2080_set_interrupt_polarity(hdc2080_handle_t *handle, hdc2080_interru
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     prev &= ~(1 << 1);                                                   /* clear settings */
     prev |= polarity << 1;                                               /* set bool */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_CONF, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_CONF, prev);        /* write config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");          /* write config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -1020,14 +1783,17 @@ uint8_t hdc2080_get_interrupt_polarity(hdc2080_handle_t *handle, hdc2080_interru
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     *polarity = (hdc2080_interrupt_polarity_t)((prev >> 1) & 0x01);      /* get bool */
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -1057,22 +1823,26 @@ uint8_t hdc2080_set_interrupt_mode(hdc2080_handle_t *handle, hdc2080_interrupt_m
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     prev &= ~(1 << 0);                                                   /* clear settings */
     prev |= mode << 0;                                                   /* set bool */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_CONF, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_CONF, prev);        /* write config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");          /* write config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -1102,14 +1872,17 @@ uint8_t hdc2080_get_interrupt_mode(hdc2080_handle_t *handle, hdc2080_interrupt_m
         return 3;                                                        /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_CONF, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                              /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_CONF, &prev);        /* read config */
     if (res != 0)                                                        /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");           /* read config failed */
+        a_hdc2080_unlock(handle);                                        /* unlock */
         
         return 1;                                                        /* return error */
     }
     *mode = (hdc2080_interrupt_mode_t)((prev >> 0) & 0x01);              /* get mode */
+    a_hdc2080_unlock(handle);                                            /* unlock */
     
     return 0;                                                            /* success return 0 */
 }
@@ -1139,14 +1912,17 @@ uint8_t hdc2080_set_humidity_high_threshold(hdc2080_handle_t *handle, uint8_t th
         return 3;                                                            /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                  /* lock */
     prev = threshold;                                                        /* set threshold */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_RH_THR_H, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_RH_THR_H, prev);        /* write config */
     if (res != 0)                                                            /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");              /* write config failed */
+        a_hdc2080_unlock(handle);                                            /* unlock */
         
         return 1;                                                            /* return error */
     }
+    a_hdc2080_unlock(handle);                                                /* unlock */
     
     return 0;                                                                /* success return 0 */
 }
@@ -1176,14 +1952,17 @@ uint8_t hdc2080_get_humidity_high_threshold(hdc2080_handle_t *handle, uint8_t *t
         return 3;                                                           /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_RH_THR_H, &prev, 1);       /* read config */
+    a_hdc2080_lock(handle);                                                 /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_RH_THR_H, &prev);       /* read config */
     if (res != 0)                                                           /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");              /* read config failed */
+        a_hdc2080_unlock(handle);                                           /* unlock */
         
         return 1;                                                           /* return error */
     }
     *threshold = prev;                                                      /* set threshold */
+    a_hdc2080_unlock(handle);                                               /* unlock */
     
     return 0;                                                               /* success return 0 */
 }
@@ -1213,14 +1992,17 @@ uint8_t hdc2080_set_humidity_low_threshold(hdc2080_handle_t *handle, uint8_t thr
         return 3;                                                            /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                  /* lock */
     prev = threshold;                                                        /* set threshold */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_RH_THR_L, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_RH_THR_L, prev);        /* write config */
     if (res != 0)                                                            /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");              /* write config failed */
+        a_hdc2080_unlock(handle);                                            /* unlock */
         
         return 1;                                                            /* return error */
     }
+    a_hdc2080_unlock(handle);                                                /* unlock */
     
     return 0;                                                                /* success return 0 */
 }
@@ -1250,14 +2032,17 @@ uint8_t hdc2080_get_humidity_low_threshold(hdc2080_handle_t *handle, uint8_t *th
         return 3;                                                           /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_RH_THR_L, &prev, 1);       /* read config */
+    a_hdc2080_lock(handle);                                                 /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_RH_THR_L, &prev);       /* read config */
     if (res != 0)                                                           /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");              /* read config failed */
+        a_hdc2080_unlock(handle);                                           /* unlock */
         
         return 1;                                                           /* return error */
     }
     *threshold = prev;                                                      /* set threshold */
+    a_hdc2080_unlock(handle);                                               /* unlock */
     
     return 0;                                                               /* success return 0 */
 }
@@ -1287,14 +2072,17 @@ uint8_t hdc2080_set_temperature_high_threshold(hdc2080_handle_t *handle, uint8_t
         return 3;                                                            /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                  /* lock */
     prev = threshold;                                                        /* set threshold */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_TEMP_THR_H, &prev, 1);     /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_TEMP_THR_H, prev);      /* write config */
     if (res != 0)                                                            /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");              /* write config failed */
+        a_hdc2080_unlock(handle);                                            /* unlock */
         
         return 1;                                                            /* return error */
     }
+    a_hdc2080_unlock(handle);                                                /* unlock */
     
     return 0;                                                                /* success return 0 */
 }
@@ -1324,14 +2112,17 @@ uint8_t hdc2080_get_temperature_high_threshold(hdc2080_handle_t *handle, uint8_t
         return 3;                                                           /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMP_THR_H, &prev, 1);     /* read config */
+    a_hdc2080_lock(handle);                                                 /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_TEMP_THR_H, &prev);     /* read config */
     if (res != 0)                                                           /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");              /* read config failed */
+        a_hdc2080_unlock(handle);                                           /* unlock */
         
         return 1;                                                           /* return error */
     }
     *threshold = prev;                                                      /* set threshold */
+    a_hdc2080_unlock(handle);                                               /* unlock */
     
     return 0;                                                               /* success return 0 */
 }
@@ -1361,14 +2152,17 @@ uint8_t hdc2080_set_temperature_low_threshold(hdc2080_handle_t *handle, uint8_t
         return 3;                                                            /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                  /* lock */
     prev = threshold;                                                        /* set threshold */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_TEMP_THR_L, &prev, 1);     /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_TEMP_THR_L, prev);      /* write config */
     if (res != 0)                                                            /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");              /* write config failed */
+        a_hdc2080_unlock(handle);                                            /* unlock */
         
         return 1;                                                            /* return error */
     }
+    a_hdc2080_unlock(handle);                                                /* unlock */
     
     return 0;                                                                /* success return 0 */
 }
@@ -1398,14 +2192,17 @@ uint8_t hdc2080_get_temperature_low_threshold(hdc2080_handle_t *handle, uint8_t
         return 3;                                                           /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMP_THR_L, &prev, 1);     /* read config */
+    a_hdc2080_lock(handle);                                                 /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_TEMP_THR_L, &prev);     /* read config */
     if (res != 0)                                                           /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");              /* read config failed */
+        a_hdc2080_unlock(handle);                                           /* unlock */
         
         return 1;                                                           /* return error */
     }
     *threshold = prev;                                                      /* set threshold */
+    a_hdc2080_unlock(handle);                                               /* unlock */
     
     return 0;                                                               /* success return 0 */
 }
@@ -1435,14 +2232,17 @@ uint8_t hdc2080_set_humidity_offset_adjustment(hdc2080_handle_t *handle, int8_t
         return 3;                                                                   /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                         /* lock */
     prev = (uint8_t)(offset);                                                       /* set offset */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_HUM_OFFSET_ADJUST, &prev, 1);     /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_HUM_OFFSET_ADJUST, prev);      /* write config */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                     /* write config failed */
+        a_hdc2080_unlock(handle);                                                   /* unlock */
         
         return 1;                                                                   /* return error */
     }
+    a_hdc2080_unlock(handle);                                                       /* unlock */
     
     return 0;                                                                       /* success return 0 */
 }
@@ -1472,14 +2272,17 @@ uint8_t hdc2080_get_humidity_offset_adjustment(hdc2080_handle_t *handle, int8_t
         return 3;                                                                   /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_HUM_OFFSET_ADJUST, &prev, 1);      /* read config */
+    a_hdc2080_lock(handle);                                                         /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_HUM_OFFSET_ADJUST, &prev);      /* read config */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                      /* read config failed */
+        a_hdc2080_unlock(handle);                                                   /* unlock */
         
         return 1;                                                                   /* return error */
     }
     *offset = (int8_t)(prev);                                                       /* set offset */
+    a_hdc2080_unlock(handle);                                                       /* unlock */
     
     return 0;                                                                       /* success return 0 */
 }
@@ -1509,14 +2312,17 @@ uint8_t hdc2080_set_temperature_offset_adjustment(hdc2080_handle_t *handle, int8
         return 3;                                                                   /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                         /* lock */
     prev = (uint8_t)(offset);                                                       /* set offset */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_TEMP_OFFSET_ADJUST, &prev, 1);    /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_TEMP_OFFSET_ADJUST, prev);     /* write config */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                     /* write config failed */
+        a_hdc2080_unlock(handle);                                                   /* unlock */
         
         return 1;                                                                   /* return error */
     }
+    a_hdc2080_unlock(handle);                                                       /* unlock */
     
     return 0;                                                                       /* success return 0 */
 }
@@ -1546,14 +2352,17 @@ uint8_t hdc2080_get_temperature_offset_adjustment(hdc2080_handle_t *handle, int8
         return 3;                                                                   /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMP_OFFSET_ADJUST, &prev, 1);     /* read config */
+    a_hdc2080_lock(handle);                                                         /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_TEMP_OFFSET_ADJUST, &prev);     /* read config */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                      /* read config failed */
+        a_hdc2080_unlock(handle);                                                   /* unlock */
         
         return 1;                                                                   /* return error */
     }
     *offset = (int8_t)(prev);                                                       /* set offset */
+    a_hdc2080_unlock(handle);                                                       /* unlock */
     
     return 0;                                                                       /* success return 0 */
 }
@@ -1584,22 +2393,26 @@ uint8_t hdc2080_set_interrupt(hdc2080_handle_t *handle, hdc2080_interrupt_t inte
         return 3;                                                                    /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_INTERRUPT_ENABLE, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                          /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_INTERRUPT_ENABLE, &prev);        /* read config */
     if (res != 0)                                                                    /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                       /* read config failed */
+        a_hdc2080_unlock(handle);                                                    /* unlock */
         
         return 1;                                                                    /* return error */
     }
     prev &= ~(1 << interrupt);                                                       /* clear settings */
     prev |= enable << interrupt;                                                     /* set bool */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_INTERRUPT_ENABLE, &prev, 1);       /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_INTERRUPT_ENABLE, prev);        /* write config */
     if (res != 0)                                                                    /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                      /* write config failed */
+        a_hdc2080_unlock(handle);                                                    /* unlock */
         
         return 1;                                                                    /* return error */
     }
+    a_hdc2080_unlock(handle);                                                        /* unlock */
     
     return 0;                                                                        /* success return 0 */
 }
@@ -1630,14 +2443,17 @@ uint8_t hdc2080_get_interrupt(hdc2080_handle_t *handle, hdc2080_interrupt_t inte
         return 3;                                                                    /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_INTERRUPT_ENABLE, &prev, 1);        /* read config */
+    a_hdc2080_lock(handle);                                                          /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_INTERRUPT_ENABLE, &prev);        /* read config */
     if (res != 0)                                                                    /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                       /* read config failed */
+        a_hdc2080_unlock(handle);                                                    /* unlock */
         
         return 1;                                                                    /* return error */
     }
     *enable = (hdc2080_bool_t)((prev >> interrupt) & 0x01);                          /* get bool */
+    a_hdc2080_unlock(handle);                                                        /* unlock */
     
     return 0;                                                                        /* success return 0 */
 }
@@ -1667,14 +2483,17 @@ uint8_t hdc2080_set_humidity_max(hdc2080_handle_t *handle, uint8_t max)
         return 3;                                                                 /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                       /* lock */
     prev = max;                                                                   /* set max */
     res = a_hdc2080_iic_write(handle, HDC2080_REG_HUMIDITY_MAX, &prev, 1);        /* write config */
     if (res != 0)                                                                 /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                   /* write config failed */
+        a_hdc2080_unlock(handle);                                                 /* unlock */
         
         return 1;                                                                 /* return error */
     }
+    a_hdc2080_unlock(handle);                                                     /* unlock */
     
     return 0;                                                                     /* success return 0 */
 }
@@ -1704,14 +2523,17 @@ uint8_t hdc2080_get_humidity_max(hdc2080_handle_t *handle, uint8_t *max)
         return 3;                                                                /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                      /* lock */
     res = a_hdc2080_iic_read(handle, HDC2080_REG_HUMIDITY_MAX, &prev, 1);        /* read config */
     if (res != 0)                                                                /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                   /* read config failed */
+        a_hdc2080_unlock(handle);                                                /* unlock */
         
         return 1;                                                                /* return error */
     }
     *max = prev;                                                                 /* get max */
+    a_hdc2080_unlock(handle);                                                    /* unlock */
     
     return 0;                                                                    /* success return 0 */
 }
@@ -1741,14 +2563,17 @@ uint8_t hdc2080_set_temperature_max(hdc2080_handle_t *handle, uint8_t max)
         return 3;                                                                    /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                          /* lock */
     prev = max;                                                                      /* set max */
     res = a_hdc2080_iic_write(handle, HDC2080_REG_TEMPERATURE_MAX, &prev, 1);        /* write config */
     if (res != 0)                                                                    /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                      /* write config failed */
+        a_hdc2080_unlock(handle);                                                    /* unlock */
         
         return 1;                                                                    /* return error */
     }
+    a_hdc2080_unlock(handle);                                                        /* unlock */
     
     return 0;                                                                        /* success return 0 */
 }
@@ -1778,14 +2603,17 @@ uint8_t hdc2080_get_temperature_max(hdc2080_handle_t *handle, uint8_t *max)
         return 3;                                                                   /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                         /* lock */
     res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_MAX, &prev, 1);        /* read config */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                      /* read config failed */
+        a_hdc2080_unlock(handle);                                                   /* unlock */
         
         return 1;                                                                   /* return error */
     }
     *max = prev;                                                                    /* get max */
+    a_hdc2080_unlock(handle);                                                       /* unlock */
     
     return 0;                                                                       /* success return 0 */
 }
@@ -1815,18 +2643,22 @@ uint8_t hdc2080_get_interrupt_status(hdc2080_handle_t *handle, uint8_t *status)
         return 3;                                                                  /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                        /* lock */
     res = a_hdc2080_iic_read(handle, HDC2080_REG_INTERRUPT_DRDY, &prev, 1);        /* read config */
     if (res != 0)                                                                  /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                     /* read config failed */
+        a_hdc2080_unlock(handle);                                                  /* unlock */
         
         return 1;                                                                  /* return error */
     }
     *status = prev;                                                                /* get status */
+    a_hdc2080_unlock(handle);                                                      /* unlock */
     
     return 0;                                                                      /* success return 0 */
 }
 
+#if (HDC2080_USE_FLOAT == 1)
 /**
  * @brief      convert the humidity to the register raw data
  * @param[in]  *handle pointer to an hdc2080 handle structure
@@ -2061,7 +2893,7 @@ uint8_t hdc2080_read_temperature_humidity(hdc2080_handle_t *handle, uint16_t *te
                                           uint16_t *humidity_raw, float *humidity_s)
 {
     uint8_t res;
-    uint8_t buf[2];
+    uint8_t buf[4];
     
     if (handle == NULL)                                                                /* check handle */
     {
@@ -2072,28 +2904,165 @@ uint8_t hdc2080_read_temperature_humidity(hdc2080_handle_t *handle, uint16_t *te
         return 3;                                                                      /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_LOW, buf, 2);             /* read temperature */
+    a_hdc2080_lock(handle);                                                            /* lock */
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_LOW, buf, 4);             /* read temperature and humidity */
     if (res != 0)                                                                      /* check result */
     {
-        handle->debug_print("hdc2080: read temperature failed.\n");                    /* read temperature failed */
+        handle->debug_print("hdc2080: read temperature and humidity failed.\n");       /* read temperature and humidity failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
         
         return 1;                                                                      /* return error */
     }
     *temperature_raw = buf[0] | (uint16_t)(buf[1]) << 8;                               /* get temperature */
     *temperature_s = (float)(*temperature_raw) / 65536.0f * 165.0f - 40.5f;            /* convert temperature */
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_HUMIDITY_LOW, buf, 2);                /* read humidity */
-    if (res != 0)                                                                      /* check result */
+    *humidity_raw = buf[2] | (uint16_t)(buf[3]) << 8;                                  /* get humidity */
+    *humidity_s = (float)(*humidity_raw) / 65536.0f * 100.0f;                          /* convert humidity */
+    a_hdc2080_unlock(handle);                                                          /* unlock */
+    
+    return 0;                                                                          /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      decode the registers 0x00 - 0x06
+ * @param[in]  *buf pointer to a register buffer
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @note       none
+ */
+static void a_hdc2080_snapshot_decode(uint8_t *buf, hdc2080_snapshot_t *snapshot)
+{
+    snapshot->temperature_raw = buf[0] | (uint16_t)(buf[1]) << 8;                                    /* get temperature */
+    snapshot->temperature_centi = a_hdc2080_temperature_to_centi(snapshot->temperature_raw);         /* convert temperature */
+    snapshot->humidity_raw = buf[2] | (uint16_t)(buf[3]) << 8;                                       /* get humidity */
+    snapshot->humidity_centi = a_hdc2080_humidity_to_centi(snapshot->humidity_raw);                  /* convert humidity */
+#if (HDC2080_USE_FLOAT == 1)
+    snapshot->temperature_s = (float)(snapshot->temperature_raw) / 65536.0f * 165.0f - 40.5f;        /* convert temperature */
+    snapshot->humidity_s = (float)(snapshot->humidity_raw) / 65536.0f * 100.0f;                      /* convert humidity */
+#endif
+    snapshot->status = buf[4];                                                                       /* get status */
+    snapshot->temperature_max = buf[5];                                                              /* get temperature max */
+    snapshot->humidity_max = buf[6];                                                                 /* get humidity max */
+}
+
+/**
+ * @brief      read the data, status and max registers in one transaction
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read snapshot failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reading the status register clears the interrupt flags
+ */
+uint8_t hdc2080_read_snapshot(hdc2080_handle_t *handle, hdc2080_snapshot_t *snapshot)
+{
+    uint8_t res;
+    uint8_t buf[7];
+    
+    if (handle == NULL)                                                                              /* check handle */
     {
-        handle->debug_print("hdc2080: read humidity failed.\n");                       /* read humidity failed */
+        return 2;                                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                                         /* check handle initialization */
+    {
+        return 3;                                                                                    /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                                          /* lock */
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_LOW, buf, 7);                           /* read 0x00 - 0x06 */
+    if (res != 0)                                                                                    /* check result */
+    {
+        handle->debug_print("hdc2080: read snapshot failed.\n");                                     /* read snapshot failed */
+        a_hdc2080_unlock(handle);                                                                    /* unlock */
         
-        return 1;                                                                      /* return error */
+        return 1;                                                                                    /* return error */
     }
-    *humidity_raw = buf[0] | (uint16_t)(buf[1]) << 8;                                  /* get humidity */
-    *humidity_s = (float)(*humidity_raw) / 65536.0f * 100.0f;                          /* convert humidity */
+    a_hdc2080_snapshot_decode(buf, snapshot);                                                        /* decode the snapshot */
+    a_hdc2080_unlock(handle);                                                                        /* unlock */
     
-    return 0;                                                                          /* success return 0 */
+    return 0;                                                                                        /* success return 0 */
+}
+
+
+/**
+ * @brief      read the data, status and max registers of several sensors in one batched transfer
+ * @param[in]  **handle pointer to an hdc2080 handle table
+ * @param[in]  num handle table length
+ * @param[out] *snapshot pointer to a snapshot table
+ * @return     status code
+ *             - 0 success
+ *             - 1 read all failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 num is invalid
+ * @note       the handles must share one bus, the iic_read_batch function of the first handle carries
+ *             all reads, without it the sensors are read one after another
+ */
+uint8_t hdc2080_read_all(hdc2080_handle_t **handle, uint8_t num, hdc2080_snapshot_t *snapshot)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t buf[HDC2080_READ_ALL_MAX][7];
+    hdc2080_iic_batch_t batch[HDC2080_READ_ALL_MAX];
+    
+    if ((handle == NULL) || (snapshot == NULL))                                                 /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if ((num == 0) || (num > HDC2080_READ_ALL_MAX))                                             /* check num */
+    {
+        return 4;                                                                               /* return error */
+    }
+    for (i = 0; i < num; i++)                                                                   /* check all handles */
+    {
+        if (handle[i] == NULL)                                                                  /* check handle */
+        {
+            return 2;                                                                           /* return error */
+        }
+        if (handle[i]->inited != 1)                                                             /* check handle initialization */
+        {
+            return 3;                                                                           /* return error */
+        }
+    }
+    
+    a_hdc2080_lock(handle[0]);                                                                  /* lock the shared bus */
+    if (handle[0]->iic_read_batch != NULL)                                                      /* check the batch read */
+    {
+        for (i = 0; i < num; i++)                                                               /* fill the batch */
+        {
+            batch[i].addr = handle[i]->iic_addr;                                                /* set address */
+            batch[i].reg = HDC2080_REG_TEMPERATURE_LOW;                                         /* read 0x00 - 0x06 */
+            batch[i].buf = buf[i];                                                              /* set buffer */
+            batch[i].len = 7;                                                                   /* set length */
+        }
+        res = handle[0]->iic_read_batch(handle[0]->ctx, batch, num);                            /* read all in one call */
+    }
+    else
+    {
+        res = 0;                                                                                /* init 0 */
+        for (i = 0; (i < num) && (res == 0); i++)                                               /* read one by one */
+        {
+            res = a_hdc2080_iic_read(handle[i], HDC2080_REG_TEMPERATURE_LOW, buf[i], 7);        /* read 0x00 - 0x06 */
+        }
+    }
+    if (res != 0)                                                                               /* check result */
+    {
+        handle[0]->debug_print("hdc2080: read all failed.\n");                                  /* read all failed */
+        a_hdc2080_unlock(handle[0]);                                                            /* unlock */
+        
+        return 1;                                                                               /* return error */
+    }
+    a_hdc2080_unlock(handle[0]);                                                                /* unlock */
+    for (i = 0; i < num; i++)                                                                   /* decode all */
+    {
+        a_hdc2080_snapshot_decode(buf[i], &snapshot[i]);                                        /* decode the snapshot */
+    }
+    
+    return 0;                                                                                   /* success return 0 */
 }
 
+#if (HDC2080_USE_FLOAT == 1)
 /**
  * @brief      read the temperature
  * @param[in]  *handle pointer to an hdc2080 handle structure
@@ -2120,15 +3089,18 @@ uint8_t hdc2080_read_temperature(hdc2080_handle_t *handle, uint16_t *temperature
         return 3;                                                                      /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                            /* lock */
     res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_LOW, buf, 2);             /* read temperature */
     if (res != 0)                                                                      /* check result */
     {
         handle->debug_print("hdc2080: read temperature failed.\n");                    /* read temperature failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
         
         return 1;                                                                      /* return error */
     }
     *temperature_raw = buf[0] | (uint16_t)(buf[1]) << 8;                               /* get temperature */
     *temperature_s = (float)(*temperature_raw) / 65536.0f * 165.0f - 40.5f;            /* convert temperature */
+    a_hdc2080_unlock(handle);                                                          /* unlock */
     
     return 0;                                                                          /* success return 0 */
 }
@@ -2159,15 +3131,150 @@ uint8_t hdc2080_read_humidity(hdc2080_handle_t *handle, uint16_t *humidity_raw,
         return 3;                                                                      /* return error */
     }
     
+    a_hdc2080_lock(handle);                                                            /* lock */
     res = a_hdc2080_iic_read(handle, HDC2080_REG_HUMIDITY_LOW, buf, 2);                /* read humidity */
     if (res != 0)                                                                      /* check result */
     {
         handle->debug_print("hdc2080: read humidity failed.\n");                       /* read humidity failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
         
         return 1;                                                                      /* return error */
     }
     *humidity_raw = buf[0] | (uint16_t)(buf[1]) << 8;                                  /* get humidity */
     *humidity_s = (float)(*humidity_raw) / 65536.0f * 100.0f;                          /* convert humidity */
+    a_hdc2080_unlock(handle);                                                          /* unlock */
+    
+    return 0;                                                                          /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      read the temperature and humidity data in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_centi pointer to a temperature buffer in 0.01 degrees
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_centi pointer to a humidity buffer in 0.01 percent
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature humidity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only integer multiply and shift are used
+ */
+uint8_t hdc2080_read_temperature_humidity_centi(hdc2080_handle_t *handle, uint16_t *temperature_raw, int16_t *temperature_centi,
+                                                uint16_t *humidity_raw, uint16_t *humidity_centi)
+{
+    uint8_t res;
+    uint8_t buf[4];
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                            /* lock */
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_LOW, buf, 4);             /* read temperature and humidity */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("hdc2080: read temperature and humidity failed.\n");       /* read temperature and humidity failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
+        
+        return 1;                                                                      /* return error */
+    }
+    *temperature_raw = buf[0] | (uint16_t)(buf[1]) << 8;                               /* get temperature */
+    *temperature_centi = a_hdc2080_temperature_to_centi(*temperature_raw);             /* convert temperature */
+    *humidity_raw = buf[2] | (uint16_t)(buf[3]) << 8;                                  /* get humidity */
+    *humidity_centi = a_hdc2080_humidity_to_centi(*humidity_raw);                      /* convert humidity */
+    a_hdc2080_unlock(handle);                                                          /* unlock */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      read the temperature data in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_centi pointer to a temperature buffer in 0.01 degrees
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only integer multiply and shift are used
+ */
+uint8_t hdc2080_read_temperature_centi(hdc2080_handle_t *handle, uint16_t *temperature_raw, int16_t *temperature_centi)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                            /* lock */
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_TEMPERATURE_LOW, buf, 2);             /* read temperature */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("hdc2080: read temperature failed.\n");                    /* read temperature failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
+        
+        return 1;                                                                      /* return error */
+    }
+    *temperature_raw = buf[0] | (uint16_t)(buf[1]) << 8;                               /* get temperature */
+    *temperature_centi = a_hdc2080_temperature_to_centi(*temperature_raw);             /* convert temperature */
+    a_hdc2080_unlock(handle);                                                          /* unlock */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      read the humidity data in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_centi pointer to a humidity buffer in 0.01 percent
+ * @return     status code
+ *             - 0 success
+ *             - 1 read humidity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only integer multiply and shift are used
+ */
+uint8_t hdc2080_read_humidity_centi(hdc2080_handle_t *handle, uint16_t *humidity_raw, uint16_t *humidity_centi)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    a_hdc2080_lock(handle);                                                            /* lock */
+    res = a_hdc2080_iic_read(handle, HDC2080_REG_HUMIDITY_LOW, buf, 2);                /* read humidity */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("hdc2080: read humidity failed.\n");                       /* read humidity failed */
+        a_hdc2080_unlock(handle);                                                      /* unlock */
+        
+        return 1;                                                                      /* return error */
+    }
+    *humidity_raw = buf[0] | (uint16_t)(buf[1]) << 8;                                  /* get humidity */
+    *humidity_centi = a_hdc2080_humidity_to_centi(*humidity_raw);                      /* convert humidity */
+    a_hdc2080_unlock(handle);                                                          /* unlock */
     
     return 0;                                                                          /* success return 0 */
 }
@@ -2181,14 +3288,16 @@ uint8_t hdc2080_read_humidity(hdc2080_handle_t *handle, uint16_t *humidity_raw,
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 read timeout
- * @note      none
+ * @note      it waits the conversion time of the configured resolution and mode,
+ *            then polls the trigger bit with a doubling backoff
  */
 uint8_t hdc2080_read_poll(hdc2080_handle_t *handle)
 {
     uint8_t res;
     uint8_t prev;
-    uint32_t i;
-    uint32_t timeout = 500;
+    uint32_t wait_us;
+    uint32_t backoff_us;
+    uint32_t timeout_us = 5000000;
     
     if (handle == NULL)                                                             /* check handle */
     {
@@ -2199,25 +3308,33 @@ uint8_t hdc2080_read_poll(hdc2080_handle_t *handle)
         return 3;                                                                   /* return error */
     }
     
-    res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);            /* read config */
+    a_hdc2080_lock(handle);                                                         /* lock */
+    res = a_hdc2080_config_read(handle, HDC2080_REG_MEASUREMENT, &prev);            /* read config */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("hdc2080: read config failed.\n");                      /* read config failed */
+        a_hdc2080_unlock(handle);                                                   /* unlock */
         
         return 1;                                                                   /* return error */
     }
     prev &= ~(1 << 0);                                                              /* clear settings */
     prev |= 1 << 0;                                                                 /* set bool */
-    res = a_hdc2080_iic_write(handle, HDC2080_REG_MEASUREMENT, &prev, 1);           /* write config */
+    res = a_hdc2080_config_write(handle, HDC2080_REG_MEASUREMENT, prev);            /* write config */
+    a_hdc2080_unlock(handle);                                                       /* unlock, the wait does not hold the bus */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("hdc2080: write config failed.\n");                     /* write config failed */
         
         return 1;                                                                   /* return error */
     }
-    for (i = 0; i < timeout; i++)                                                   /* wait */
+    wait_us = a_hdc2080_conversion_time_us(prev);                                   /* get the conversion time */
+    a_hdc2080_delay_us(handle, wait_us);                                            /* wait the conversion */
+    backoff_us = HDC2080_POLL_BACKOFF_MIN_US;                                       /* init backoff */
+    while (1)                                                                       /* wait */
     {
+        a_hdc2080_lock(handle);                                                     /* lock */
         res = a_hdc2080_iic_read(handle, HDC2080_REG_MEASUREMENT, &prev, 1);        /* read config */
+        a_hdc2080_unlock(handle);                                                   /* unlock, the backoff does not hold the bus */
         if (res != 0)                                                               /* check result */
         {
             handle->debug_print("hdc2080: read config failed.\n");                  /* read config failed */
@@ -2228,13 +3345,19 @@ uint8_t hdc2080_read_poll(hdc2080_handle_t *handle)
         {
             break;                                                                  /* break */
         }
-        handle->delay_ms(10);                                                       /* delay 10ms */
-    }
-    if (i >= timeout)                                                               /* check timeout */
-    {
-        handle->debug_print("hdc2080: read timeout.\n");                            /* read timeout */
-        
-        return 4;                                                                   /* return error */
+        if (wait_us >= timeout_us)                                                  /* check timeout */
+        {
+            handle->debug_print("hdc2080: read timeout.\n");                        /* read timeout */
+            
+            return 4;                                                               /* return error */
+        }
+        a_hdc2080_delay_us(handle, backoff_us);                                     /* backoff delay */
+        wait_us += backoff_us;                                                      /* add waited time */
+        backoff_us *= 2;                                                            /* double the backoff */
+        if (backoff_us > HDC2080_POLL_BACKOFF_MAX_US)                               /* check max backoff */
+        {
+            backoff_us = HDC2080_POLL_BACKOFF_MAX_US;                               /* limit backoff */
+        }
     }
     
     return 0;                                                                       /* success return 0 */
@@ -2251,7 +3374,8 @@ uint8_t hdc2080_read_poll(hdc2080_handle_t *handle)
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the register cache is updated with the written data, a soft reset
+ *            written through this function needs hdc2080_set_register_cache to refill the cache
  */
 uint8_t hdc2080_set_reg(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
@@ -2264,14 +3388,20 @@ uint8_t hdc2080_set_reg(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uin
         return 3;                                            /* return error */
     } 
     
+    a_hdc2080_lock(handle);                                  /* lock */
     if (a_hdc2080_iic_write(handle, reg, buf, len) != 0)     /* write data */
     {
+        a_hdc2080_unlock(handle);                            /* unlock */
+        
         return 1;                                            /* return error */
     }
-    else
+    if (handle->cache_enable != 0)                           /* check register cache */
     {
-        return 0;                                            /* success return 0 */
+        a_hdc2080_cache_sync(handle, reg, buf, len);         /* update cache */
     }
+    a_hdc2080_unlock(handle);                                /* unlock */
+    
+    return 0;                                                /* success return 0 */
 }
 
 /**
@@ -2289,6 +3419,8 @@ uint8_t hdc2080_set_reg(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uin
  */
 uint8_t hdc2080_get_reg(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
+    uint8_t res;
+    
     if (handle == NULL)                                     /* check handle */
     {
         return 2;                                           /* return error */
@@ -2298,7 +3430,10 @@ uint8_t hdc2080_get_reg(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uin
         return 3;                                           /* return error */
     } 
     
-    if (a_hdc2080_iic_read(handle, reg, buf, len) != 0)     /* read data */
+    a_hdc2080_lock(handle);                                 /* lock */
+    res = a_hdc2080_iic_read(handle, reg, buf, len);        /* read data */
+    a_hdc2080_unlock(handle);                               /* unlock */
+    if (res != 0)                                           /* check result */
     {
         return 1;                                           /* return error */
     }
@@ -45,6 +45,22 @@
 extern "C"{
 #endif
 
+/**
+ * @brief hdc2080 float api definition
+ * @note  define HDC2080_USE_FLOAT to 0 to compile out all float apis
+ */
+#ifndef HDC2080_USE_FLOAT
+    #define HDC2080_USE_FLOAT    1        /**< enable float apis */
+#endif
+
+/**
+ * @brief hdc2080 read all max definition
+ * @note  the snapshot buffers of hdc2080_read_all are on the stack
+ */
+#ifndef HDC2080_READ_ALL_MAX
+    #define HDC2080_READ_ALL_MAX    16        /**< max sensors of one read all */
+#endif
+
 /**
  * @defgroup hdc2080_driver hdc2080 driver function
  * @brief    hdc2080 driver modules
@@ -138,21 +154,90 @@ typedef enum
     HDC2080_INTERRUPT_MODE_COMPARATOR = 0x01,        /**< comparator mode */
 } hdc2080_interrupt_mode_t;
 
+/**
+ * @brief hdc2080 iic batch entry structure definition
+ */
+typedef struct hdc2080_iic_batch_s
+{
+    uint8_t addr;        /**< iic device write address */
+    uint8_t reg;         /**< iic register address */
+    uint8_t *buf;        /**< pointer to a data buffer */
+    uint16_t len;        /**< length of the data buffer */
+} hdc2080_iic_batch_t;
+
 /**
  * @brief hdc2080 handle structure definition
  */
 typedef struct hdc2080_handle_s
 {
-    uint8_t (*iic_init)(void);                                                         /**< point to an iic_init function address */
-    uint8_t (*iic_deinit)(void);                                                       /**< point to an iic_deinit function address */
-    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_read function address */
-    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);       /**< point to an iic_write function address */
-    void (*delay_ms)(uint32_t ms);                                                     /**< point to a delay_ms function address */
-    void (*debug_print)(const char *const fmt, ...);                                   /**< point to a debug_print function address */
-    uint8_t inited;                                                                    /**< inited flag */
-    uint8_t iic_addr;                                                                  /**< iic address */
+    uint8_t (*iic_init)(void);                                                                         /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void);                                                                       /**< point to an iic_deinit function address */
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);                        /**< point to an iic_read function address */
+    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);                       /**< point to an iic_write function address */
+    uint8_t (*iic_init_ctx)(void *ctx);                                                                /**< point to a context iic_init function address */
+    uint8_t (*iic_deinit_ctx)(void *ctx);                                                              /**< point to a context iic_deinit function address */
+    uint8_t (*iic_read_ctx)(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);         /**< point to a context iic_read function address */
+    uint8_t (*iic_write_ctx)(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to a context iic_write function address */
+    uint8_t (*iic_read_batch)(void *ctx, hdc2080_iic_batch_t *batch, uint16_t num);                    /**< point to an iic_read_batch function address */
+    void *ctx;                                                                                         /**< user context passed to the context functions */
+    void (*delay_ms)(uint32_t ms);                                                                     /**< point to a delay_ms function address */
+    void (*delay_us)(uint32_t us);                                                                     /**< point to a delay_us function address */
+    void (*lock)(void *ctx);                                                                           /**< point to a lock function address */
+    void (*unlock)(void *ctx);                                                                         /**< point to an unlock function address */
+    void (*debug_print)(const char *const fmt, ...);                                                   /**< point to a debug_print function address */
+    uint8_t inited;                                                                                    /**< inited flag */
+    uint8_t iic_addr;                                                                                  /**< iic address */
+    uint8_t cache_enable;                                                                              /**< register cache enable flag */
+    uint8_t cache[9];                                                                                  /**< register 0x07 - 0x0F cache */
 } hdc2080_handle_t;
 
+/**
+ * @brief hdc2080 config structure definition
+ */
+typedef struct hdc2080_config_s
+{
+    hdc2080_bool_t drdy_interrupt;                                   /**< data ready interrupt */
+    hdc2080_bool_t temperature_high_threshold_interrupt;             /**< temperature high threshold interrupt */
+    hdc2080_bool_t temperature_low_threshold_interrupt;              /**< temperature low threshold interrupt */
+    hdc2080_bool_t humidity_high_threshold_interrupt;                /**< humidity high threshold interrupt */
+    hdc2080_bool_t humidity_low_threshold_interrupt;                 /**< humidity low threshold interrupt */
+    int8_t temperature_offset;                                       /**< temperature offset register */
+    int8_t humidity_offset;                                          /**< humidity offset register */
+    uint8_t temperature_low_threshold;                               /**< temperature low threshold register */
+    uint8_t temperature_high_threshold;                              /**< temperature high threshold register */
+    uint8_t humidity_low_threshold;                                  /**< humidity low threshold register */
+    uint8_t humidity_high_threshold;                                 /**< humidity high threshold register */
+    hdc2080_auto_measurement_mode_t auto_measurement_mode;           /**< auto measurement mode */
+    hdc2080_bool_t heater;                                           /**< heater */
+    hdc2080_bool_t interrupt_pin;                                    /**< interrupt pin */
+    hdc2080_interrupt_polarity_t interrupt_polarity;                 /**< interrupt polarity */
+    hdc2080_interrupt_mode_t interrupt_mode;                         /**< interrupt mode */
+    hdc2080_resolution_t temperature_resolution;                     /**< temperature resolution */
+    hdc2080_resolution_t humidity_resolution;                        /**< humidity resolution */
+    hdc2080_mode_t mode;                                             /**< measurement mode */
+    hdc2080_bool_t measurement;                                      /**< start measurement */
+} hdc2080_config_t;
+
+/**
+ * @brief hdc2080 snapshot structure definition
+ */
+typedef struct hdc2080_snapshot_s
+{
+    uint16_t temperature_raw;        /**< temperature raw data */
+    int16_t temperature_centi;       /**< temperature in 0.01 degrees */
+#if (HDC2080_USE_FLOAT == 1)
+    float temperature_s;             /**< temperature in degrees */
+#endif
+    uint16_t humidity_raw;           /**< humidity raw data */
+    uint16_t humidity_centi;         /**< humidity in 0.01 percent */
+#if (HDC2080_USE_FLOAT == 1)
+    float humidity_s;                /**< humidity in percent */
+#endif
+    uint8_t status;                  /**< interrupt and drdy status */
+    uint8_t temperature_max;         /**< temperature max register */
+    uint8_t humidity_max;            /**< humidity max register */
+} hdc2080_snapshot_t;
+
 /**
  * @brief hdc2080 information structure definition
  */
@@ -220,6 +305,54 @@ typedef struct hdc2080_info_s
  */
 #define DRIVER_HDC2080_LINK_IIC_WRITE(HANDLE, FUC)             (HANDLE)->iic_write = FUC
 
+/**
+ * @brief     link the user context
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] CTX pointer to a user context
+ * @note      it is passed as the first argument of the context functions
+ */
+#define DRIVER_HDC2080_LINK_CONTEXT(HANDLE, CTX)                (HANDLE)->ctx = CTX
+
+/**
+ * @brief     link iic_init function with the user context
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] FUC pointer to a context iic_init function address
+ * @note      it is used instead of iic_init when linked
+ */
+#define DRIVER_HDC2080_LINK_IIC_INIT_CTX(HANDLE, FUC)           (HANDLE)->iic_init_ctx = FUC
+
+/**
+ * @brief     link iic_deinit function with the user context
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] FUC pointer to a context iic_deinit function address
+ * @note      it is used instead of iic_deinit when linked
+ */
+#define DRIVER_HDC2080_LINK_IIC_DEINIT_CTX(HANDLE, FUC)         (HANDLE)->iic_deinit_ctx = FUC
+
+/**
+ * @brief     link iic_read function with the user context
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] FUC pointer to a context iic_read function address
+ * @note      it is used instead of iic_read when linked
+ */
+#define DRIVER_HDC2080_LINK_IIC_READ_CTX(HANDLE, FUC)           (HANDLE)->iic_read_ctx = FUC
+
+/**
+ * @brief     link iic_write function with the user context
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] FUC pointer to a context iic_write function address
+ * @note      it is used instead of iic_write when linked
+ */
+#define DRIVER_HDC2080_LINK_IIC_WRITE_CTX(HANDLE, FUC)          (HANDLE)->iic_write_ctx = FUC
+
+/**
+ * @brief     link iic_read_batch function
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] FUC pointer to an iic_read_batch function address
+ * @note      optional, it is called with the user context and carries all reads of hdc2080_read_all
+ */
+#define DRIVER_HDC2080_LINK_IIC_READ_BATCH(HANDLE, FUC)         (HANDLE)->iic_read_batch = FUC
+
 /**
  * @brief     link delay_ms function
  * @param[in] HANDLE pointer to an hdc2080 handle structure
@@ -228,6 +361,31 @@ typedef struct hdc2080_info_s
  */
 #define DRIVER_HDC2080_LINK_DELAY_MS(HANDLE, FUC)              (HANDLE)->delay_ms = FUC
 
+/**
+ * @brief     link delay_us function
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] FUC pointer to a delay_us function address
+ * @note      optional, delay_ms is used with a rounded up time when not linked
+ */
+#define DRIVER_HDC2080_LINK_DELAY_US(HANDLE, FUC)              (HANDLE)->delay_us = FUC
+
+/**
+ * @brief     link lock function
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] FUC pointer to a lock function address
+ * @note      optional, it gets the user context and is held around every bus operation,
+ *            link the same function to the handles on one bus to share a bus lock
+ */
+#define DRIVER_HDC2080_LINK_LOCK(HANDLE, FUC)                  (HANDLE)->lock = FUC
+
+/**
+ * @brief     link unlock function
+ * @param[in] HANDLE pointer to an hdc2080 handle structure
+ * @param[in] FUC pointer to an unlock function address
+ * @note      optional, it must be linked together with the lock function
+ */
+#define DRIVER_HDC2080_LINK_UNLOCK(HANDLE, FUC)                (HANDLE)->unlock = FUC
+
 /**
  * @brief     link debug_print function
  * @param[in] HANDLE pointer to an hdc2080 handle structure
@@ -290,6 +448,7 @@ uint8_t hdc2080_get_addr_pin(hdc2080_handle_t *handle, hdc2080_address_t *addr_p
  *            - 4 read id failed
  *            - 5 id is invalid
  *            - 6 reset failed
+ *            - 7 fill register cache failed
  * @note      none
  */
 uint8_t hdc2080_init(hdc2080_handle_t *handle);
@@ -306,6 +465,58 @@ uint8_t hdc2080_init(hdc2080_handle_t *handle);
  */
 uint8_t hdc2080_deinit(hdc2080_handle_t *handle);
 
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set register cache failed
+ *            - 2 handle is NULL
+ * @note      the cache keeps a write-through copy of the registers 0x07 - 0x0F,
+ *            it can be enabled before hdc2080_init and is filled during the init
+ */
+uint8_t hdc2080_set_register_cache(hdc2080_handle_t *handle, hdc2080_bool_t enable);
+
+/**
+ * @brief      get the register cache status
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t hdc2080_get_register_cache(hdc2080_handle_t *handle, hdc2080_bool_t *enable);
+
+/**
+ * @brief     apply a whole configuration
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply config failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 config is NULL
+ * @note      the registers 0x07 - 0x0F are written in one burst transaction
+ */
+uint8_t hdc2080_apply_config(hdc2080_handle_t *handle, const hdc2080_config_t *config);
+
+/**
+ * @brief      get the whole configuration
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get config failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the registers 0x07 - 0x0F are read in one burst transaction or from the register cache
+ */
+uint8_t hdc2080_get_config(hdc2080_handle_t *handle, hdc2080_config_t *config);
+
+#if (HDC2080_USE_FLOAT == 1)
 /**
  * @brief      read the temperature and humidity data
  * @param[in]  *handle pointer to an hdc2080 handle structure
@@ -322,7 +533,38 @@ uint8_t hdc2080_deinit(hdc2080_handle_t *handle);
  */
 uint8_t hdc2080_read_temperature_humidity(hdc2080_handle_t *handle, uint16_t *temperature_raw, float *temperature_s,
                                           uint16_t *humidity_raw, float *humidity_s);
+#endif
 
+/**
+ * @brief      read the data, status and max registers in one transaction
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read snapshot failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reading the status register clears the interrupt flags
+ */
+uint8_t hdc2080_read_snapshot(hdc2080_handle_t *handle, hdc2080_snapshot_t *snapshot);
+
+/**
+ * @brief      read the data, status and max registers of several sensors in one batched transfer
+ * @param[in]  **handle pointer to an hdc2080 handle table
+ * @param[in]  num handle table length
+ * @param[out] *snapshot pointer to a snapshot table
+ * @return     status code
+ *             - 0 success
+ *             - 1 read all failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 num is invalid
+ * @note       the handles must share one bus, the iic_read_batch function of the first handle carries
+ *             all reads, without it the sensors are read one after another
+ */
+uint8_t hdc2080_read_all(hdc2080_handle_t **handle, uint8_t num, hdc2080_snapshot_t *snapshot);
+
+#if (HDC2080_USE_FLOAT == 1)
 /**
  * @brief      read the temperature
  * @param[in]  *handle pointer to an hdc2080 handle structure
@@ -350,6 +592,52 @@ uint8_t hdc2080_read_temperature(hdc2080_handle_t *handle, uint16_t *temperature
  * @note       none
  */
 uint8_t hdc2080_read_humidity(hdc2080_handle_t *handle, uint16_t *humidity_raw, float *humidity_s);
+#endif
+
+/**
+ * @brief      read the temperature and humidity data in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_centi pointer to a temperature buffer in 0.01 degrees
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_centi pointer to a humidity buffer in 0.01 percent
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature humidity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only integer multiply and shift are used
+ */
+uint8_t hdc2080_read_temperature_humidity_centi(hdc2080_handle_t *handle, uint16_t *temperature_raw, int16_t *temperature_centi,
+                                                uint16_t *humidity_raw, uint16_t *humidity_centi);
+
+/**
+ * @brief      read the temperature data in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_centi pointer to a temperature buffer in 0.01 degrees
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only integer multiply and shift are used
+ */
+uint8_t hdc2080_read_temperature_centi(hdc2080_handle_t *handle, uint16_t *temperature_raw, int16_t *temperature_centi);
+
+/**
+ * @brief      read the humidity data in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_centi pointer to a humidity buffer in 0.01 percent
+ * @return     status code
+ *             - 0 success
+ *             - 1 read humidity failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only integer multiply and shift are used
+ */
+uint8_t hdc2080_read_humidity_centi(hdc2080_handle_t *handle, uint16_t *humidity_raw, uint16_t *humidity_centi);
 
 /**
  * @brief     read poll
@@ -360,10 +648,74 @@ uint8_t hdc2080_read_humidity(hdc2080_handle_t *handle, uint16_t *humidity_raw,
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 read timeout
- * @note      none
+ * @note      it waits the conversion time of the configured resolution and mode,
+ *            then polls the trigger bit with a doubling backoff
  */
 uint8_t hdc2080_read_poll(hdc2080_handle_t *handle);
 
+/**
+ * @brief     trigger a measurement without waiting
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 trigger measurement failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      use hdc2080_try_fetch to harvest the result
+ */
+uint8_t hdc2080_trigger_measurement(hdc2080_handle_t *handle);
+
+/**
+ * @brief      get the conversion time of the current measurement config
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *us pointer to a conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conversion time failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       typical datasheet time for the resolution and mode
+ */
+uint8_t hdc2080_get_conversion_time(hdc2080_handle_t *handle, uint32_t *us);
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief      try to fetch the result of a triggered measurement
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 try fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 not ready
+ * @note       it never sleeps, the outputs are unchanged when the conversion is not ready
+ */
+uint8_t hdc2080_try_fetch(hdc2080_handle_t *handle, uint16_t *temperature_raw, float *temperature_s,
+                          uint16_t *humidity_raw, float *humidity_s);
+#endif
+
+/**
+ * @brief      try to fetch the result of a triggered measurement in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_centi pointer to a temperature buffer in 0.01 degrees
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_centi pointer to a humidity buffer in 0.01 percent
+ * @return     status code
+ *             - 0 success
+ *             - 1 try fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 not ready
+ * @note       it never sleeps, the outputs are unchanged when the conversion is not ready
+ */
+uint8_t hdc2080_try_fetch_centi(hdc2080_handle_t *handle, uint16_t *temperature_raw, int16_t *temperature_centi,
+                                uint16_t *humidity_raw, uint16_t *humidity_centi);
+
 /**
  * @brief     set temperature resolution
  * @param[in] *handle pointer to an hdc2080 handle structure
@@ -859,6 +1211,7 @@ uint8_t hdc2080_get_temperature_max(hdc2080_handle_t *handle, uint8_t *max);
  */
 uint8_t hdc2080_get_interrupt_status(hdc2080_handle_t *handle, uint8_t *status);
 
+#if (HDC2080_USE_FLOAT == 1)
 /**
  * @brief      convert the humidity to the register raw data
  * @param[in]  *handle pointer to an hdc2080 handle structure
@@ -962,6 +1315,7 @@ uint8_t hdc2080_temperature_offset_convert_to_register(hdc2080_handle_t *handle,
  * @note       none
  */
 uint8_t hdc2080_temperature_offset_convert_to_data(hdc2080_handle_t *handle, int8_t reg, float *deg);
+#endif
 
 /**
  * @}
@@ -985,7 +1339,8 @@ uint8_t hdc2080_temperature_offset_convert_to_data(hdc2080_handle_t *handle, int
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the register cache is updated with the written data, a soft reset
+ *            written through this function needs hdc2080_set_register_cache to refill the cache
  */
 uint8_t hdc2080_set_reg(hdc2080_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len);
 
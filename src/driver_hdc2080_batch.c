@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_batch.c
+ * @brief     driver hdc2080 batch source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_batch.h"
+
+/**
+ * @brief restrict keyword definition
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+    #define HDC2080_RESTRICT restrict             /**< c99 restrict */
+#elif defined(__GNUC__)
+    #define HDC2080_RESTRICT __restrict__         /**< gnu restrict */
+#else
+    #define HDC2080_RESTRICT                      /**< no restrict */
+#endif
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief      convert raw temperature samples to float
+ * @param[in]  *raw pointer to a raw array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       165 / 65536 is exact in float, so the result equals the single sample conversion
+ */
+static void a_hdc2080_temperature_batch(const uint16_t *HDC2080_RESTRICT raw, float *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                          /* convert all */
+    {
+        out[i] = (float)(raw[i]) * (165.0f / 65536.0f) - 40.5f;        /* convert temperature */
+    }
+}
+
+/**
+ * @brief      convert raw humidity samples to float
+ * @param[in]  *raw pointer to a raw array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       100 / 65536 is exact in float, so the result equals the single sample conversion
+ */
+static void a_hdc2080_humidity_batch(const uint16_t *HDC2080_RESTRICT raw, float *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                 /* convert all */
+    {
+        out[i] = (float)(raw[i]) * (100.0f / 65536.0f);       /* convert humidity */
+    }
+}
+#endif
+
+/**
+ * @brief      convert raw temperature samples to centi degrees
+ * @param[in]  *raw pointer to a raw array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       none
+ */
+static void a_hdc2080_temperature_batch_centi(const uint16_t *HDC2080_RESTRICT raw, int16_t *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                                                 /* convert all */
+    {
+        out[i] = (int16_t)((int32_t)(((uint32_t)raw[i] * 16500U + 32768U) >> 16) - 4050);     /* convert temperature */
+    }
+}
+
+/**
+ * @brief      convert raw humidity samples to centi percent
+ * @param[in]  *raw pointer to a raw array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       none
+ */
+static void a_hdc2080_humidity_batch_centi(const uint16_t *HDC2080_RESTRICT raw, uint16_t *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                                  /* convert all */
+    {
+        out[i] = (uint16_t)(((uint32_t)raw[i] * 10000U + 32768U) >> 16);       /* convert humidity */
+    }
+}
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief      convert raw sample arrays to float arrays
+ * @param[in]  *temperature_raw pointer to a raw temperature array
+ * @param[out] *temperature_s pointer to a converted temperature array
+ * @param[in]  *humidity_raw pointer to a raw humidity array
+ * @param[out] *humidity_s pointer to a converted humidity array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       a NULL raw array with a NULL output array is skipped,
+ *             the arrays must not overlap and the loops are written to be auto vectorised
+ */
+uint8_t hdc2080_convert_batch(const uint16_t *temperature_raw, float *temperature_s,
+                              const uint16_t *humidity_raw, float *humidity_s, uint32_t len)
+{
+    if ((temperature_raw == NULL) != (temperature_s == NULL))                /* check temperature buffer */
+    {
+        return 1;                                                            /* return error */
+    }
+    if ((humidity_raw == NULL) != (humidity_s == NULL))                      /* check humidity buffer */
+    {
+        return 1;                                                            /* return error */
+    }
+    
+    if (temperature_raw != NULL)                                             /* check temperature */
+    {
+        a_hdc2080_temperature_batch(temperature_raw, temperature_s, len);    /* convert temperature */
+    }
+    if (humidity_raw != NULL)                                                /* check humidity */
+    {
+        a_hdc2080_humidity_batch(humidity_raw, humidity_s, len);             /* convert humidity */
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      convert raw sample arrays to fixed point arrays
+ * @param[in]  *temperature_raw pointer to a raw temperature array
+ * @param[out] *temperature_centi pointer to a temperature array in 0.01 degrees
+ * @param[in]  *humidity_raw pointer to a raw humidity array
+ * @param[out] *humidity_centi pointer to a humidity array in 0.01 percent
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       a NULL raw array with a NULL output array is skipped,
+ *             the arrays must not overlap and the loops are written to be auto vectorised
+ */
+uint8_t hdc2080_convert_batch_centi(const uint16_t *temperature_raw, int16_t *temperature_centi,
+                                    const uint16_t *humidity_raw, uint16_t *humidity_centi, uint32_t len)
+{
+    if ((temperature_raw == NULL) != (temperature_centi == NULL))                        /* check temperature buffer */
+    {
+        return 1;                                                                        /* return error */
+    }
+    if ((humidity_raw == NULL) != (humidity_centi == NULL))                              /* check humidity buffer */
+    {
+        return 1;                                                                        /* return error */
+    }
+    
+    if (temperature_raw != NULL)                                                         /* check temperature */
+    {
+        a_hdc2080_temperature_batch_centi(temperature_raw, temperature_centi, len);      /* convert temperature */
+    }
+    if (humidity_raw != NULL)                                                            /* check humidity */
+    {
+        a_hdc2080_humidity_batch_centi(humidity_raw, humidity_centi, len);               /* convert humidity */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_batch.h
+ * @brief     driver hdc2080 batch header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC2080_BATCH_H
+#define DRIVER_HDC2080_BATCH_H
+
+#include "driver_hdc2080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc2080_batch_driver hdc2080 batch driver function
+ * @brief    hdc2080 batch driver modules
+ * @ingroup  hdc2080_driver
+ * @{
+ */
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief      convert raw sample arrays to float arrays
+ * @param[in]  *temperature_raw pointer to a raw temperature array
+ * @param[out] *temperature_s pointer to a converted temperature array
+ * @param[in]  *humidity_raw pointer to a raw humidity array
+ * @param[out] *humidity_s pointer to a converted humidity array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       a NULL raw array with a NULL output array is skipped,
+ *             the arrays must not overlap and the loops are written to be auto vectorised
+ */
+uint8_t hdc2080_convert_batch(const uint16_t *temperature_raw, float *temperature_s,
+                              const uint16_t *humidity_raw, float *humidity_s, uint32_t len);
+#endif
+
+/**
+ * @brief      convert raw sample arrays to fixed point arrays
+ * @param[in]  *temperature_raw pointer to a raw temperature array
+ * @param[out] *temperature_centi pointer to a temperature array in 0.01 degrees
+ * @param[in]  *humidity_raw pointer to a raw humidity array
+ * @param[out] *humidity_centi pointer to a humidity array in 0.01 percent
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       a NULL raw array with a NULL output array is skipped,
+ *             the arrays must not overlap and the loops are written to be auto vectorised
+ */
+uint8_t hdc2080_convert_batch_centi(const uint16_t *temperature_raw, int16_t *temperature_centi,
+                                    const uint16_t *humidity_raw, uint16_t *humidity_centi, uint32_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,424 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_change.c
+ * @brief     driver hdc2080 change source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_change.h"
+
+/**
+ * @brief     convert a temperature to the threshold register
+ * @param[in] centi temperature in 0.01 degrees
+ * @return    register raw data
+ * @note      the value is clamped to the register range
+ */
+static uint8_t a_hdc2080_change_temperature_code(int32_t centi)
+{
+    int32_t code;
+    
+    if (centi + 4050 <= 0)                                  /* check the low edge */
+    {
+        return 0;                                           /* return 0 */
+    }
+    code = ((centi + 4050) * 256) / 16500;                  /* (t + 40.5) / 165 * 256 */
+    
+    return (code > 255) ? 255 : (uint8_t)code;              /* return the code */
+}
+
+/**
+ * @brief     convert a humidity to the threshold register
+ * @param[in] centi humidity in 0.01 percent
+ * @return    register raw data
+ * @note      the value is clamped to the register range
+ */
+static uint8_t a_hdc2080_change_humidity_code(int32_t centi)
+{
+    int32_t code;
+    
+    if (centi <= 0)                                         /* check the low edge */
+    {
+        return 0;                                           /* return 0 */
+    }
+    code = (centi * 256) / 10000;                           /* rh / 100 * 256 */
+    
+    return (code > 255) ? 255 : (uint8_t)code;              /* return the code */
+}
+
+/**
+ * @brief     write the changed threshold registers
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @param[in] t_low temperature low threshold register
+ * @param[in] t_high temperature high threshold register
+ * @param[in] h_low humidity low threshold register
+ * @param[in] h_high humidity high threshold register
+ * @return    status code
+ *            - 0 success
+ *            - 1 set threshold failed
+ * @note      all registers are written at the first call
+ */
+static uint8_t a_hdc2080_change_write(hdc2080_change_t *change, uint8_t t_low, uint8_t t_high,
+                                      uint8_t h_low, uint8_t h_high)
+{
+    if ((change->armed == 0) || (t_low != change->temperature_low))                    /* check temperature low */
+    {
+        if (hdc2080_set_temperature_low_threshold(change->handle, t_low) != 0)         /* set temperature low */
+        {
+            change->armed = 0;                                                         /* force a full write */
+            
+            return 1;                                                                  /* return error */
+        }
+        change->temperature_low = t_low;                                               /* save temperature low */
+        change->writes++;                                                              /* count the write */
+    }
+    if ((change->armed == 0) || (t_high != change->temperature_high))                  /* check temperature high */
+    {
+        if (hdc2080_set_temperature_high_threshold(change->handle, t_high) != 0)       /* set temperature high */
+        {
+            change->armed = 0;                                                         /* force a full write */
+            
+            return 1;                                                                  /* return error */
+        }
+        change->temperature_high = t_high;                                             /* save temperature high */
+        change->writes++;                                                              /* count the write */
+    }
+    if ((change->armed == 0) || (h_low != change->humidity_low))                       /* check humidity low */
+    {
+        if (hdc2080_set_humidity_low_threshold(change->handle, h_low) != 0)            /* set humidity low */
+        {
+            change->armed = 0;                                                         /* force a full write */
+            
+            return 1;                                                                  /* return error */
+        }
+        change->humidity_low = h_low;                                                  /* save humidity low */
+        change->writes++;                                                              /* count the write */
+    }
+    if ((change->armed == 0) || (h_high != change->humidity_high))                     /* check humidity high */
+    {
+        if (hdc2080_set_humidity_high_threshold(change->handle, h_high) != 0)          /* set humidity high */
+        {
+            change->armed = 0;                                                         /* force a full write */
+            
+            return 1;                                                                  /* return error */
+        }
+        change->humidity_high = h_high;                                                /* save humidity high */
+        change->writes++;                                                              /* count the write */
+    }
+    change->armed = 1;                                                                 /* flag armed */
+    change->rearms++;                                                                  /* count the re-arm */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the threshold interrupts
+ * @param[in] *handle pointer to an hdc2080 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set interrupt failed
+ * @note      none
+ */
+static uint8_t a_hdc2080_change_interrupt(hdc2080_handle_t *handle, hdc2080_bool_t enable)
+{
+    if (hdc2080_set_interrupt(handle, HDC2080_INTERRUPT_TEMPERATURE_HIGH_THRESHOLD, enable) != 0)        /* set temperature high */
+    {
+        return 1;                                                                                        /* return error */
+    }
+    if (hdc2080_set_interrupt(handle, HDC2080_INTERRUPT_TEMPERATURE_LOW_THRESHOLD, enable) != 0)         /* set temperature low */
+    {
+        return 1;                                                                                        /* return error */
+    }
+    if (hdc2080_set_interrupt(handle, HDC2080_INTERRUPT_HUMIDITY_HIGH_THRESHOLD, enable) != 0)           /* set humidity high */
+    {
+        return 1;                                                                                        /* return error */
+    }
+    if (hdc2080_set_interrupt(handle, HDC2080_INTERRUPT_HUMIDITY_LOW_THRESHOLD, enable) != 0)            /* set humidity low */
+    {
+        return 1;                                                                                        /* return error */
+    }
+    
+    return 0;                                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     init the report on change mode
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @param[in] *handle pointer to an initialized hdc2080 handle
+ * @param[in] temperature_deadband_centi temperature deadband in 0.01 degrees
+ * @param[in] humidity_deadband_centi humidity deadband in 0.01 percent
+ * @return    status code
+ *            - 0 success
+ *            - 1 set interrupt failed
+ *            - 2 change is NULL
+ *            - 4 param is invalid
+ * @note      the four threshold interrupts and the interrupt pin are enabled in level mode and the
+ *            data ready interrupt is disabled, the auto measurement mode is left to the caller,
+ *            the thresholds are 8 bits so the deadband is rounded to 0.64C and 0.39% steps
+ */
+uint8_t hdc2080_change_init(hdc2080_change_t *change, hdc2080_handle_t *handle,
+                            uint16_t temperature_deadband_centi, uint16_t humidity_deadband_centi)
+{
+    if (change == NULL)                                                                   /* check change */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if ((handle == NULL) || (temperature_deadband_centi == 0) ||
+        (humidity_deadband_centi == 0))                                                   /* check params */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    memset(change, 0, sizeof(hdc2080_change_t));                                          /* clear change */
+    if (hdc2080_set_interrupt(handle, HDC2080_INTERRUPT_DRDY, HDC2080_BOOL_FALSE) != 0)   /* disable data ready */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (a_hdc2080_change_interrupt(handle, HDC2080_BOOL_TRUE) != 0)                       /* enable thresholds */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (hdc2080_set_interrupt_mode(handle, HDC2080_INTERRUPT_MODE_LEVEL) != 0)            /* latch the flags */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (hdc2080_set_interrupt_pin(handle, HDC2080_BOOL_TRUE) != 0)                        /* enable the pin */
+    {
+        return 1;                                                                         /* return error */
+    }
+    change->handle = handle;                                                              /* set handle */
+    change->temperature_deadband = temperature_deadband_centi;                            /* set temperature deadband */
+    change->humidity_deadband = humidity_deadband_centi;                                  /* set humidity deadband */
+    change->inited = 1;                                                                   /* flag inited */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     deinit the report on change mode
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set interrupt failed
+ *            - 2 change is NULL
+ *            - 3 change is not initialized
+ * @note      the four threshold interrupts are disabled
+ */
+uint8_t hdc2080_change_deinit(hdc2080_change_t *change)
+{
+    if (change == NULL)                                                           /* check change */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (change->inited != 1)                                                      /* check change initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    
+    if (a_hdc2080_change_interrupt(change->handle, HDC2080_BOOL_FALSE) != 0)      /* disable thresholds */
+    {
+        return 1;                                                                 /* return error */
+    }
+    change->inited = 0;                                                           /* flag closed */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     re-centre the thresholds around a value
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @param[in] temperature_centi temperature in 0.01 degrees
+ * @param[in] humidity_centi humidity in 0.01 percent
+ * @return    status code
+ *            - 0 success
+ *            - 1 set threshold failed
+ *            - 2 change is NULL
+ *            - 3 change is not initialized
+ * @note      only integer multiply and divide are used, a threshold register that keeps its value is
+ *            not written again, a window edge out of the range is clamped so it never fires
+ */
+uint8_t hdc2080_change_rearm_centi(hdc2080_change_t *change, int16_t temperature_centi, uint16_t humidity_centi)
+{
+    if (change == NULL)                                                                                       /* check change */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    if (change->inited != 1)                                                                                  /* check change initialization */
+    {
+        return 3;                                                                                             /* return error */
+    }
+    
+    return a_hdc2080_change_write(change,
+                                  a_hdc2080_change_temperature_code((int32_t)temperature_centi - change->temperature_deadband),
+                                  a_hdc2080_change_temperature_code((int32_t)temperature_centi + change->temperature_deadband),
+                                  a_hdc2080_change_humidity_code((int32_t)humidity_centi - change->humidity_deadband),
+                                  a_hdc2080_change_humidity_code((int32_t)humidity_centi + change->humidity_deadband));  /* write the window */
+}
+
+/**
+ * @brief      read the status and the data and re-arm the thresholds
+ * @param[in]  *change pointer to an hdc2080 change structure
+ * @param[out] *status pointer to a threshold status buffer
+ * @param[out] *temperature_centi pointer to a temperature buffer in 0.01 degrees
+ * @param[out] *humidity_centi pointer to a humidity buffer in 0.01 percent
+ * @return     status code
+ *             - 0 success
+ *             - 1 service failed
+ *             - 2 change is NULL
+ *             - 3 change is not initialized
+ * @note       call it when the interrupt pin fires, the status is masked with HDC2080_CHANGE_INTERRUPT_MASK
+ *             and reading it clears the latched flags
+ */
+uint8_t hdc2080_change_service_centi(hdc2080_change_t *change, uint8_t *status,
+                                     int16_t *temperature_centi, uint16_t *humidity_centi)
+{
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    
+    if (change == NULL)                                                                       /* check change */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (change->inited != 1)                                                                  /* check change initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    
+    if (hdc2080_get_interrupt_status(change->handle, status) != 0)                            /* read and clear the status */
+    {
+        return 1;                                                                             /* return error */
+    }
+    *status &= HDC2080_CHANGE_INTERRUPT_MASK;                                                 /* keep the threshold bits */
+    if (hdc2080_read_temperature_humidity_centi(change->handle, &temperature_raw, temperature_centi,
+                                                &humidity_raw, humidity_centi) != 0)          /* read data */
+    {
+        return 1;                                                                             /* return error */
+    }
+    
+    return hdc2080_change_rearm_centi(change, *temperature_centi, *humidity_centi);           /* re-arm */
+}
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief     re-centre the thresholds around a value
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @param[in] temperature temperature in degrees
+ * @param[in] humidity humidity in percent
+ * @return    status code
+ *            - 0 success
+ *            - 1 set threshold failed
+ *            - 2 change is NULL
+ *            - 3 change is not initialized
+ * @note      the window edges are converted with hdc2080_temperature_convert_to_register and
+ *            hdc2080_humidity_convert_to_register after a clamp to the register range
+ */
+uint8_t hdc2080_change_rearm(hdc2080_change_t *change, float temperature, float humidity)
+{
+    float edge[4];
+    uint8_t reg[4];
+    uint8_t i;
+    
+    if (change == NULL)                                                                              /* check change */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if (change->inited != 1)                                                                         /* check change initialization */
+    {
+        return 3;                                                                                    /* return error */
+    }
+    
+    edge[0] = temperature - (float)change->temperature_deadband / 100.0f;                            /* temperature low */
+    edge[1] = temperature + (float)change->temperature_deadband / 100.0f;                            /* temperature high */
+    edge[2] = humidity - (float)change->humidity_deadband / 100.0f;                                  /* humidity low */
+    edge[3] = humidity + (float)change->humidity_deadband / 100.0f;                                  /* humidity high */
+    for (i = 0; i < 2; i++)                                                                          /* temperature edges */
+    {
+        edge[i] = (edge[i] < -40.5f) ? -40.5f : ((edge[i] > 124.3f) ? 124.3f : edge[i]);            /* clamp to 0 - 255 */
+        if (hdc2080_temperature_convert_to_register(change->handle, edge[i], &reg[i]) != 0)          /* convert */
+        {
+            return 1;                                                                                /* return error */
+        }
+    }
+    for (i = 2; i < 4; i++)                                                                          /* humidity edges */
+    {
+        edge[i] = (edge[i] < 0.0f) ? 0.0f : ((edge[i] > 99.9f) ? 99.9f : edge[i]);                  /* clamp to 0 - 255 */
+        if (hdc2080_humidity_convert_to_register(change->handle, edge[i], &reg[i]) != 0)             /* convert */
+        {
+            return 1;                                                                                /* return error */
+        }
+    }
+    
+    return a_hdc2080_change_write(change, reg[0], reg[1], reg[2], reg[3]);                           /* write the window */
+}
+
+/**
+ * @brief      read the status and the data and re-arm the thresholds
+ * @param[in]  *change pointer to an hdc2080 change structure
+ * @param[out] *status pointer to a threshold status buffer
+ * @param[out] *temperature pointer to a temperature buffer
+ * @param[out] *humidity pointer to a humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service failed
+ *             - 2 change is NULL
+ *             - 3 change is not initialized
+ * @note       call it when the interrupt pin fires, the status is masked with HDC2080_CHANGE_INTERRUPT_MASK
+ *             and reading it clears the latched flags
+ */
+uint8_t hdc2080_change_service(hdc2080_change_t *change, uint8_t *status, float *temperature, float *humidity)
+{
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    
+    if (change == NULL)                                                                       /* check change */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (change->inited != 1)                                                                  /* check change initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    
+    if (hdc2080_get_interrupt_status(change->handle, status) != 0)                            /* read and clear the status */
+    {
+        return 1;                                                                             /* return error */
+    }
+    *status &= HDC2080_CHANGE_INTERRUPT_MASK;                                                 /* keep the threshold bits */
+    if (hdc2080_read_temperature_humidity(change->handle, &temperature_raw, temperature,
+                                          &humidity_raw, humidity) != 0)                      /* read data */
+    {
+        return 1;                                                                             /* return error */
+    }
+    
+    return hdc2080_change_rearm(change, *temperature, *humidity);                             /* re-arm */
+}
+#endif
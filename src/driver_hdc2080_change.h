@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_change.h
+ * @brief     driver hdc2080 change header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC2080_CHANGE_H
+#define DRIVER_HDC2080_CHANGE_H
+
+#include "driver_hdc2080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc2080_change_driver hdc2080 change driver function
+ * @brief    hdc2080 change driver modules
+ * @ingroup  hdc2080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc2080 change threshold interrupt mask definition
+ */
+#define HDC2080_CHANGE_INTERRUPT_MASK    ((1 << HDC2080_INTERRUPT_TEMPERATURE_HIGH_THRESHOLD) | \
+                                          (1 << HDC2080_INTERRUPT_TEMPERATURE_LOW_THRESHOLD) | \
+                                          (1 << HDC2080_INTERRUPT_HUMIDITY_HIGH_THRESHOLD) | \
+                                          (1 << HDC2080_INTERRUPT_HUMIDITY_LOW_THRESHOLD))        /**< threshold bits */
+
+/**
+ * @brief hdc2080 change structure definition
+ */
+typedef struct hdc2080_change_s
+{
+    hdc2080_handle_t *handle;                   /**< initialized hdc2080 handle */
+    uint16_t temperature_deadband;              /**< temperature deadband in 0.01 degrees */
+    uint16_t humidity_deadband;                 /**< humidity deadband in 0.01 percent */
+    uint8_t temperature_low;                    /**< armed temperature low threshold register */
+    uint8_t temperature_high;                   /**< armed temperature high threshold register */
+    uint8_t humidity_low;                       /**< armed humidity low threshold register */
+    uint8_t humidity_high;                      /**< armed humidity high threshold register */
+    uint32_t rearms;                            /**< re-arm times */
+    uint32_t writes;                            /**< threshold register writes */
+    uint8_t armed;                              /**< armed flag */
+    uint8_t inited;                             /**< inited flag */
+} hdc2080_change_t;
+
+/**
+ * @brief     init the report on change mode
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @param[in] *handle pointer to an initialized hdc2080 handle
+ * @param[in] temperature_deadband_centi temperature deadband in 0.01 degrees
+ * @param[in] humidity_deadband_centi humidity deadband in 0.01 percent
+ * @return    status code
+ *            - 0 success
+ *            - 1 set interrupt failed
+ *            - 2 change is NULL
+ *            - 4 param is invalid
+ * @note      the four threshold interrupts and the interrupt pin are enabled in level mode and the
+ *            data ready interrupt is disabled, the auto measurement mode is left to the caller,
+ *            the thresholds are 8 bits so the deadband is rounded to 0.64C and 0.39% steps
+ */
+uint8_t hdc2080_change_init(hdc2080_change_t *change, hdc2080_handle_t *handle,
+                            uint16_t temperature_deadband_centi, uint16_t humidity_deadband_centi);
+
+/**
+ * @brief     deinit the report on change mode
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set interrupt failed
+ *            - 2 change is NULL
+ *            - 3 change is not initialized
+ * @note      the four threshold interrupts are disabled
+ */
+uint8_t hdc2080_change_deinit(hdc2080_change_t *change);
+
+/**
+ * @brief     re-centre the thresholds around a value
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @param[in] temperature_centi temperature in 0.01 degrees
+ * @param[in] humidity_centi humidity in 0.01 percent
+ * @return    status code
+ *            - 0 success
+ *            - 1 set threshold failed
+ *            - 2 change is NULL
+ *            - 3 change is not initialized
+ * @note      only integer multiply and divide are used, a threshold register that keeps its value is
+ *            not written again, a window edge out of the range is clamped so it never fires
+ */
+uint8_t hdc2080_change_rearm_centi(hdc2080_change_t *change, int16_t temperature_centi, uint16_t humidity_centi);
+
+/**
+ * @brief      read the status and the data and re-arm the thresholds
+ * @param[in]  *change pointer to an hdc2080 change structure
+ * @param[out] *status pointer to a threshold status buffer
+ * @param[out] *temperature_centi pointer to a temperature buffer in 0.01 degrees
+ * @param[out] *humidity_centi pointer to a humidity buffer in 0.01 percent
+ * @return     status code
+ *             - 0 success
+ *             - 1 service failed
+ *             - 2 change is NULL
+ *             - 3 change is not initialized
+ * @note       call it when the interrupt pin fires, the status is masked with HDC2080_CHANGE_INTERRUPT_MASK
+ *             and reading it clears the latched flags
+ */
+uint8_t hdc2080_change_service_centi(hdc2080_change_t *change, uint8_t *status,
+                                     int16_t *temperature_centi, uint16_t *humidity_centi);
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief     re-centre the thresholds around a value
+ * @param[in] *change pointer to an hdc2080 change structure
+ * @param[in] temperature temperature in degrees
+ * @param[in] humidity humidity in percent
+ * @return    status code
+ *            - 0 success
+ *            - 1 set threshold failed
+ *            - 2 change is NULL
+ *            - 3 change is not initialized
+ * @note      the window edges are converted with hdc2080_temperature_convert_to_register and
+ *            hdc2080_humidity_convert_to_register after a clamp to the register range
+ */
+uint8_t hdc2080_change_rearm(hdc2080_change_t *change, float temperature, float humidity);
+
+/**
+ * @brief      read the status and the data and re-arm the thresholds
+ * @param[in]  *change pointer to an hdc2080 change structure
+ * @param[out] *status pointer to a threshold status buffer
+ * @param[out] *temperature pointer to a temperature buffer
+ * @param[out] *humidity pointer to a humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service failed
+ *             - 2 change is NULL
+ *             - 3 change is not initialized
+ * @note       call it when the interrupt pin fires, the status is masked with HDC2080_CHANGE_INTERRUPT_MASK
+ *             and reading it clears the latched flags
+ */
+uint8_t hdc2080_change_service(hdc2080_change_t *change, uint8_t *status, float *temperature, float *humidity);
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,406 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_oversample.c
+ * @brief     driver hdc2080 oversample source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_oversample.h"
+
+/**
+ * @brief hdc2080 oversample full scale definition
+ */
+#define HDC2080_OVERSAMPLE_T_SPAN_MILLI        165000        /**< temperature span in 0.001 degrees */
+#define HDC2080_OVERSAMPLE_RH_SPAN_MILLI       100000        /**< humidity span in 0.001 percent */
+
+/**
+ * @brief     integer square root
+ * @param[in] v input
+ * @return    floor(sqrt(v))
+ * @note      none
+ */
+static uint32_t a_hdc2080_oversample_isqrt(uint64_t v)
+{
+    uint64_t r;
+    uint64_t bit;
+    
+    r = 0;                             /* init result */
+    bit = 1ULL << 62;                  /* highest power of 4 */
+    while (bit > v)                    /* find the start */
+    {
+        bit >>= 2;                     /* next power of 4 */
+    }
+    while (bit != 0)                   /* digit by digit */
+    {
+        if (v >= r + bit)              /* check the digit */
+        {
+            v -= r + bit;              /* subtract */
+            r = (r >> 1) + bit;        /* set the digit */
+        }
+        else
+        {
+            r >>= 1;                   /* clear the digit */
+        }
+        bit >>= 2;                     /* next digit */
+    }
+    
+    return (uint32_t)r;                /* return the result */
+}
+
+/**
+ * @brief         get twice the median
+ * @param[in,out] *v pointer to a value array, sorted on return
+ * @param[in]     n array length
+ * @return        2 * median
+ * @note          insertion sort, the arrays are short
+ */
+static int32_t a_hdc2080_oversample_median2(int32_t *v, uint32_t n)
+{
+    uint32_t i;
+    uint32_t j;
+    int32_t x;
+    
+    for (i = 1; i < n; i++)                                                    /* sort */
+    {
+        x = v[i];                                                              /* take the value */
+        for (j = i; (j > 0) && (v[j - 1] > x); j--)                            /* find the place */
+        {
+            v[j] = v[j - 1];                                                   /* shift up */
+        }
+        v[j] = x;                                                              /* insert */
+    }
+    
+    return ((n & 1) != 0) ? (2 * v[n / 2]) : (v[n / 2 - 1] + v[n / 2]);        /* return the result */
+}
+
+/**
+ * @brief     halve with rounding
+ * @param[in] v2 doubled value
+ * @return    v2 / 2 rounded away from zero
+ * @note      none
+ */
+static int32_t a_hdc2080_oversample_half(int32_t v2)
+{
+    return (v2 >= 0) ? ((v2 + 1) / 2) : -((-v2 + 1) / 2);        /* return the result */
+}
+
+/**
+ * @brief      decimate one channel
+ * @param[in]  *v pointer to a shot array in 0.01 units, sorted on return
+ * @param[in]  n array length
+ * @param[in]  span_milli full scale span in 0.001 units
+ * @param[in]  bits resolution bits
+ * @param[in]  filter decimation filter
+ * @param[out] *channel pointer to a channel buffer
+ * @note       none
+ */
+static void a_hdc2080_oversample_channel(int32_t *v, uint32_t n, uint32_t span_milli, uint8_t bits,
+                                         hdc2080_oversample_filter_t filter,
+                                         hdc2080_oversample_channel_centi_t *channel)
+{
+    uint32_t i;
+    int32_t d[HDC2080_OVERSAMPLE_MAX_SHOTS];
+    int32_t med2;
+    int32_t mad4;
+    int64_t sum;
+    int64_t sum2;
+    uint64_t var;
+    uint64_t floor2;
+    uint64_t robust2;
+    uint64_t dev;
+    
+    sum = 0;                                                                      /* init sum */
+    sum2 = 0;                                                                     /* init sum of squares */
+    for (i = 0; i < n; i++)                                                       /* add all */
+    {
+        sum += v[i];                                                              /* add */
+        sum2 += (int64_t)v[i] * v[i];                                             /* add square */
+    }
+    med2 = a_hdc2080_oversample_median2(v, n);                                    /* 2 * median, sorts v */
+    channel->min = v[0];                                                          /* set min */
+    channel->max = v[n - 1];                                                      /* set max */
+    
+    /* robust sigma from the median absolute deviation, 1.4826 * mad in 0.001 units */
+    for (i = 0; i < n; i++)                                                       /* all deviations */
+    {
+        d[i] = (2 * v[i] > med2) ? (2 * v[i] - med2) : (med2 - 2 * v[i]);         /* 2 * |v - median| */
+    }
+    mad4 = a_hdc2080_oversample_median2(d, n);                                    /* 4 * mad */
+    robust2 = (uint64_t)mad4 * 37065 / 10000;                                     /* robust sigma */
+    robust2 = robust2 * robust2;                                                  /* robust variance */
+    
+    /* quantisation noise of one code, q^2 / 12 in 0.001 units */
+    floor2 = (uint64_t)span_milli * span_milli / (12ULL << (2 * bits));
+    
+    if (filter == HDC2080_OVERSAMPLE_FILTER_MEDIAN)                               /* median */
+    {
+        channel->value = a_hdc2080_oversample_half(med2);                         /* set median */
+        var = robust2;                                                            /* robust variance */
+    }
+    else                                                                          /* mean */
+    {
+        channel->value = (int32_t)((sum >= 0) ? ((sum + n / 2) / n) :
+                                   -((-sum + n / 2) / n));                        /* set rounded mean */
+        var = (n > 1) ? (uint64_t)(100 * ((int64_t)n * sum2 - sum * sum) /
+                                   ((int64_t)n * (n - 1))) : 0;                   /* sample variance */
+    }
+    var = (var > floor2) ? var : floor2;                                          /* not below one code */
+    channel->sigma_milli = a_hdc2080_oversample_isqrt(var);                       /* shot noise */
+    if ((filter == HDC2080_OVERSAMPLE_FILTER_MEDIAN) && (n > 2))                  /* median of 3 or more */
+    {
+        channel->noise_milli = a_hdc2080_oversample_isqrt(var * 157 / (100 * (uint64_t)n));        /* sigma * sqrt(pi / 2n) */
+    }
+    else
+    {
+        channel->noise_milli = a_hdc2080_oversample_isqrt(var / n);                                /* sigma / sqrt(n) */
+    }
+    
+    /* outliers lie more than 3 robust sigma and one code from the median */
+    robust2 = (robust2 > floor2) ? robust2 : floor2;                              /* not below one code */
+    channel->outliers = 0;                                                        /* init outliers */
+    for (i = 0; i < n; i++)                                                       /* check all */
+    {
+        dev = (uint64_t)((2 * v[i] > med2) ? (2 * v[i] - med2) : (med2 - 2 * v[i])) * 5;        /* |v - median| in 0.001 units */
+        if ((dev * dev > 9 * robust2) && (dev > (span_milli >> bits)))            /* check the distance */
+        {
+            channel->outliers++;                                                  /* count */
+        }
+    }
+}
+
+/**
+ * @brief      decimate oversampled shots in fixed point
+ * @param[in]  *temperature_centi pointer to a temperature array in 0.01 degrees
+ * @param[in]  *humidity_centi pointer to a humidity array in 0.01 percent
+ * @param[in]  shots array length
+ * @param[in]  resolution resolution of the shots
+ * @param[in]  filter decimation filter
+ * @param[out] *result pointer to an oversample centi buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ *             - 4 param is invalid
+ * @note       the mean filter reports the sample standard deviation as the shot noise and sigma / sqrt(shots)
+ *             as the effective noise, the median filter reports 1.4826 times the median absolute deviation
+ *             and sqrt(pi / 2) times more effective noise, the shot noise is never below the quantisation
+ *             noise of one code, conversion_us is set to 0
+ */
+uint8_t hdc2080_oversample_decimate_centi(const int16_t *temperature_centi, const uint16_t *humidity_centi, uint32_t shots,
+                                          hdc2080_resolution_t resolution, hdc2080_oversample_filter_t filter,
+                                          hdc2080_oversample_centi_t *result)
+{
+    const uint8_t bits[3] = {14, 11, 9};
+    uint32_t i;
+    int32_t v[HDC2080_OVERSAMPLE_MAX_SHOTS];
+    
+    if ((temperature_centi == NULL) || (humidity_centi == NULL) || (result == NULL))                 /* check buffer */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    if ((shots == 0) || (shots > HDC2080_OVERSAMPLE_MAX_SHOTS) ||
+        (resolution > HDC2080_RESOLUTION_9_BIT) || (filter > HDC2080_OVERSAMPLE_FILTER_MEDIAN))      /* check param */
+    {
+        return 4;                                                                                    /* return error */
+    }
+    
+    for (i = 0; i < shots; i++)                                                                      /* copy temperature */
+    {
+        v[i] = temperature_centi[i];                                                                 /* copy */
+    }
+    a_hdc2080_oversample_channel(v, shots, HDC2080_OVERSAMPLE_T_SPAN_MILLI, bits[resolution],
+                                 filter, &result->temperature);                                      /* decimate temperature */
+    for (i = 0; i < shots; i++)                                                                      /* copy humidity */
+    {
+        v[i] = humidity_centi[i];                                                                    /* copy */
+    }
+    a_hdc2080_oversample_channel(v, shots, HDC2080_OVERSAMPLE_RH_SPAN_MILLI, bits[resolution],
+                                 filter, &result->humidity);                                         /* decimate humidity */
+    result->shots = shots;                                                                           /* set shots */
+    result->conversion_us = 0;                                                                       /* no conversion */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      take fast low resolution shots and decimate them in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[in]  resolution resolution of the shots
+ * @param[in]  shots shot number, 1 - HDC2080_OVERSAMPLE_MAX_SHOTS
+ * @param[in]  filter decimation filter
+ * @param[out] *result pointer to an oversample centi buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 param is invalid
+ * @note       both resolutions are set for the shots and restored afterwards, every shot is one
+ *             hdc2080_read_poll conversion, the mode should measure humidity and temperature
+ */
+uint8_t hdc2080_oversample_read_centi(hdc2080_handle_t *handle, hdc2080_resolution_t resolution, uint32_t shots,
+                                      hdc2080_oversample_filter_t filter, hdc2080_oversample_centi_t *result)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t us;
+    uint16_t raw;
+    int16_t t[HDC2080_OVERSAMPLE_MAX_SHOTS];
+    uint16_t h[HDC2080_OVERSAMPLE_MAX_SHOTS];
+    hdc2080_resolution_t temperature_resolution;
+    hdc2080_resolution_t humidity_resolution;
+    
+    if (handle == NULL)                                                                              /* check handle */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                                         /* check handle initialization */
+    {
+        return 3;                                                                                    /* return error */
+    }
+    if ((result == NULL) || (shots == 0) || (shots > HDC2080_OVERSAMPLE_MAX_SHOTS) ||
+        (resolution > HDC2080_RESOLUTION_9_BIT) || (filter > HDC2080_OVERSAMPLE_FILTER_MEDIAN))      /* check param */
+    {
+        return 4;                                                                                    /* return error */
+    }
+    
+    if (hdc2080_get_temperature_resolution(handle, &temperature_resolution) != 0)                    /* save temperature resolution */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    if (hdc2080_get_humidity_resolution(handle, &humidity_resolution) != 0)                          /* save humidity resolution */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    us = 0;                                                                                          /* init time */
+    res = hdc2080_set_temperature_resolution(handle, resolution);                                    /* set temperature resolution */
+    if (res == 0)                                                                                    /* check result */
+    {
+        res = hdc2080_set_humidity_resolution(handle, resolution);                                   /* set humidity resolution */
+    }
+    if (res == 0)                                                                                    /* check result */
+    {
+        res = hdc2080_get_conversion_time(handle, &us);                                              /* get shot time */
+    }
+    for (i = 0; (res == 0) && (i < shots); i++)                                                      /* take the shots */
+    {
+        res = hdc2080_read_poll(handle);                                                             /* convert */
+        if (res == 0)                                                                                /* check result */
+        {
+            res = hdc2080_read_temperature_humidity_centi(handle, &raw, &t[i], &raw, &h[i]);         /* read the shot */
+        }
+    }
+    
+    /* restore the resolutions on every path */
+    if (hdc2080_set_temperature_resolution(handle, temperature_resolution) != 0)                     /* restore temperature resolution */
+    {
+        res = 1;                                                                                     /* set error */
+    }
+    if (hdc2080_set_humidity_resolution(handle, humidity_resolution) != 0)                           /* restore humidity resolution */
+    {
+        res = 1;                                                                                     /* set error */
+    }
+    if (res != 0)                                                                                    /* check result */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    
+    (void)hdc2080_oversample_decimate_centi(t, h, shots, resolution, filter, result);                /* decimate */
+    result->conversion_us = us * shots;                                                              /* set conversion time */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief      convert a fixed point channel
+ * @param[in]  *centi pointer to a fixed point channel
+ * @param[out] *channel pointer to a channel buffer
+ * @note       none
+ */
+static void a_hdc2080_oversample_to_float(const hdc2080_oversample_channel_centi_t *centi,
+                                          hdc2080_oversample_channel_t *channel)
+{
+    channel->value = (float)centi->value / 100.0f;                   /* convert value */
+    channel->min = (float)centi->min / 100.0f;                       /* convert min */
+    channel->max = (float)centi->max / 100.0f;                       /* convert max */
+    channel->sigma = (float)centi->sigma_milli / 1000.0f;            /* convert shot noise */
+    channel->noise = (float)centi->noise_milli / 1000.0f;            /* convert effective noise */
+    channel->outliers = centi->outliers;                             /* copy outliers */
+}
+
+/**
+ * @brief      take fast low resolution shots and decimate them
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[in]  resolution resolution of the shots
+ * @param[in]  shots shot number, 1 - HDC2080_OVERSAMPLE_MAX_SHOTS
+ * @param[in]  filter decimation filter
+ * @param[out] *result pointer to an oversample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 param is invalid
+ * @note       the float form of hdc2080_oversample_read_centi
+ */
+uint8_t hdc2080_oversample_read(hdc2080_handle_t *handle, hdc2080_resolution_t resolution, uint32_t shots,
+                                hdc2080_oversample_filter_t filter, hdc2080_oversample_t *result)
+{
+    uint8_t res;
+    hdc2080_oversample_centi_t centi;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if (result == NULL)                                                                  /* check buffer */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    res = hdc2080_oversample_read_centi(handle, resolution, shots, filter, &centi);      /* read in fixed point */
+    if (res != 0)                                                                        /* check result */
+    {
+        return res;                                                                      /* return error */
+    }
+    a_hdc2080_oversample_to_float(&centi.temperature, &result->temperature);             /* convert temperature */
+    a_hdc2080_oversample_to_float(&centi.humidity, &result->humidity);                   /* convert humidity */
+    result->shots = centi.shots;                                                         /* copy shots */
+    result->conversion_us = centi.conversion_us;                                         /* copy conversion time */
+    
+    return 0;                                                                            /* success return 0 */
+}
+#endif
@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_oversample.h
+ * @brief     driver hdc2080 oversample header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC2080_OVERSAMPLE_H
+#define DRIVER_HDC2080_OVERSAMPLE_H
+
+#include "driver_hdc2080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc2080_oversample_driver hdc2080 oversample driver function
+ * @brief    hdc2080 oversample driver modules
+ * @ingroup  hdc2080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc2080 oversample max shots definition
+ */
+#ifndef HDC2080_OVERSAMPLE_MAX_SHOTS
+    #define HDC2080_OVERSAMPLE_MAX_SHOTS        64        /**< 64 shots */
+#endif
+
+/**
+ * @brief hdc2080 oversample filter enumeration definition
+ */
+typedef enum
+{
+    HDC2080_OVERSAMPLE_FILTER_MEAN   = 0x00,        /**< mean of the shots */
+    HDC2080_OVERSAMPLE_FILTER_MEDIAN = 0x01,        /**< median of the shots, rejects outliers */
+} hdc2080_oversample_filter_t;
+
+/**
+ * @brief hdc2080 oversample fixed point channel structure definition
+ */
+typedef struct hdc2080_oversample_channel_centi_s
+{
+    int32_t value;               /**< decimated value in 0.01 units */
+    int32_t min;                 /**< min shot in 0.01 units */
+    int32_t max;                 /**< max shot in 0.01 units */
+    uint32_t sigma_milli;        /**< noise of one shot in 0.001 units */
+    uint32_t noise_milli;        /**< effective noise of the decimated value in 0.001 units */
+    uint32_t outliers;           /**< shots more than 3 sigma and one code from the median */
+} hdc2080_oversample_channel_centi_t;
+
+/**
+ * @brief hdc2080 oversample fixed point structure definition
+ */
+typedef struct hdc2080_oversample_centi_s
+{
+    hdc2080_oversample_channel_centi_t temperature;     /**< temperature in 0.01 degrees */
+    hdc2080_oversample_channel_centi_t humidity;        /**< humidity in 0.01 percent */
+    uint32_t shots;                                     /**< shot number */
+    uint32_t conversion_us;                             /**< conversion time of all shots */
+} hdc2080_oversample_centi_t;
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief hdc2080 oversample channel structure definition
+ */
+typedef struct hdc2080_oversample_channel_s
+{
+    float value;           /**< decimated value */
+    float min;             /**< min shot */
+    float max;             /**< max shot */
+    float sigma;           /**< noise of one shot */
+    float noise;           /**< effective noise of the decimated value */
+    uint32_t outliers;     /**< shots more than 3 sigma and one code from the median */
+} hdc2080_oversample_channel_t;
+
+/**
+ * @brief hdc2080 oversample structure definition
+ */
+typedef struct hdc2080_oversample_s
+{
+    hdc2080_oversample_channel_t temperature;     /**< temperature in degrees */
+    hdc2080_oversample_channel_t humidity;        /**< humidity in percent */
+    uint32_t shots;                               /**< shot number */
+    uint32_t conversion_us;                       /**< conversion time of all shots */
+} hdc2080_oversample_t;
+#endif
+
+/**
+ * @brief      decimate oversampled shots in fixed point
+ * @param[in]  *temperature_centi pointer to a temperature array in 0.01 degrees
+ * @param[in]  *humidity_centi pointer to a humidity array in 0.01 percent
+ * @param[in]  shots array length
+ * @param[in]  resolution resolution of the shots
+ * @param[in]  filter decimation filter
+ * @param[out] *result pointer to an oversample centi buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ *             - 4 param is invalid
+ * @note       the mean filter reports the sample standard deviation as the shot noise and sigma / sqrt(shots)
+ *             as the effective noise, the median filter reports 1.4826 times the median absolute deviation
+ *             and sqrt(pi / 2) times more effective noise, the shot noise is never below the quantisation
+ *             noise of one code, conversion_us is set to 0
+ */
+uint8_t hdc2080_oversample_decimate_centi(const int16_t *temperature_centi, const uint16_t *humidity_centi, uint32_t shots,
+                                          hdc2080_resolution_t resolution, hdc2080_oversample_filter_t filter,
+                                          hdc2080_oversample_centi_t *result);
+
+/**
+ * @brief      take fast low resolution shots and decimate them in fixed point
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[in]  resolution resolution of the shots
+ * @param[in]  shots shot number, 1 - HDC2080_OVERSAMPLE_MAX_SHOTS
+ * @param[in]  filter decimation filter
+ * @param[out] *result pointer to an oversample centi buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 param is invalid
+ * @note       both resolutions are set for the shots and restored afterwards, every shot is one
+ *             hdc2080_read_poll conversion, the mode should measure humidity and temperature
+ */
+uint8_t hdc2080_oversample_read_centi(hdc2080_handle_t *handle, hdc2080_resolution_t resolution, uint32_t shots,
+                                      hdc2080_oversample_filter_t filter, hdc2080_oversample_centi_t *result);
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief      take fast low resolution shots and decimate them
+ * @param[in]  *handle pointer to an hdc2080 handle structure
+ * @param[in]  resolution resolution of the shots
+ * @param[in]  shots shot number, 1 - HDC2080_OVERSAMPLE_MAX_SHOTS
+ * @param[in]  filter decimation filter
+ * @param[out] *result pointer to an oversample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 param is invalid
+ * @note       the float form of hdc2080_oversample_read_centi
+ */
+uint8_t hdc2080_oversample_read(hdc2080_handle_t *handle, hdc2080_resolution_t resolution, uint32_t shots,
+                                hdc2080_oversample_filter_t filter, hdc2080_oversample_t *result);
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
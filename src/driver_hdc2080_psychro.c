@@ -0,0 +1,683 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_psychro.c
+ * @brief     driver hdc2080 psychro source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_psychro.h"
+
+/**
+ * @brief restrict keyword definition
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+    #define HDC2080_RESTRICT restrict             /**< c99 restrict */
+#elif defined(__GNUC__)
+    #define HDC2080_RESTRICT __restrict__         /**< gnu restrict */
+#else
+    #define HDC2080_RESTRICT                      /**< no restrict */
+#endif
+
+/**
+ * @brief inline keyword definition
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+    #define HDC2080_INLINE static inline          /**< c99 inline */
+#else
+    #define HDC2080_INLINE static                 /**< no inline */
+#endif
+
+/**
+ * @brief psychro formula constant definition
+ */
+#define PSYCHRO_MAGNUS_A             17.62f          /**< magnus a, Sonntag 1990 */
+#define PSYCHRO_MAGNUS_B             243.12f         /**< magnus b in degrees */
+#define PSYCHRO_MAGNUS_E0            6.112f          /**< saturation pressure at 0C in hPa */
+#define PSYCHRO_ABSOLUTE             216.7f          /**< 100000 / Rv in g K / (m3 hPa) */
+#define PSYCHRO_KELVIN               273.15f         /**< 0C in K */
+
+/**
+ * @brief psychro fixed point constant definition
+ */
+#define PSYCHRO_Q30_ONE              (1LL << 30)              /**< q30 one */
+#define PSYCHRO_Q30_LOG2E            1549082005LL             /**< log2(e) in q30 */
+#define PSYCHRO_Q30_LN2              744261118LL              /**< ln(2) in q30 */
+#define PSYCHRO_Q30_LN10000          9889527671LL             /**< ln(10000) in q30 */
+#define PSYCHRO_Q30_MAGNUS_A         18919330939LL            /**< magnus a in q30 */
+#define PSYCHRO_Q30_SQRT2            1518500250LL             /**< sqrt(2) in q30 */
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief     fast exp
+ * @param[in] x input, |x| < 80
+ * @return    exp(x)
+ * @note      2^n times a degree 6 taylor polynomial on |g| <= ln(2) / 2,
+ *            the relative error is below 2e-7 before the float rounding of the steps
+ */
+HDC2080_INLINE float a_hdc2080_psychro_exp(float x)
+{
+    float y;
+    float g;
+    float p;
+    float scale;
+    int32_t n;
+    uint32_t bits;
+    
+    y = x * 1.44269504f;                                                     /* to base 2 */
+    n = (int32_t)(y + ((y >= 0.0f) ? 0.5f : -0.5f));                         /* round to nearest */
+    g = (y - (float)n) * 0.693147181f;                                       /* remainder in base e */
+    p = 1.0f + g * (1.0f + g * (0.5f + g * (1.0f / 6.0f + g * (1.0f / 24.0f +
+        g * (1.0f / 120.0f + g * (1.0f / 720.0f))))));                       /* exp of the remainder */
+    bits = (uint32_t)(n + 127) << 23;                                        /* 2^n */
+    memcpy(&scale, &bits, sizeof(float));                                    /* bit cast */
+    
+    return p * scale;                                                        /* return the result */
+}
+
+/**
+ * @brief     fast log
+ * @param[in] x input, a positive normal number
+ * @return    ln(x)
+ * @note      the mantissa is reduced to [sqrt(2) / 2, sqrt(2)) and the atanh series is cut after s^7,
+ *            the truncation error is below 2e-8
+ */
+HDC2080_INLINE float a_hdc2080_psychro_log(float x)
+{
+    float m;
+    float s;
+    float s2;
+    int32_t e;
+    int32_t big;
+    uint32_t bits;
+    
+    memcpy(&bits, &x, sizeof(float));                                        /* bit cast */
+    e = (int32_t)(bits >> 23) - 127;                                         /* exponent */
+    bits = (bits & 0x007FFFFFU) | 0x3F800000U;                               /* mantissa in [1, 2) */
+    memcpy(&m, &bits, sizeof(float));                                        /* bit cast */
+    big = (m > 1.41421356f) ? 1 : 0;                                         /* check the upper half */
+    m = m * ((big != 0) ? 0.5f : 1.0f);                                      /* reduce */
+    e += big;                                                                /* adjust exponent */
+    s = (m - 1.0f) / (m + 1.0f);                                             /* atanh argument */
+    s2 = s * s;                                                              /* s^2 */
+    
+    return (float)e * 0.693147181f +
+           2.0f * s * (1.0f + s2 * (1.0f / 3.0f + s2 * (1.0f / 5.0f + s2 * (1.0f / 7.0f))));        /* return the result */
+}
+
+/**
+ * @brief     fast square root
+ * @param[in] x input, 0 - 1
+ * @return    sqrt(x)
+ * @note      x times a reciprocal square root from the exponent halving guess and two newton steps,
+ *            the relative error is below 5e-6 and no libm call or errno is involved
+ */
+HDC2080_INLINE float a_hdc2080_psychro_sqrt(float x)
+{
+    float y;
+    uint32_t bits;
+    
+    x = (x < 1e-30f) ? 1e-30f : x;                                           /* keep the guess finite */
+    memcpy(&bits, &x, sizeof(float));                                        /* bit cast */
+    bits = 0x5F3759DFU - (bits >> 1);                                        /* initial guess */
+    memcpy(&y, &bits, sizeof(float));                                        /* bit cast */
+    y = y * (1.5f - 0.5f * x * y * y);                                       /* newton step */
+    y = y * (1.5f - 0.5f * x * y * y);                                       /* newton step */
+    
+    return x * y;                                                            /* return the result */
+}
+
+/**
+ * @brief     clamp the temperature
+ * @param[in] t temperature in degrees
+ * @return    clamped temperature
+ * @note      none
+ */
+HDC2080_INLINE float a_hdc2080_psychro_clamp_t(float t)
+{
+    t = (t < -40.0f) ? -40.0f : t;                   /* clamp low */
+    
+    return (t > 125.0f) ? 125.0f : t;                /* clamp high */
+}
+
+/**
+ * @brief     clamp the humidity
+ * @param[in] rh humidity in percent
+ * @return    clamped humidity
+ * @note      0% is raised to 0.01% to keep the dew point finite
+ */
+HDC2080_INLINE float a_hdc2080_psychro_clamp_rh(float rh)
+{
+    rh = (rh < 0.01f) ? 0.01f : rh;                  /* clamp low */
+    
+    return (rh > 100.0f) ? 100.0f : rh;              /* clamp high */
+}
+
+/**
+ * @brief     vapour pressure kernel
+ * @param[in] t temperature in degrees
+ * @param[in] rh humidity in percent
+ * @return    vapour pressure in hPa
+ * @note      none
+ */
+HDC2080_INLINE float a_hdc2080_psychro_vapour_pressure(float t, float rh)
+{
+    t = a_hdc2080_psychro_clamp_t(t);                                                                 /* clamp temperature */
+    rh = a_hdc2080_psychro_clamp_rh(rh);                                                              /* clamp humidity */
+    
+    return rh * (PSYCHRO_MAGNUS_E0 / 100.0f) *
+           a_hdc2080_psychro_exp(PSYCHRO_MAGNUS_A * t / (PSYCHRO_MAGNUS_B + t));                      /* return the result */
+}
+
+/**
+ * @brief     dew point kernel
+ * @param[in] t temperature in degrees
+ * @param[in] rh humidity in percent
+ * @return    dew point in degrees
+ * @note      none
+ */
+HDC2080_INLINE float a_hdc2080_psychro_dew_point(float t, float rh)
+{
+    float gamma;
+    
+    t = a_hdc2080_psychro_clamp_t(t);                                                                 /* clamp temperature */
+    rh = a_hdc2080_psychro_clamp_rh(rh);                                                              /* clamp humidity */
+    gamma = a_hdc2080_psychro_log(rh * 0.01f) + PSYCHRO_MAGNUS_A * t / (PSYCHRO_MAGNUS_B + t);        /* magnus gamma */
+    
+    return PSYCHRO_MAGNUS_B * gamma / (PSYCHRO_MAGNUS_A - gamma);                                     /* return the result */
+}
+
+/**
+ * @brief     absolute humidity kernel
+ * @param[in] t temperature in degrees
+ * @param[in] rh humidity in percent
+ * @return    absolute humidity in g/m3
+ * @note      none
+ */
+HDC2080_INLINE float a_hdc2080_psychro_absolute_humidity(float t, float rh)
+{
+    return PSYCHRO_ABSOLUTE * a_hdc2080_psychro_vapour_pressure(t, rh) /
+           (PSYCHRO_KELVIN + a_hdc2080_psychro_clamp_t(t));                 /* return the result */
+}
+
+/**
+ * @brief     heat index kernel
+ * @param[in] t temperature in degrees
+ * @param[in] rh humidity in percent
+ * @return    heat index in degrees
+ * @note      both formulas and both adjustments are evaluated and selected so the loop has no branch,
+ *            a negative dry weight outside 78F - 112F folds to zero through the clamp in the square root
+ *            and the regression is factored to save multiplies
+ */
+HDC2080_INLINE float a_hdc2080_psychro_heat_index(float t, float rh)
+{
+    float f;
+    float simple;
+    float full;
+    float v;
+    float dry;
+    float humid;
+    
+    t = a_hdc2080_psychro_clamp_t(t);                                                                 /* clamp temperature */
+    rh = a_hdc2080_psychro_clamp_rh(rh);                                                              /* clamp humidity */
+    f = t * 1.8f + 32.0f;                                                                             /* to fahrenheit */
+    simple = 0.5f * (f + 61.0f + (f - 68.0f) * 1.2f + rh * 0.094f);                                   /* steadman */
+    full = -42.379f + f * (2.04901523f - 0.00683783f * f) + rh * (10.14333127f - 0.05481717f * rh) +
+           f * rh * (-0.22475541f + 0.00122874f * f + 0.00085282f * rh - 0.00000199f * f * rh);      /* rothfusz */
+    v = (f > 95.0f) ? (f - 95.0f) : (95.0f - f);                                                      /* |f - 95| */
+    v = (17.0f - v) * (1.0f / 17.0f);                                                                 /* dry weight */
+    dry = (rh < 13.0f) ? (13.0f - rh) : 0.0f;                                                         /* dry below 13% */
+    dry = dry * 0.25f * a_hdc2080_psychro_sqrt(v);                                                    /* dry adjustment */
+    humid = (rh > 85.0f) ? (rh - 85.0f) : 0.0f;                                                       /* humid above 85% */
+    humid = humid * 0.02f * ((f < 87.0f) ? (87.0f - f) : 0.0f);                                       /* humid adjustment */
+    full += (f >= 80.0f) ? (humid - dry) : 0.0f;                                                      /* apply from 80F */
+    f = (((simple + f) * 0.5f) >= 80.0f) ? full : simple;                                             /* select the formula */
+    
+    return (f - 32.0f) * (1.0f / 1.8f);                                                               /* return the result */
+}
+
+/**
+ * @brief      dew point batch
+ * @param[in]  *t pointer to a temperature array
+ * @param[in]  *rh pointer to a humidity array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       none
+ */
+static void a_hdc2080_psychro_dew_point_batch(const float *HDC2080_RESTRICT t, const float *HDC2080_RESTRICT rh,
+                                              float *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                         /* compute all */
+    {
+        out[i] = a_hdc2080_psychro_dew_point(t[i], rh[i]);            /* compute dew point */
+    }
+}
+
+/**
+ * @brief      vapour pressure batch
+ * @param[in]  *t pointer to a temperature array
+ * @param[in]  *rh pointer to a humidity array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       none
+ */
+static void a_hdc2080_psychro_vapour_pressure_batch(const float *HDC2080_RESTRICT t, const float *HDC2080_RESTRICT rh,
+                                                    float *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                               /* compute all */
+    {
+        out[i] = a_hdc2080_psychro_vapour_pressure(t[i], rh[i]);            /* compute vapour pressure */
+    }
+}
+
+/**
+ * @brief      absolute humidity batch
+ * @param[in]  *t pointer to a temperature array
+ * @param[in]  *rh pointer to a humidity array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       none
+ */
+static void a_hdc2080_psychro_absolute_humidity_batch(const float *HDC2080_RESTRICT t, const float *HDC2080_RESTRICT rh,
+                                                      float *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                                 /* compute all */
+    {
+        out[i] = a_hdc2080_psychro_absolute_humidity(t[i], rh[i]);            /* compute absolute humidity */
+    }
+}
+
+/**
+ * @brief      absolute humidity from vapour pressure batch
+ * @param[in]  *t pointer to a temperature array
+ * @param[in]  *vp pointer to a vapour pressure array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       reuses the vapour pressure so the exp is evaluated once per sample
+ */
+static void a_hdc2080_psychro_absolute_humidity_from_batch(const float *HDC2080_RESTRICT t, const float *HDC2080_RESTRICT vp,
+                                                           float *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                                                          /* compute all */
+    {
+        out[i] = PSYCHRO_ABSOLUTE * vp[i] / (PSYCHRO_KELVIN + a_hdc2080_psychro_clamp_t(t[i]));        /* compute absolute humidity */
+    }
+}
+
+/**
+ * @brief      heat index batch
+ * @param[in]  *t pointer to a temperature array
+ * @param[in]  *rh pointer to a humidity array
+ * @param[out] *out pointer to an output array
+ * @param[in]  len array length
+ * @note       none
+ */
+static void a_hdc2080_psychro_heat_index_batch(const float *HDC2080_RESTRICT t, const float *HDC2080_RESTRICT rh,
+                                               float *HDC2080_RESTRICT out, uint32_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < len; i++)                                          /* compute all */
+    {
+        out[i] = a_hdc2080_psychro_heat_index(t[i], rh[i]);            /* compute heat index */
+    }
+}
+#endif
+
+/**
+ * @brief     round a signed division
+ * @param[in] n numerator
+ * @param[in] d positive denominator
+ * @return    rounded quotient
+ * @note      the halves are rounded away from zero
+ */
+HDC2080_INLINE int64_t a_hdc2080_psychro_div(int64_t n, int64_t d)
+{
+    return (n >= 0) ? ((n + d / 2) / d) : -((-n + d / 2) / d);        /* return the result */
+}
+
+/**
+ * @brief     fixed point exp
+ * @param[in] x_q30 input in q30, |x| < 16
+ * @return    exp(x) in q30
+ * @note      2^n times a degree 6 taylor polynomial on |g| <= ln(2) / 2
+ */
+static int64_t a_hdc2080_psychro_exp_q30(int64_t x_q30)
+{
+    int64_t y;
+    int64_t n;
+    int64_t g;
+    int64_t p;
+    
+    y = (x_q30 >> 8) * PSYCHRO_Q30_LOG2E >> 22;                          /* to base 2 */
+    n = (y + PSYCHRO_Q30_ONE / 2) >> 30;                                 /* round to nearest */
+    g = (y - n * PSYCHRO_Q30_ONE) * PSYCHRO_Q30_LN2 >> 30;               /* remainder in base e */
+    p = 1491308;                                                         /* 1 / 720 */
+    p = 8947849 + (g * p >> 30);                                         /* 1 / 120 */
+    p = 44739243 + (g * p >> 30);                                        /* 1 / 24 */
+    p = 178956971 + (g * p >> 30);                                       /* 1 / 6 */
+    p = 536870912 + (g * p >> 30);                                       /* 1 / 2 */
+    p = PSYCHRO_Q30_ONE + (g * p >> 30);                                 /* 1 */
+    p = PSYCHRO_Q30_ONE + (g * p >> 30);                                 /* 1 */
+    
+    return (n >= 0) ? (p << n) : (p >> (-n));                            /* return the result */
+}
+
+/**
+ * @brief     fixed point log of an integer
+ * @param[in] v input, 1 - 2^31
+ * @return    ln(v) in q30
+ * @note      the mantissa is reduced to [sqrt(2) / 2, sqrt(2)) and the atanh series is cut after s^7
+ */
+static int64_t a_hdc2080_psychro_log_q30(uint32_t v)
+{
+    int64_t e;
+    int64_t m;
+    int64_t s;
+    int64_t s2;
+    int64_t p;
+    
+    e = 0;                                                               /* init exponent */
+    while ((v >> e) > 1)                                                 /* find the top bit */
+    {
+        e++;                                                             /* next bit */
+    }
+    m = ((int64_t)v << 30) >> e;                                         /* mantissa in [1, 2) */
+    if (m > PSYCHRO_Q30_SQRT2)                                           /* check the upper half */
+    {
+        m >>= 1;                                                         /* reduce */
+        e++;                                                             /* adjust exponent */
+    }
+    s = ((m - PSYCHRO_Q30_ONE) << 30) / (m + PSYCHRO_Q30_ONE);           /* atanh argument */
+    s2 = s * s >> 30;                                                    /* s^2 */
+    p = 153391689;                                                       /* 1 / 7 */
+    p = 214748365 + (s2 * p >> 30);                                      /* 1 / 5 */
+    p = 357913941 + (s2 * p >> 30);                                      /* 1 / 3 */
+    p = PSYCHRO_Q30_ONE + (s2 * p >> 30);                                /* 1 */
+    
+    return e * PSYCHRO_Q30_LN2 + (2 * s * p >> 30);                      /* return the result */
+}
+
+/**
+ * @brief     fixed point square root
+ * @param[in] v input
+ * @return    floor(sqrt(v))
+ * @note      none
+ */
+static uint32_t a_hdc2080_psychro_isqrt(uint64_t v)
+{
+    uint64_t r;
+    uint64_t bit;
+    
+    r = 0;                                                  /* init result */
+    bit = 1ULL << 62;                                       /* highest power of 4 */
+    while (bit > v)                                         /* find the start */
+    {
+        bit >>= 2;                                          /* next power of 4 */
+    }
+    while (bit != 0)                                        /* digit by digit */
+    {
+        if (v >= r + bit)                                   /* check the digit */
+        {
+            v -= r + bit;                                   /* subtract */
+            r = (r >> 1) + bit;                             /* set the digit */
+        }
+        else
+        {
+            r >>= 1;                                        /* clear the digit */
+        }
+        bit >>= 2;                                          /* next digit */
+    }
+    
+    return (uint32_t)r;                                     /* return the result */
+}
+
+/**
+ * @brief     fixed point heat index
+ * @param[in] t_centi temperature in 0.01 degrees
+ * @param[in] rh_centi humidity in 0.01 percent
+ * @return    heat index in 0.01 degrees
+ * @note      the regression runs in q10 fahrenheit and percent with q30 coefficients,
+ *            the s^2 t^2 coefficient is q40 to keep its precision
+ */
+static int32_t a_hdc2080_psychro_heat_index_centi(int32_t t_centi, int32_t rh_centi)
+{
+    int64_t f;
+    int64_t r;
+    int64_t fr;
+    int64_t ff;
+    int64_t rr;
+    int64_t ffr;
+    int64_t frr;
+    int64_t ffrr;
+    int64_t simple;
+    int64_t full;
+    int64_t v;
+    
+    f = a_hdc2080_psychro_div((int64_t)t_centi * 9 * 1024, 500) + 32 * 1024;             /* fahrenheit in q10 */
+    r = a_hdc2080_psychro_div((int64_t)rh_centi * 1024, 100);                            /* percent in q10 */
+    simple = (f + 61 * 1024 + (f - 68 * 1024) * 12 / 10 + r * 94 / 1000) / 2;             /* steadman */
+    if ((simple + f) / 2 < 80 * 1024)                                                    /* check the average */
+    {
+        full = simple;                                                                   /* use steadman */
+    }
+    else
+    {
+        fr = f * r >> 10;                                                                /* f r */
+        ff = f * f >> 10;                                                                /* f^2 */
+        rr = r * r >> 10;                                                                /* r^2 */
+        ffr = ff * r >> 10;                                                              /* f^2 r */
+        frr = fr * r >> 10;                                                              /* f r^2 */
+        ffrr = ffr * r >> 10;                                                            /* f^2 r^2 */
+        full = (-45504104759LL * 1024 + 2200113350LL * f + 10891319019LL * r -
+                241329284LL * fr - 7342064LL * ff - 58859488LL * rr +
+                1319350LL * ffr + 915709LL * frr) >> 30;                                 /* rothfusz */
+        full += (-2188028LL * ffrr) >> 40;                                               /* q40 term */
+        if ((r < 13 * 1024) && (f >= 80 * 1024) && (f <= 112 * 1024))                    /* dry adjustment */
+        {
+            v = (f > 95 * 1024) ? (f - 95 * 1024) : (95 * 1024 - f);                     /* |f - 95| */
+            v = ((17 * 1024 - v) << 10) / 17;                                            /* dry weight in q20 */
+            full -= (13 * 1024 - r) * (int64_t)a_hdc2080_psychro_isqrt((uint64_t)v) >> 12; /* ((13 - r) / 4) sqrt */
+        }
+        if ((r > 85 * 1024) && (f >= 80 * 1024) && (f <= 87 * 1024))                    /* humid adjustment */
+        {
+            full += ((r - 85 * 1024) * (87 * 1024 - f) >> 10) / 50;                      /* ((r - 85) / 10) ((87 - f) / 5) */
+        }
+    }
+    
+    return (int32_t)a_hdc2080_psychro_div((full - 32 * 1024) * 500, 9 * 1024);           /* return the result */
+}
+
+/**
+ * @brief      fixed point kernel
+ * @param[in]  temperature_centi temperature in 0.01 degrees
+ * @param[in]  humidity_centi humidity in 0.01 percent
+ * @param[out] *psychro pointer to a psychro centi buffer
+ * @note       none
+ */
+static void a_hdc2080_psychro_centi(int16_t temperature_centi, uint16_t humidity_centi, hdc2080_psychro_centi_t *psychro)
+{
+    int32_t t;
+    int32_t rh;
+    int64_t x;
+    int64_t gamma;
+    int64_t e;
+    
+    t = (temperature_centi < -4000) ? -4000 : ((temperature_centi > 12500) ? 12500 : temperature_centi);    /* clamp temperature */
+    rh = (humidity_centi < 1) ? 1 : ((humidity_centi > 10000) ? 10000 : humidity_centi);                   /* clamp humidity */
+    x = ((int64_t)1762 * t << 30) / ((int64_t)100 * (24312 + t));                                            /* a t / (b + t) in q30 */
+    gamma = a_hdc2080_psychro_log_q30((uint32_t)rh) - PSYCHRO_Q30_LN10000 + x;                             /* magnus gamma */
+    psychro->dew_point_centi = (int16_t)a_hdc2080_psychro_div(24312 * gamma, PSYCHRO_Q30_MAGNUS_A - gamma);  /* b gamma / (a - gamma) */
+    e = a_hdc2080_psychro_exp_q30(x) * 6112 / 1000 * rh / 10000;                                           /* vapour pressure in q30 hPa */
+    psychro->vapour_pressure_centi = (uint32_t)((e * 100 + PSYCHRO_Q30_ONE / 2) >> 30);                    /* to 0.01 hPa */
+    e >>= 10;                                                                                               /* to q20 */
+    psychro->absolute_humidity_centi = (uint32_t)a_hdc2080_psychro_div(2167000 * e,
+                                                                       (int64_t)(27315 + t) << 20);         /* 216.7 e / T */
+    psychro->heat_index_centi = a_hdc2080_psychro_heat_index_centi(t, rh);                                  /* heat index */
+}
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief      compute the psychrometric values of a sample
+ * @param[in]  temperature temperature in degrees
+ * @param[in]  humidity humidity in percent
+ * @param[out] *psychro pointer to a psychro buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       the vapour pressure is the Magnus formula over water with the Sonntag constants,
+ *             the heat index is the NWS Rothfusz regression with the Steadman formula below 80F,
+ *             exp and log are bounded error approximations, the inputs are clamped to -40C - 125C and 0.01% - 100%
+ */
+uint8_t hdc2080_psychro(float temperature, float humidity, hdc2080_psychro_t *psychro)
+{
+    if (psychro == NULL)                                                                          /* check buffer */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    
+    psychro->dew_point = a_hdc2080_psychro_dew_point(temperature, humidity);                      /* dew point */
+    psychro->heat_index = a_hdc2080_psychro_heat_index(temperature, humidity);                    /* heat index */
+    psychro->vapour_pressure = a_hdc2080_psychro_vapour_pressure(temperature, humidity);          /* vapour pressure */
+    psychro->absolute_humidity = a_hdc2080_psychro_absolute_humidity(temperature, humidity);      /* absolute humidity */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      compute the psychrometric values of sample arrays
+ * @param[in]  *temperature pointer to a temperature array in degrees
+ * @param[in]  *humidity pointer to a humidity array in percent
+ * @param[out] *dew_point pointer to a dew point array or NULL
+ * @param[out] *vapour_pressure pointer to a vapour pressure array in hPa or NULL
+ * @param[out] *absolute_humidity pointer to an absolute humidity array in g/m3 or NULL
+ * @param[out] *heat_index pointer to a heat index array or NULL
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       a NULL output array is skipped, the arrays must not overlap,
+ *             every output is one branch free loop written to be auto vectorised
+ */
+uint8_t hdc2080_psychro_batch(const float *temperature, const float *humidity,
+                              float *dew_point, float *vapour_pressure, float *absolute_humidity, float *heat_index,
+                              uint32_t len)
+{
+    if ((temperature == NULL) || (humidity == NULL))                                              /* check buffer */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    
+    if (dew_point != NULL)                                                                        /* check dew point */
+    {
+        a_hdc2080_psychro_dew_point_batch(temperature, humidity, dew_point, len);                 /* compute dew point */
+    }
+    if (vapour_pressure != NULL)                                                                  /* check vapour pressure */
+    {
+        a_hdc2080_psychro_vapour_pressure_batch(temperature, humidity, vapour_pressure, len);     /* compute vapour pressure */
+    }
+    if ((absolute_humidity != NULL) && (vapour_pressure != NULL))                                 /* check both */
+    {
+        a_hdc2080_psychro_absolute_humidity_from_batch(temperature, vapour_pressure,
+                                                       absolute_humidity, len);                   /* reuse vapour pressure */
+    }
+    else if (absolute_humidity != NULL)                                                           /* check absolute humidity */
+    {
+        a_hdc2080_psychro_absolute_humidity_batch(temperature, humidity, absolute_humidity, len); /* compute absolute humidity */
+    }
+    if (heat_index != NULL)                                                                       /* check heat index */
+    {
+        a_hdc2080_psychro_heat_index_batch(temperature, humidity, heat_index, len);               /* compute heat index */
+    }
+    
+    return 0;                                                                                     /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      compute the psychrometric values of a sample in fixed point
+ * @param[in]  temperature_centi temperature in 0.01 degrees
+ * @param[in]  humidity_centi humidity in 0.01 percent
+ * @param[out] *psychro pointer to a psychro centi buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       the formulas of hdc2080_psychro are evaluated with 32 and 64 bit integers only,
+ *             the inputs are clamped to -40C - 125C and 0.01% - 100%
+ */
+uint8_t hdc2080_psychro_centi(int16_t temperature_centi, uint16_t humidity_centi, hdc2080_psychro_centi_t *psychro)
+{
+    if (psychro == NULL)                                                          /* check buffer */
+    {
+        return 1;                                                                 /* return error */
+    }
+    
+    a_hdc2080_psychro_centi(temperature_centi, humidity_centi, psychro);          /* compute */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      compute the psychrometric values of sample arrays in fixed point
+ * @param[in]  *temperature_centi pointer to a temperature array in 0.01 degrees
+ * @param[in]  *humidity_centi pointer to a humidity array in 0.01 percent
+ * @param[out] *psychro pointer to a psychro centi array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       none
+ */
+uint8_t hdc2080_psychro_batch_centi(const int16_t *temperature_centi, const uint16_t *humidity_centi,
+                                    hdc2080_psychro_centi_t *psychro, uint32_t len)
+{
+    uint32_t i;
+    
+    if ((temperature_centi == NULL) || (humidity_centi == NULL) || (psychro == NULL))        /* check buffer */
+    {
+        return 1;                                                                            /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                                /* compute all */
+    {
+        a_hdc2080_psychro_centi(temperature_centi[i], humidity_centi[i], &psychro[i]);       /* compute */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
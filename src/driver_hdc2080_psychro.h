@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_psychro.h
+ * @brief     driver hdc2080 psychro header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC2080_PSYCHRO_H
+#define DRIVER_HDC2080_PSYCHRO_H
+
+#include "driver_hdc2080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc2080_psychro_driver hdc2080 psychro driver function
+ * @brief    hdc2080 psychro driver modules
+ * @ingroup  hdc2080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc2080 psychro fixed point structure definition
+ */
+typedef struct hdc2080_psychro_centi_s
+{
+    int16_t dew_point_centi;                 /**< dew point in 0.01 degrees */
+    int32_t heat_index_centi;                /**< heat index in 0.01 degrees */
+    uint32_t vapour_pressure_centi;          /**< vapour pressure in 0.01 hPa */
+    uint32_t absolute_humidity_centi;        /**< absolute humidity in 0.01 g/m3 */
+} hdc2080_psychro_centi_t;
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief hdc2080 psychro structure definition
+ */
+typedef struct hdc2080_psychro_s
+{
+    float dew_point;                 /**< dew point in degrees */
+    float heat_index;                /**< heat index in degrees */
+    float vapour_pressure;           /**< vapour pressure in hPa */
+    float absolute_humidity;         /**< absolute humidity in g/m3 */
+} hdc2080_psychro_t;
+
+/**
+ * @brief      compute the psychrometric values of a sample
+ * @param[in]  temperature temperature in degrees
+ * @param[in]  humidity humidity in percent
+ * @param[out] *psychro pointer to a psychro buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       the vapour pressure is the Magnus formula over water with the Sonntag constants,
+ *             the heat index is the NWS Rothfusz regression with the Steadman formula below 80F,
+ *             exp and log are bounded error approximations, the inputs are clamped to -40C - 125C and 0.01% - 100%
+ */
+uint8_t hdc2080_psychro(float temperature, float humidity, hdc2080_psychro_t *psychro);
+
+/**
+ * @brief      compute the psychrometric values of sample arrays
+ * @param[in]  *temperature pointer to a temperature array in degrees
+ * @param[in]  *humidity pointer to a humidity array in percent
+ * @param[out] *dew_point pointer to a dew point array or NULL
+ * @param[out] *vapour_pressure pointer to a vapour pressure array in hPa or NULL
+ * @param[out] *absolute_humidity pointer to an absolute humidity array in g/m3 or NULL
+ * @param[out] *heat_index pointer to a heat index array or NULL
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       a NULL output array is skipped, the arrays must not overlap,
+ *             every output is one branch free loop written to be auto vectorised
+ *             and equals the single sample result
+ */
+uint8_t hdc2080_psychro_batch(const float *temperature, const float *humidity,
+                              float *dew_point, float *vapour_pressure, float *absolute_humidity, float *heat_index,
+                              uint32_t len);
+#endif
+
+/**
+ * @brief      compute the psychrometric values of a sample in fixed point
+ * @param[in]  temperature_centi temperature in 0.01 degrees
+ * @param[in]  humidity_centi humidity in 0.01 percent
+ * @param[out] *psychro pointer to a psychro centi buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       the formulas of hdc2080_psychro are evaluated with 32 and 64 bit integers only,
+ *             the inputs are clamped to -40C - 125C and 0.01% - 100%
+ */
+uint8_t hdc2080_psychro_centi(int16_t temperature_centi, uint16_t humidity_centi, hdc2080_psychro_centi_t *psychro);
+
+/**
+ * @brief      compute the psychrometric values of sample arrays in fixed point
+ * @param[in]  *temperature_centi pointer to a temperature array in 0.01 degrees
+ * @param[in]  *humidity_centi pointer to a humidity array in 0.01 percent
+ * @param[out] *psychro pointer to a psychro centi array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       none
+ */
+uint8_t hdc2080_psychro_batch_centi(const int16_t *temperature_centi, const uint16_t *humidity_centi,
+                                    hdc2080_psychro_centi_t *psychro, uint32_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
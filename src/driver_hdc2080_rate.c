@@ -0,0 +1,328 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_rate.c
+ * @brief     driver hdc2080 rate source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_rate.h"
+
+/**
+ * @brief auto measurement period table in ms, indexed by the mode
+ */
+static const uint32_t gsc_hdc2080_rate_period_ms[8] =
+{
+    0, 120000, 60000, 10000, 5000, 1000, 500, 200,
+};
+
+/**
+ * @brief         restart the calm window of a channel
+ * @param[in,out] *channel pointer to a rate channel
+ * @param[in]     value current value in 0.01 units
+ * @note          none
+ */
+static void a_hdc2080_rate_calm(hdc2080_rate_channel_t *channel, int32_t value)
+{
+    channel->min = value;                /* reset min */
+    channel->max = value;                /* reset max */
+}
+
+/**
+ * @brief     get the mode a channel needs
+ * @param[in] *rate pointer to an hdc2080 rate structure
+ * @param[in] *channel pointer to a rate channel
+ * @param[in] value current value in 0.01 units
+ * @param[in] dt_ms time since the last sample
+ * @return    slowest mode that keeps the change between two samples within the step
+ * @note      the current mode is returned while the change fits or no faster mode is allowed
+ */
+static uint8_t a_hdc2080_rate_need(hdc2080_rate_t *rate, hdc2080_rate_channel_t *channel, int32_t value, uint32_t dt_ms)
+{
+    uint8_t m;
+    uint64_t d;
+    
+    d = (uint64_t)((value > channel->last) ? (value - channel->last) : (channel->last - value));        /* |change| */
+    if ((rate->mode >= rate->max_mode) ||
+        (d * gsc_hdc2080_rate_period_ms[rate->mode] <= (uint64_t)channel->step * dt_ms))                /* check the current mode */
+    {
+        return rate->mode;                                                                              /* keep */
+    }
+    for (m = rate->mode + 1; m < rate->max_mode; m++)                                                   /* find a faster mode */
+    {
+        if (d * gsc_hdc2080_rate_period_ms[m] <= (uint64_t)channel->step * dt_ms)                       /* check the mode */
+        {
+            break;                                                                                      /* found */
+        }
+    }
+    
+    return m;                                                                                           /* return the mode */
+}
+
+/**
+ * @brief     check a channel is calm enough for a slower mode
+ * @param[in] *channel pointer to a rate channel
+ * @param[in] period_ms period of the slower mode
+ * @param[in] elapsed_ms length of the calm window
+ * @return    1 if calm, else 0
+ * @note      the range scaled to the slower period must stay within half the step
+ */
+static uint8_t a_hdc2080_rate_calm_enough(hdc2080_rate_channel_t *channel, uint32_t period_ms, uint32_t elapsed_ms)
+{
+    uint64_t range;
+    
+    range = (uint64_t)(channel->max - channel->min);                                               /* range */
+    
+    return (range * period_ms * 2 <= (uint64_t)channel->step * elapsed_ms) ? 1 : 0;                /* return the result */
+}
+
+/**
+ * @brief     switch the auto measurement mode
+ * @param[in] *rate pointer to an hdc2080 rate structure
+ * @param[in] mode new mode
+ * @param[in] now_ms current time
+ * @return    status code
+ *            - 0 success
+ *            - 1 set auto measurement mode failed
+ * @note      the calm window restarts
+ */
+static uint8_t a_hdc2080_rate_switch(hdc2080_rate_t *rate, uint8_t mode, uint32_t now_ms)
+{
+    if (hdc2080_set_auto_measurement_mode(rate->handle, (hdc2080_auto_measurement_mode_t)mode) != 0)        /* set mode */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    if (mode > rate->mode)                                                                                  /* check direction */
+    {
+        rate->ups++;                                                                                        /* count up */
+    }
+    else
+    {
+        rate->downs++;                                                                                      /* count down */
+    }
+    rate->mode = mode;                                                                                      /* set mode */
+    rate->calm_ms = now_ms;                                                                                 /* restart the window */
+    a_hdc2080_rate_calm(&rate->temperature, rate->temperature.last);                                        /* restart temperature */
+    a_hdc2080_rate_calm(&rate->humidity, rate->humidity.last);                                              /* restart humidity */
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     init the rate controller
+ * @param[in] *rate pointer to an hdc2080 rate structure
+ * @param[in] *handle pointer to an initialized hdc2080 handle
+ * @param[in] min_mode slowest auto measurement mode
+ * @param[in] max_mode fastest auto measurement mode
+ * @param[in] temperature_step_centi allowed temperature change between two samples in 0.01 degrees
+ * @param[in] humidity_step_centi allowed humidity change between two samples in 0.01 percent
+ * @param[in] hold_ms calm time before a slower rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 set auto measurement mode failed
+ *            - 2 rate is NULL
+ *            - 4 param is invalid
+ * @note      the chip starts at max_mode and slows down once the values are shown to be calm
+ */
+uint8_t hdc2080_rate_init(hdc2080_rate_t *rate, hdc2080_handle_t *handle,
+                          hdc2080_auto_measurement_mode_t min_mode, hdc2080_auto_measurement_mode_t max_mode,
+                          uint16_t temperature_step_centi, uint16_t humidity_step_centi, uint32_t hold_ms)
+{
+    if (rate == NULL)                                                                          /* check rate */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if ((handle == NULL) || (min_mode == HDC2080_AUTO_MEASUREMENT_MODE_DISABLED) ||
+        (max_mode > HDC2080_AUTO_MEASUREMENT_MODE_5_HZ) || (min_mode > max_mode) ||
+        (temperature_step_centi == 0) || (humidity_step_centi == 0))                           /* check params */
+    {
+        return 4;                                                                              /* return error */
+    }
+    
+    memset(rate, 0, sizeof(hdc2080_rate_t));                                                   /* clear rate */
+    if (hdc2080_set_auto_measurement_mode(handle, max_mode) != 0)                              /* start fast */
+    {
+        return 1;                                                                              /* return error */
+    }
+    rate->handle = handle;                                                                     /* set handle */
+    rate->temperature.step = temperature_step_centi;                                           /* set temperature step */
+    rate->humidity.step = humidity_step_centi;                                                 /* set humidity step */
+    rate->hold_ms = hold_ms;                                                                   /* set hold time */
+    rate->mode = (uint8_t)max_mode;                                                            /* set mode */
+    rate->min_mode = (uint8_t)min_mode;                                                        /* set min mode */
+    rate->max_mode = (uint8_t)max_mode;                                                        /* set max mode */
+    rate->inited = 1;                                                                          /* flag inited */
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     deinit the rate controller
+ * @param[in] *rate pointer to an hdc2080 rate structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 rate is NULL
+ *            - 3 rate is not initialized
+ * @note      the chip keeps the current auto measurement mode
+ */
+uint8_t hdc2080_rate_deinit(hdc2080_rate_t *rate)
+{
+    if (rate == NULL)                    /* check rate */
+    {
+        return 2;                        /* return error */
+    }
+    if (rate->inited != 1)               /* check rate initialization */
+    {
+        return 3;                        /* return error */
+    }
+    
+    rate->inited = 0;                    /* flag closed */
+    
+    return 0;                            /* success return 0 */
+}
+
+/**
+ * @brief      feed a sample and adapt the auto measurement rate
+ * @param[in]  *rate pointer to an hdc2080 rate structure
+ * @param[in]  now_ms sample time
+ * @param[in]  temperature_centi temperature in 0.01 degrees
+ * @param[in]  humidity_centi humidity in 0.01 percent
+ * @param[out] *mode pointer to an auto measurement mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 set auto measurement mode failed
+ *             - 2 rate is NULL
+ *             - 3 rate is not initialized
+ * @note       the rate goes up at once to the slowest mode that keeps the change between two samples
+ *             within the step, it goes down one mode when the min to max range since the calm window
+ *             start, scaled to the slower period, stays within half the step for hold_ms and for one
+ *             slower period, so a value on the edge of a step never toggles the rate,
+ *             the time may wrap around but the samples must be less than 24 days apart
+ */
+uint8_t hdc2080_rate_update(hdc2080_rate_t *rate, uint32_t now_ms, int16_t temperature_centi, uint16_t humidity_centi,
+                            hdc2080_auto_measurement_mode_t *mode)
+{
+    uint8_t res;
+    uint8_t need;
+    uint8_t m;
+    uint32_t dt_ms;
+    uint32_t elapsed_ms;
+    uint32_t period_ms;
+    
+    if (rate == NULL)                                                                             /* check rate */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (rate->inited != 1)                                                                        /* check rate initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    
+    res = 0;                                                                                      /* init result */
+    if (rate->seeded == 0)                                                                        /* first sample */
+    {
+        rate->temperature.last = temperature_centi;                                               /* set temperature */
+        rate->humidity.last = humidity_centi;                                                     /* set humidity */
+        a_hdc2080_rate_calm(&rate->temperature, temperature_centi);                               /* start temperature window */
+        a_hdc2080_rate_calm(&rate->humidity, humidity_centi);                                     /* start humidity window */
+        rate->calm_ms = now_ms;                                                                   /* start the window */
+        rate->last_ms = now_ms;                                                                   /* set time */
+        rate->seeded = 1;                                                                         /* flag seeded */
+    }
+    else
+    {
+        /* a transient raises the rate at once */
+        need = rate->mode;                                                                        /* init need */
+        dt_ms = now_ms - rate->last_ms;                                                           /* time since the last sample */
+        if ((int32_t)dt_ms > 0)                                                                   /* check time */
+        {
+            m = a_hdc2080_rate_need(rate, &rate->temperature, temperature_centi, dt_ms);          /* temperature need */
+            need = (m > need) ? m : need;                                                         /* faster one */
+            m = a_hdc2080_rate_need(rate, &rate->humidity, humidity_centi, dt_ms);                /* humidity need */
+            need = (m > need) ? m : need;                                                         /* faster one */
+        }
+        rate->temperature.last = temperature_centi;                                               /* set temperature */
+        rate->humidity.last = humidity_centi;                                                     /* set humidity */
+        rate->last_ms = now_ms;                                                                   /* set time */
+        rate->temperature.min = (temperature_centi < rate->temperature.min) ?
+                                temperature_centi : rate->temperature.min;                        /* update min */
+        rate->temperature.max = (temperature_centi > rate->temperature.max) ?
+                                temperature_centi : rate->temperature.max;                        /* update max */
+        rate->humidity.min = (humidity_centi < rate->humidity.min) ?
+                             humidity_centi : rate->humidity.min;                                 /* update min */
+        rate->humidity.max = (humidity_centi > rate->humidity.max) ?
+                             humidity_centi : rate->humidity.max;                                 /* update max */
+        if (need > rate->mode)                                                                    /* check faster */
+        {
+            res = a_hdc2080_rate_switch(rate, need, now_ms);                                      /* switch up */
+        }
+        else if (rate->mode > rate->min_mode)                                                     /* check slower */
+        {
+            /* a calm window lowers the rate one mode */
+            elapsed_ms = now_ms - rate->calm_ms;                                                  /* calm time */
+            period_ms = gsc_hdc2080_rate_period_ms[rate->mode - 1];                               /* slower period */
+            if ((elapsed_ms >= rate->hold_ms) && (elapsed_ms >= period_ms) &&
+                (a_hdc2080_rate_calm_enough(&rate->temperature, period_ms, elapsed_ms) != 0) &&
+                (a_hdc2080_rate_calm_enough(&rate->humidity, period_ms, elapsed_ms) != 0))        /* check calm */
+            {
+                res = a_hdc2080_rate_switch(rate, rate->mode - 1, now_ms);                        /* switch down */
+            }
+        }
+    }
+    if (mode != NULL)                                                                             /* check buffer */
+    {
+        *mode = (hdc2080_auto_measurement_mode_t)rate->mode;                                           /* set mode */
+    }
+    
+    return (res != 0) ? 1 : 0;                                                                    /* return the result */
+}
+
+/**
+ * @brief      get the sample period of an auto measurement mode
+ * @param[in]  mode auto measurement mode
+ * @param[out] *ms pointer to a period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 mode is invalid
+ * @note       disabled is invalid
+ */
+uint8_t hdc2080_rate_get_period(hdc2080_auto_measurement_mode_t mode, uint32_t *ms)
+{
+    if ((ms == NULL) || (mode == HDC2080_AUTO_MEASUREMENT_MODE_DISABLED) ||
+        (mode > HDC2080_AUTO_MEASUREMENT_MODE_5_HZ))                             /* check params */
+    {
+        return 4;                                                                /* return error */
+    }
+    
+    *ms = gsc_hdc2080_rate_period_ms[mode];                                      /* get period */
+    
+    return 0;                                                                    /* success return 0 */
+}
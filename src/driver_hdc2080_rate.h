@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_rate.h
+ * @brief     driver hdc2080 rate header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC2080_RATE_H
+#define DRIVER_HDC2080_RATE_H
+
+#include "driver_hdc2080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc2080_rate_driver hdc2080 rate driver function
+ * @brief    hdc2080 rate driver modules
+ * @ingroup  hdc2080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc2080 rate channel structure definition
+ */
+typedef struct hdc2080_rate_channel_s
+{
+    int32_t last;             /**< last value in 0.01 units */
+    int32_t min;              /**< min since the calm window start in 0.01 units */
+    int32_t max;              /**< max since the calm window start in 0.01 units */
+    uint32_t step;            /**< allowed change between two samples in 0.01 units */
+} hdc2080_rate_channel_t;
+
+/**
+ * @brief hdc2080 rate structure definition
+ */
+typedef struct hdc2080_rate_s
+{
+    hdc2080_handle_t *handle;                   /**< initialized hdc2080 handle */
+    hdc2080_rate_channel_t temperature;         /**< temperature channel */
+    hdc2080_rate_channel_t humidity;            /**< humidity channel */
+    uint32_t hold_ms;                           /**< calm time before a slower rate */
+    uint32_t last_ms;                           /**< time of the last sample */
+    uint32_t calm_ms;                           /**< start of the calm window */
+    uint32_t ups;                               /**< switches to a faster rate */
+    uint32_t downs;                             /**< switches to a slower rate */
+    uint8_t mode;                               /**< current auto measurement mode */
+    uint8_t min_mode;                           /**< slowest auto measurement mode */
+    uint8_t max_mode;                           /**< fastest auto measurement mode */
+    uint8_t seeded;                             /**< first sample flag */
+    uint8_t inited;                             /**< inited flag */
+} hdc2080_rate_t;
+
+/**
+ * @brief     init the rate controller
+ * @param[in] *rate pointer to an hdc2080 rate structure
+ * @param[in] *handle pointer to an initialized hdc2080 handle
+ * @param[in] min_mode slowest auto measurement mode
+ * @param[in] max_mode fastest auto measurement mode
+ * @param[in] temperature_step_centi allowed temperature change between two samples in 0.01 degrees
+ * @param[in] humidity_step_centi allowed humidity change between two samples in 0.01 percent
+ * @param[in] hold_ms calm time before a slower rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 set auto measurement mode failed
+ *            - 2 rate is NULL
+ *            - 4 param is invalid
+ * @note      the chip starts at max_mode and slows down once the values are shown to be calm
+ */
+uint8_t hdc2080_rate_init(hdc2080_rate_t *rate, hdc2080_handle_t *handle,
+                          hdc2080_auto_measurement_mode_t min_mode, hdc2080_auto_measurement_mode_t max_mode,
+                          uint16_t temperature_step_centi, uint16_t humidity_step_centi, uint32_t hold_ms);
+
+/**
+ * @brief     deinit the rate controller
+ * @param[in] *rate pointer to an hdc2080 rate structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 rate is NULL
+ *            - 3 rate is not initialized
+ * @note      the chip keeps the current auto measurement mode
+ */
+uint8_t hdc2080_rate_deinit(hdc2080_rate_t *rate);
+
+/**
+ * @brief      feed a sample and adapt the auto measurement rate
+ * @param[in]  *rate pointer to an hdc2080 rate structure
+ * @param[in]  now_ms sample time
+ * @param[in]  temperature_centi temperature in 0.01 degrees
+ * @param[in]  humidity_centi humidity in 0.01 percent
+ * @param[out] *mode pointer to an auto measurement mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 set auto measurement mode failed
+ *             - 2 rate is NULL
+ *             - 3 rate is not initialized
+ * @note       the rate goes up at once to the slowest mode that keeps the change between two samples
+ *             within the step, it goes down one mode when the min to max range since the calm window
+ *             start, scaled to the slower period, stays within half the step for hold_ms and for one
+ *             slower period, so a value on the edge of a step never toggles the rate,
+ *             the time may wrap around but the samples must be less than 24 days apart
+ */
+uint8_t hdc2080_rate_update(hdc2080_rate_t *rate, uint32_t now_ms, int16_t temperature_centi, uint16_t humidity_centi,
+                            hdc2080_auto_measurement_mode_t *mode);
+
+/**
+ * @brief      get the sample period of an auto measurement mode
+ * @param[in]  mode auto measurement mode
+ * @param[out] *ms pointer to a period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 mode is invalid
+ * @note       disabled is invalid
+ */
+uint8_t hdc2080_rate_get_period(hdc2080_auto_measurement_mode_t mode, uint32_t *ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
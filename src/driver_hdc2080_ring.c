@@ -0,0 +1,255 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_ring.c
+ * @brief     driver hdc2080 ring source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_ring.h"
+
+/**
+ * @brief ring index load and store definition
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define a_hdc2080_ring_load(p)            __atomic_load_n((p), __ATOMIC_ACQUIRE)               /**< acquire load */
+    #define a_hdc2080_ring_store(p, v)        __atomic_store_n((p), (v), __ATOMIC_RELEASE)         /**< release store */
+#else
+    #define a_hdc2080_ring_load(p)            (*(p))                                               /**< volatile load, single core only */
+    #define a_hdc2080_ring_store(p, v)        (*(p) = (v))                                         /**< volatile store, single core only */
+#endif
+
+/**
+ * @brief     init the ring
+ * @param[in] *ring pointer to an hdc2080 ring structure
+ * @param[in] *buf pointer to a sample slot buffer
+ * @param[in] len slot number
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ *            - 4 param is invalid
+ * @note      len must be a power of 2 and the ring holds len - 1 samples
+ */
+uint8_t hdc2080_ring_init(hdc2080_ring_t *ring, hdc2080_ring_sample_t *buf, uint32_t len)
+{
+    if (ring == NULL)                                                  /* check ring */
+    {
+        return 2;                                                      /* return error */
+    }
+    if ((buf == NULL) || (len < 2) || ((len & (len - 1)) != 0))        /* check params */
+    {
+        return 4;                                                      /* return error */
+    }
+    
+    ring->head = 0;                                                    /* clear head */
+    ring->tail_cache = 0;                                              /* clear tail cache */
+    ring->sequence = 0;                                                /* clear sequence */
+    ring->dropped = 0;                                                 /* clear dropped */
+    ring->tail = 0;                                                    /* clear tail */
+    ring->head_cache = 0;                                              /* clear head cache */
+    ring->buf = buf;                                                   /* set buffer */
+    ring->mask = len - 1;                                              /* set mask */
+    ring->inited = 1;                                                  /* flag finish initialization */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     deinit the ring
+ * @param[in] *ring pointer to an hdc2080 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ *            - 3 ring is not initialized
+ * @note      none
+ */
+uint8_t hdc2080_ring_deinit(hdc2080_ring_t *ring)
+{
+    if (ring == NULL)                  /* check ring */
+    {
+        return 2;                      /* return error */
+    }
+    if (ring->inited != 1)             /* check ring initialization */
+    {
+        return 3;                      /* return error */
+    }
+    
+    ring->inited = 0;                  /* flag close */
+    
+    return 0;                          /* success return 0 */
+}
+
+/**
+ * @brief         push a sample
+ * @param[in]     *ring pointer to an hdc2080 ring structure
+ * @param[in,out] *sample pointer to a sample
+ * @return        status code
+ *                - 0 success
+ *                - 1 ring is full
+ *                - 2 ring is NULL
+ *                - 3 ring is not initialized
+ * @note          only one thread may push, it never blocks and the sequence number is filled in,
+ *                a sample that does not fit is counted as dropped
+ */
+uint8_t hdc2080_ring_push(hdc2080_ring_t *ring, hdc2080_ring_sample_t *sample)
+{
+    uint32_t head;
+    uint32_t next;
+    
+    if ((ring == NULL) || (sample == NULL))                              /* check ring */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (ring->inited != 1)                                               /* check ring initialization */
+    {
+        return 3;                                                        /* return error */
+    }
+    
+    sample->sequence = ring->sequence++;                                 /* set sequence */
+    head = ring->head;                                                   /* only this thread writes the head */
+    next = (head + 1) & ring->mask;                                      /* next head */
+    if (next == ring->tail_cache)                                        /* full by the cached tail */
+    {
+        ring->tail_cache = a_hdc2080_ring_load(&ring->tail);             /* reload the tail */
+        if (next == ring->tail_cache)                                    /* check full */
+        {
+            ring->dropped++;                                             /* drop the sample */
+            
+            return 1;                                                    /* return error */
+        }
+    }
+    ring->buf[head] = *sample;                                           /* copy the sample */
+    a_hdc2080_ring_store(&ring->head, next);                             /* publish the slot */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      pop up to len samples
+ * @param[in]  *ring pointer to an hdc2080 ring structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length
+ * @param[out] *num pointer to a popped number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       only one thread may pop, it never blocks and the slots are released once per batch
+ */
+uint8_t hdc2080_ring_pop(hdc2080_ring_t *ring, hdc2080_ring_sample_t *sample, uint32_t len, uint32_t *num)
+{
+    uint32_t tail;
+    uint32_t i;
+    
+    if ((ring == NULL) || (sample == NULL) || (num == NULL))                   /* check ring */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (ring->inited != 1)                                                     /* check ring initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    
+    tail = ring->tail;                                                         /* only this thread writes the tail */
+    if (tail == ring->head_cache)                                              /* empty by the cached head */
+    {
+        ring->head_cache = a_hdc2080_ring_load(&ring->head);                   /* reload the head */
+    }
+    for (i = 0; (i < len) && (tail != ring->head_cache); i++)                  /* copy the batch */
+    {
+        sample[i] = ring->buf[tail];                                           /* copy the sample */
+        tail = (tail + 1) & ring->mask;                                        /* next slot */
+    }
+    if (i != 0)                                                                /* check popped */
+    {
+        a_hdc2080_ring_store(&ring->tail, tail);                               /* release the slots */
+    }
+    *num = i;                                                                  /* set number */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      get the queued sample number
+ * @param[in]  *ring pointer to an hdc2080 ring structure
+ * @param[out] *num pointer to a number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       the result is a snapshot while the other side is running
+ */
+uint8_t hdc2080_ring_get_count(hdc2080_ring_t *ring, uint32_t *num)
+{
+    uint32_t head;
+    uint32_t tail;
+    
+    if ((ring == NULL) || (num == NULL))                   /* check ring */
+    {
+        return 2;                                          /* return error */
+    }
+    if (ring->inited != 1)                                 /* check ring initialization */
+    {
+        return 3;                                          /* return error */
+    }
+    
+    head = a_hdc2080_ring_load(&ring->head);               /* load the head */
+    tail = a_hdc2080_ring_load(&ring->tail);               /* load the tail */
+    *num = (head - tail) & ring->mask;                     /* get number */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the dropped sample number
+ * @param[in]  *ring pointer to an hdc2080 ring structure
+ * @param[out] *num pointer to a number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       none
+ */
+uint8_t hdc2080_ring_get_dropped(hdc2080_ring_t *ring, uint32_t *num)
+{
+    if ((ring == NULL) || (num == NULL))        /* check ring */
+    {
+        return 2;                               /* return error */
+    }
+    if (ring->inited != 1)                      /* check ring initialization */
+    {
+        return 3;                               /* return error */
+    }
+    
+    *num = ring->dropped;                       /* get dropped */
+    
+    return 0;                                   /* success return 0 */
+}
@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_ring.h
+ * @brief     driver hdc2080 ring header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC2080_RING_H
+#define DRIVER_HDC2080_RING_H
+
+#include "driver_hdc2080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc2080_ring_driver hdc2080 ring driver function
+ * @brief    hdc2080 ring driver modules
+ * @ingroup  hdc2080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc2080 ring cache line size definition
+ */
+#ifndef HDC2080_RING_CACHE_LINE
+    #define HDC2080_RING_CACHE_LINE        64        /**< 64 bytes */
+#endif
+
+/**
+ * @brief hdc2080 ring align definition
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define HDC2080_RING_ALIGN        __attribute__((aligned(HDC2080_RING_CACHE_LINE)))        /**< cache line align */
+#else
+    #define HDC2080_RING_ALIGN                                                                 /**< no align */
+#endif
+
+/**
+ * @brief hdc2080 ring sample structure definition
+ */
+typedef struct hdc2080_ring_sample_s
+{
+    uint64_t timestamp_us;             /**< time of the sample */
+    uint32_t sequence;                 /**< producer sequence number */
+    uint16_t temperature_raw;          /**< temperature raw data */
+    int16_t temperature_centi;         /**< temperature in 0.01 degrees */
+    uint16_t humidity_raw;             /**< humidity raw data */
+    uint16_t humidity_centi;           /**< humidity in 0.01 percent */
+    uint8_t status;                    /**< interrupt and drdy status */
+} hdc2080_ring_sample_t;
+
+/**
+ * @brief hdc2080 ring structure definition
+ */
+typedef struct hdc2080_ring_s
+{
+    volatile uint32_t head HDC2080_RING_ALIGN;        /**< next slot to write, written by the producer */
+    uint32_t tail_cache;                              /**< producer copy of the tail */
+    uint32_t sequence;                                /**< producer sequence number */
+    uint32_t dropped;                                 /**< samples dropped on a full ring */
+    volatile uint32_t tail HDC2080_RING_ALIGN;        /**< next slot to read, written by the consumer */
+    uint32_t head_cache;                              /**< consumer copy of the head */
+    hdc2080_ring_sample_t *buf HDC2080_RING_ALIGN;    /**< sample slots */
+    uint32_t mask;                                    /**< slot number - 1 */
+    uint8_t inited;                                   /**< inited flag */
+} hdc2080_ring_t;
+
+/**
+ * @brief     init the ring
+ * @param[in] *ring pointer to an hdc2080 ring structure
+ * @param[in] *buf pointer to a sample slot buffer
+ * @param[in] len slot number
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ *            - 4 param is invalid
+ * @note      len must be a power of 2 and the ring holds len - 1 samples
+ */
+uint8_t hdc2080_ring_init(hdc2080_ring_t *ring, hdc2080_ring_sample_t *buf, uint32_t len);
+
+/**
+ * @brief     deinit the ring
+ * @param[in] *ring pointer to an hdc2080 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ *            - 3 ring is not initialized
+ * @note      none
+ */
+uint8_t hdc2080_ring_deinit(hdc2080_ring_t *ring);
+
+/**
+ * @brief         push a sample
+ * @param[in]     *ring pointer to an hdc2080 ring structure
+ * @param[in,out] *sample pointer to a sample
+ * @return        status code
+ *                - 0 success
+ *                - 1 ring is full
+ *                - 2 ring is NULL
+ *                - 3 ring is not initialized
+ * @note          only one thread may push, it never blocks and the sequence number is filled in,
+ *                a sample that does not fit is counted as dropped
+ */
+uint8_t hdc2080_ring_push(hdc2080_ring_t *ring, hdc2080_ring_sample_t *sample);
+
+/**
+ * @brief      pop up to len samples
+ * @param[in]  *ring pointer to an hdc2080 ring structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length
+ * @param[out] *num pointer to a popped number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       only one thread may pop, it never blocks and the slots are released once per batch
+ */
+uint8_t hdc2080_ring_pop(hdc2080_ring_t *ring, hdc2080_ring_sample_t *sample, uint32_t len, uint32_t *num);
+
+/**
+ * @brief      get the queued sample number
+ * @param[in]  *ring pointer to an hdc2080 ring structure
+ * @param[out] *num pointer to a number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       the result is a snapshot while the other side is running
+ */
+uint8_t hdc2080_ring_get_count(hdc2080_ring_t *ring, uint32_t *num);
+
+/**
+ * @brief      get the dropped sample number
+ * @param[in]  *ring pointer to an hdc2080 ring structure
+ * @param[out] *num pointer to a number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       none
+ */
+uint8_t hdc2080_ring_get_dropped(hdc2080_ring_t *ring, uint32_t *num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,265 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_scheduler.c
+ * @brief     driver hdc2080 scheduler source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_scheduler.h"
+
+/**
+ * @brief     check a deadline
+ * @param[in] now_us current time
+ * @param[in] deadline_us deadline
+ * @return    1 if due, else 0
+ * @note      the time may wrap around
+ */
+static uint8_t a_hdc2080_scheduler_due(uint32_t now_us, uint32_t deadline_us)
+{
+    return ((int32_t)(now_us - deadline_us) >= 0) ? 1 : 0;        /* compare with wrap */
+}
+
+/**
+ * @brief         fetch a finished conversion
+ * @param[in,out] *sensor pointer to a sensor
+ * @param[in]     now_us current time
+ * @note          a not ready result is retried later until the conversion deadline passes
+ */
+static void a_hdc2080_scheduler_fetch(hdc2080_scheduler_sensor_t *sensor, uint32_t now_us)
+{
+    uint8_t res;
+    uint16_t temperature_raw;
+    int16_t temperature_centi;
+    uint16_t humidity_raw;
+    uint16_t humidity_centi;
+    
+    res = hdc2080_try_fetch_centi(sensor->handle, &temperature_raw, &temperature_centi,
+                                  &humidity_raw, &humidity_centi);        /* try to fetch */
+    if (res == 0)                                                         /* check result */
+    {
+        sensor->temperature_raw = temperature_raw;                        /* save temperature raw */
+        sensor->temperature_centi = temperature_centi;                    /* save temperature */
+        sensor->humidity_raw = humidity_raw;                              /* save humidity raw */
+        sensor->humidity_centi = humidity_centi;                          /* save humidity */
+        sensor->timestamp_us = now_us;                                    /* save time */
+        sensor->samples++;                                                /* sample done */
+        sensor->state = HDC2080_SCHEDULER_STATE_IDLE;                     /* set idle */
+    }
+    else if ((res == 4) &&
+             (a_hdc2080_scheduler_due(now_us, sensor->deadline_us) == 0)) /* not ready */
+    {
+        sensor->ready_us = now_us + HDC2080_SCHEDULER_RETRY_US;           /* retry later */
+    }
+    else
+    {
+        sensor->errors++;                                                 /* fetch failed or timed out */
+        sensor->state = HDC2080_SCHEDULER_STATE_IDLE;                     /* set idle */
+    }
+}
+
+/**
+ * @brief         init the scheduler
+ * @param[in,out] *scheduler pointer to an hdc2080 scheduler structure
+ * @param[in,out] *sensor pointer to a sensor table with the handles filled in
+ * @param[in]     count sensor table length
+ * @param[in]     rate_hz aggregate trigger rate of all sensors
+ * @param[in]     now_us current time
+ * @return        status code
+ *                - 0 success
+ *                - 1 get conversion time failed
+ *                - 2 scheduler is NULL
+ *                - 4 param is invalid
+ * @note          the handles must be initialized, every sensor is sampled at rate_hz / count,
+ *                the triggers are spaced 1 / rate_hz apart so the conversions overlap
+ */
+uint8_t hdc2080_scheduler_init(hdc2080_scheduler_t *scheduler, hdc2080_scheduler_sensor_t *sensor,
+                               uint32_t count, uint32_t rate_hz, uint32_t now_us)
+{
+    uint32_t i;
+    hdc2080_handle_t *handle;
+    
+    if (scheduler == NULL)                                                                   /* check scheduler */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if ((sensor == NULL) || (count == 0) || (rate_hz == 0) || (rate_hz > 1000000))           /* check params */
+    {
+        return 4;                                                                            /* return error */
+    }
+    for (i = 0; i < count; i++)                                                              /* check all handles */
+    {
+        if (sensor[i].handle == NULL)                                                        /* check handle */
+        {
+            return 4;                                                                        /* return error */
+        }
+    }
+    
+    for (i = 0; i < count; i++)                                                              /* init all sensors */
+    {
+        handle = sensor[i].handle;                                                           /* save handle */
+        memset(&sensor[i], 0, sizeof(hdc2080_scheduler_sensor_t));                           /* clear sensor */
+        sensor[i].handle = handle;                                                           /* set handle */
+        if (hdc2080_get_conversion_time(handle, &sensor[i].conversion_us) != 0)              /* get conversion time */
+        {
+            return 1;                                                                        /* return error */
+        }
+        sensor[i].state = HDC2080_SCHEDULER_STATE_IDLE;                                      /* set idle */
+    }
+    scheduler->sensor = sensor;                                                              /* set sensor table */
+    scheduler->count = count;                                                                /* set count */
+    scheduler->interval_us = 1000000 / rate_hz;                                              /* set interval */
+    scheduler->next = 0;                                                                     /* start from the first */
+    scheduler->next_trigger_us = now_us;                                                     /* trigger now */
+    scheduler->inited = 1;                                                                   /* flag finish initialization */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     deinit the scheduler
+ * @param[in] *scheduler pointer to an hdc2080 scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ *            - 3 scheduler is not initialized
+ * @note      the handles are not closed
+ */
+uint8_t hdc2080_scheduler_deinit(hdc2080_scheduler_t *scheduler)
+{
+    if (scheduler == NULL)              /* check scheduler */
+    {
+        return 2;                       /* return error */
+    }
+    if (scheduler->inited != 1)         /* check scheduler initialization */
+    {
+        return 3;                       /* return error */
+    }
+    
+    scheduler->inited = 0;              /* set closed flag */
+    
+    return 0;                           /* success return 0 */
+}
+
+/**
+ * @brief      run the due fetches and triggers
+ * @param[in]  *scheduler pointer to an hdc2080 scheduler structure
+ * @param[in]  now_us current time
+ * @param[out] *wait_us pointer to a time buffer until the next due event
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ * @note       it never sleeps and all bus transfers are issued one after another from the calling thread,
+ *             finished conversions are fetched before new triggers and failures are counted per sensor
+ *             a conversion still not ready at its deadline is counted as an error and the sensor returns to idle
+ */
+uint8_t hdc2080_scheduler_poll(hdc2080_scheduler_t *scheduler, uint32_t now_us, uint32_t *wait_us)
+{
+    uint32_t i;
+    uint32_t wait;
+    uint32_t left;
+    hdc2080_scheduler_sensor_t *sensor;
+    
+    if (scheduler == NULL)                                                                           /* check scheduler */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if (scheduler->inited != 1)                                                                      /* check scheduler initialization */
+    {
+        return 3;                                                                                    /* return error */
+    }
+    
+    for (i = 0; i < scheduler->count; i++)                                                           /* fetch the finished conversions */
+    {
+        sensor = &scheduler->sensor[i];                                                              /* get sensor */
+        if ((sensor->state == HDC2080_SCHEDULER_STATE_CONVERTING) &&
+            (a_hdc2080_scheduler_due(now_us, sensor->ready_us) != 0))                                /* check ready */
+        {
+            a_hdc2080_scheduler_fetch(sensor, now_us);                                               /* fetch */
+        }
+    }
+    if (((uint64_t)(now_us - scheduler->next_trigger_us) >
+         ((uint64_t)scheduler->interval_us * scheduler->count)) &&
+        (a_hdc2080_scheduler_due(now_us, scheduler->next_trigger_us) != 0))                          /* check a long stall */
+    {
+        scheduler->next_trigger_us = now_us;                                                         /* resync instead of a burst */
+    }
+    for (i = 0; i < scheduler->count; i++)                                                           /* run the due triggers */
+    {
+        if (a_hdc2080_scheduler_due(now_us, scheduler->next_trigger_us) == 0)                        /* check trigger time */
+        {
+            break;                                                                                   /* break */
+        }
+        sensor = &scheduler->sensor[scheduler->next];                                                /* get sensor */
+        if (sensor->state == HDC2080_SCHEDULER_STATE_CONVERTING)                                     /* check busy */
+        {
+            sensor->overruns++;                                                                      /* skip this period */
+        }
+        else if (hdc2080_trigger_measurement(sensor->handle) != 0)                                   /* trigger */
+        {
+            sensor->errors++;                                                                        /* trigger failed */
+        }
+        else
+        {
+            sensor->state = HDC2080_SCHEDULER_STATE_CONVERTING;                                      /* set converting */
+            sensor->ready_us = now_us + sensor->conversion_us;                                       /* set ready time */
+            sensor->deadline_us = sensor->ready_us + HDC2080_SCHEDULER_MARGIN_US;                    /* set deadline */
+        }
+        scheduler->next = (scheduler->next + 1) % scheduler->count;                                  /* next sensor */
+        scheduler->next_trigger_us += scheduler->interval_us;                                        /* next trigger time */
+    }
+    
+    if (wait_us != NULL)                                                                             /* check wait buffer */
+    {
+        wait = scheduler->next_trigger_us - now_us;                                                  /* time to the next trigger */
+        if (a_hdc2080_scheduler_due(now_us, scheduler->next_trigger_us) != 0)                        /* check due */
+        {
+            wait = 0;                                                                                /* due now */
+        }
+        for (i = 0; i < scheduler->count; i++)                                                       /* time to the next fetch */
+        {
+            sensor = &scheduler->sensor[i];                                                          /* get sensor */
+            if (sensor->state == HDC2080_SCHEDULER_STATE_CONVERTING)                                 /* check converting */
+            {
+                left = (a_hdc2080_scheduler_due(now_us, sensor->ready_us) != 0) ?
+                       0 : (sensor->ready_us - now_us);                                              /* get left time */
+                if (left < wait)                                                                     /* check min */
+                {
+                    wait = left;                                                                     /* set min */
+                }
+            }
+        }
+        *wait_us = wait;                                                                             /* set wait time */
+    }
+    
+    return 0;                                                                                        /* success return 0 */
+}
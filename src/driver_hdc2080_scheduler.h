@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_scheduler.h
+ * @brief     driver hdc2080 scheduler header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC2080_SCHEDULER_H
+#define DRIVER_HDC2080_SCHEDULER_H
+
+#include "driver_hdc2080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc2080_scheduler_driver hdc2080 scheduler driver function
+ * @brief    hdc2080 scheduler driver modules
+ * @ingroup  hdc2080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc2080 scheduler retry time definition
+ */
+#ifndef HDC2080_SCHEDULER_RETRY_US
+    #define HDC2080_SCHEDULER_RETRY_US        50        /**< 50us */
+#endif
+
+/**
+ * @brief hdc2080 scheduler conversion margin definition
+ */
+#ifndef HDC2080_SCHEDULER_MARGIN_US
+    #define HDC2080_SCHEDULER_MARGIN_US       10000        /**< 10ms */
+#endif
+
+/**
+ * @brief hdc2080 scheduler state enumeration definition
+ */
+typedef enum
+{
+    HDC2080_SCHEDULER_STATE_IDLE       = 0x00,        /**< waiting for the trigger */
+    HDC2080_SCHEDULER_STATE_CONVERTING = 0x01,        /**< conversion in progress */
+} hdc2080_scheduler_state_t;
+
+/**
+ * @brief hdc2080 scheduler sensor structure definition
+ */
+typedef struct hdc2080_scheduler_sensor_s
+{
+    hdc2080_handle_t *handle;             /**< initialized hdc2080 handle */
+    uint8_t state;                        /**< scheduler state */
+    uint32_t conversion_us;               /**< conversion time */
+    uint32_t ready_us;                    /**< time to fetch the result */
+    uint32_t deadline_us;                 /**< time to give up the conversion */
+    uint16_t temperature_raw;             /**< last raw temperature */
+    int16_t temperature_centi;            /**< last temperature in 0.01 degrees */
+    uint16_t humidity_raw;                /**< last raw humidity */
+    uint16_t humidity_centi;              /**< last humidity in 0.01 percent */
+    uint32_t timestamp_us;                /**< time of the last result */
+    uint32_t samples;                     /**< fetched results */
+    uint32_t errors;                      /**< failed bus transactions and timeouts */
+    uint32_t overruns;                    /**< skipped triggers of a busy sensor */
+} hdc2080_scheduler_sensor_t;
+
+/**
+ * @brief hdc2080 scheduler structure definition
+ */
+typedef struct hdc2080_scheduler_s
+{
+    hdc2080_scheduler_sensor_t *sensor;        /**< sensor table */
+    uint32_t count;                            /**< sensor table length */
+    uint32_t interval_us;                      /**< time between two triggers */
+    uint32_t next;                             /**< next sensor to trigger */
+    uint32_t next_trigger_us;                  /**< time of the next trigger */
+    uint8_t inited;                            /**< inited flag */
+} hdc2080_scheduler_t;
+
+/**
+ * @brief         init the scheduler
+ * @param[in,out] *scheduler pointer to an hdc2080 scheduler structure
+ * @param[in,out] *sensor pointer to a sensor table with the handles filled in
+ * @param[in]     count sensor table length
+ * @param[in]     rate_hz aggregate trigger rate of all sensors
+ * @param[in]     now_us current time
+ * @return        status code
+ *                - 0 success
+ *                - 1 get conversion time failed
+ *                - 2 scheduler is NULL
+ *                - 4 param is invalid
+ * @note          the handles must be initialized, every sensor is sampled at rate_hz / count,
+ *                the triggers are spaced 1 / rate_hz apart so the conversions overlap
+ */
+uint8_t hdc2080_scheduler_init(hdc2080_scheduler_t *scheduler, hdc2080_scheduler_sensor_t *sensor,
+                               uint32_t count, uint32_t rate_hz, uint32_t now_us);
+
+/**
+ * @brief     deinit the scheduler
+ * @param[in] *scheduler pointer to an hdc2080 scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ *            - 3 scheduler is not initialized
+ * @note      the handles are not closed
+ */
+uint8_t hdc2080_scheduler_deinit(hdc2080_scheduler_t *scheduler);
+
+/**
+ * @brief      run the due fetches and triggers
+ * @param[in]  *scheduler pointer to an hdc2080 scheduler structure
+ * @param[in]  now_us current time
+ * @param[out] *wait_us pointer to a time buffer until the next due event
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ * @note       it never sleeps and all bus transfers are issued one after another from the calling thread,
+ *             finished conversions are fetched before new triggers and failures are counted per sensor
+ *             a conversion still not ready at its deadline is counted as an error and the sensor returns to idle
+ */
+uint8_t hdc2080_scheduler_poll(hdc2080_scheduler_t *scheduler, uint32_t now_us, uint32_t *wait_us);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
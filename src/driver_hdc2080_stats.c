@@ -0,0 +1,624 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_stats.c
+ * @brief     driver hdc2080 stats source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_stats.h"
+
+/**
+ * @brief hdc2080 stats q16 definition
+ */
+#define HDC2080_STATS_Q16        65536        /**< q16 one */
+
+/**
+ * @brief hdc2080 stats input range definition
+ */
+#define HDC2080_STATS_TEMPERATURE_MIN        -4050        /**< lowest converted temperature in 0.01 degrees */
+#define HDC2080_STATS_TEMPERATURE_MAX        12500        /**< highest converted temperature in 0.01 degrees */
+#define HDC2080_STATS_HUMIDITY_MAX           10000        /**< highest humidity in 0.01 percent */
+
+/**
+ * @brief     round a q16 value to an integer
+ * @param[in] v q16 value
+ * @return    rounded value
+ * @note      the halves are rounded away from zero
+ */
+static int32_t a_hdc2080_stats_round_q16(int64_t v)
+{
+    if (v >= 0)                                                                     /* check sign */
+    {
+        return (int32_t)((v + HDC2080_STATS_Q16 / 2) / HDC2080_STATS_Q16);          /* round up */
+    }
+    else
+    {
+        return -(int32_t)((-v + HDC2080_STATS_Q16 / 2) / HDC2080_STATS_Q16);        /* round down */
+    }
+}
+
+/**
+ * @brief     start a new fixed point channel window
+ * @param[in] *channel pointer to an hdc2080 stats channel centi structure
+ * @note      the ewma is kept
+ */
+static void a_hdc2080_stats_channel_reset_centi(hdc2080_stats_channel_centi_t *channel)
+{
+    channel->mean_q16 = 0;           /* clear mean */
+    channel->m2_q16 = 0;             /* clear squared sum */
+    channel->min = INT32_MAX;        /* set min */
+    channel->max = INT32_MIN;        /* set max */
+}
+
+/**
+ * @brief     update a fixed point channel with Welford's method
+ * @param[in] *channel pointer to an hdc2080 stats channel centi structure
+ * @param[in] x sample in 0.01 units
+ * @param[in] n sample number including this sample
+ * @param[in] alpha_q16 ewma weight in q16
+ * @param[in] seeded ewma seeded flag
+ * @note      the samples are clamped to the sensor range, a span of 16550 keeps the deviation below 2^31
+ *            and every product below 2^62
+ */
+static void a_hdc2080_stats_channel_update_centi(hdc2080_stats_channel_centi_t *channel, int32_t x, uint32_t n,
+                                                 uint32_t alpha_q16, uint8_t seeded)
+{
+    int64_t x_q16;
+    int64_t delta;
+    int64_t square;
+    
+    x_q16 = (int64_t)x * HDC2080_STATS_Q16;                                                                 /* convert to q16 */
+    delta = x_q16 - channel->mean_q16;                                                                      /* deviation from the old mean */
+    channel->mean_q16 += delta / (int64_t)n;                                                                /* update mean */
+    square = (delta * (x_q16 - channel->mean_q16)) / HDC2080_STATS_Q16;                                     /* old deviation times new deviation */
+    if (square > 0)                                                                                         /* the rounding may give a tiny negative */
+    {
+        if ((UINT64_MAX - channel->m2_q16) < (uint64_t)square)                                              /* check saturation */
+        {
+            channel->m2_q16 = UINT64_MAX;                                                                   /* saturate */
+        }
+        else
+        {
+            channel->m2_q16 += (uint64_t)square;                                                            /* update squared sum */
+        }
+    }
+    if (x < channel->min)                                                                                   /* check min */
+    {
+        channel->min = x;                                                                                   /* set min */
+    }
+    if (x > channel->max)                                                                                   /* check max */
+    {
+        channel->max = x;                                                                                   /* set max */
+    }
+    if (seeded == 0)                                                                                        /* check ewma */
+    {
+        channel->ewma_q16 = x_q16;                                                                          /* seed ewma */
+    }
+    else
+    {
+        channel->ewma_q16 += ((x_q16 - channel->ewma_q16) * (int64_t)alpha_q16) / HDC2080_STATS_Q16;        /* update ewma */
+    }
+}
+
+/**
+ * @brief      summarize a fixed point channel
+ * @param[in]  *channel pointer to an hdc2080 stats channel centi structure
+ * @param[in]  n sample number
+ * @param[out] *summary pointer to a channel summary buffer
+ * @note       n must not be 0
+ */
+static void a_hdc2080_stats_channel_summary_centi(hdc2080_stats_channel_centi_t *channel, uint32_t n,
+                                                  hdc2080_stats_channel_summary_centi_t *summary)
+{
+    uint64_t variance;
+    
+    summary->min = channel->min;                                                              /* set min */
+    summary->max = channel->max;                                                              /* set max */
+    summary->mean = a_hdc2080_stats_round_q16(channel->mean_q16);                             /* set mean */
+    summary->ewma = a_hdc2080_stats_round_q16(channel->ewma_q16);                             /* set ewma */
+    if (n > 1)                                                                                /* check sample number */
+    {
+        variance = channel->m2_q16 / (uint64_t)(n - 1);                                       /* sample variance in q16 */
+        variance = (variance + HDC2080_STATS_Q16 / 2) / HDC2080_STATS_Q16;                    /* round */
+        summary->variance = (variance > UINT32_MAX) ? UINT32_MAX : (uint32_t)variance;        /* set variance */
+    }
+    else
+    {
+        summary->variance = 0;                                                                /* a single sample has no spread */
+    }
+}
+
+/**
+ * @brief      summarize the fixed point stats
+ * @param[in]  *stats pointer to an hdc2080 stats centi structure
+ * @param[out] *summary pointer to a summary buffer
+ * @note       the window must not be empty
+ */
+static void a_hdc2080_stats_summary_centi(hdc2080_stats_centi_t *stats, hdc2080_stats_summary_centi_t *summary)
+{
+    summary->count = stats->count;                                                                          /* set count */
+    summary->window = stats->window;                                                                        /* set window */
+    summary->first_us = stats->first_us;                                                                    /* set first time */
+    summary->last_us = stats->last_us;                                                                      /* set last time */
+    a_hdc2080_stats_channel_summary_centi(&stats->temperature, stats->count, &summary->temperature);        /* temperature */
+    a_hdc2080_stats_channel_summary_centi(&stats->humidity, stats->count, &summary->humidity);              /* humidity */
+}
+
+/**
+ * @brief     init the fixed point stats
+ * @param[in] *stats pointer to an hdc2080 stats centi structure
+ * @param[in] length window length, 0 keeps one window forever
+ * @param[in] alpha_q16 ewma weight of a new sample in q16, 1 - 65536
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 4 param is invalid
+ * @note      the update costs O(1) with one 64 bit division per channel,
+ *            a window holds at least 2^20 full scale samples before the squared sum saturates
+ */
+uint8_t hdc2080_stats_init_centi(hdc2080_stats_centi_t *stats, uint32_t length, uint32_t alpha_q16)
+{
+    if (stats == NULL)                                              /* check stats */
+    {
+        return 2;                                                   /* return error */
+    }
+    if ((alpha_q16 == 0) || (alpha_q16 > HDC2080_STATS_Q16))        /* check alpha */
+    {
+        return 4;                                                   /* return error */
+    }
+    
+    stats->length = length;                                         /* set length */
+    stats->alpha_q16 = alpha_q16;                                   /* set alpha */
+    stats->inited = 1;                                              /* flag finish initialization */
+    
+    return hdc2080_stats_reset_centi(stats);                        /* reset */
+}
+
+/**
+ * @brief     reset the fixed point stats
+ * @param[in] *stats pointer to an hdc2080 stats centi structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ * @note      the window, the ewma and the latched summary are cleared
+ */
+uint8_t hdc2080_stats_reset_centi(hdc2080_stats_centi_t *stats)
+{
+    if (stats == NULL)                                                     /* check stats */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (stats->inited != 1)                                                /* check stats initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    a_hdc2080_stats_channel_reset_centi(&stats->temperature);              /* reset temperature */
+    a_hdc2080_stats_channel_reset_centi(&stats->humidity);                 /* reset humidity */
+    stats->temperature.ewma_q16 = 0;                                       /* clear temperature ewma */
+    stats->humidity.ewma_q16 = 0;                                          /* clear humidity ewma */
+    memset(&stats->last, 0, sizeof(hdc2080_stats_summary_centi_t));        /* clear last summary */
+    stats->first_us = 0;                                                   /* clear first time */
+    stats->last_us = 0;                                                    /* clear last time */
+    stats->count = 0;                                                      /* clear count */
+    stats->window = 0;                                                     /* clear window */
+    stats->seeded = 0;                                                     /* clear seeded */
+    stats->ready = 0;                                                      /* clear ready */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     update the fixed point stats with a sample
+ * @param[in] *stats pointer to an hdc2080 stats centi structure
+ * @param[in] timestamp_us time of the sample
+ * @param[in] temperature_centi temperature in 0.01 degrees
+ * @param[in] humidity_centi humidity in 0.01 percent
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ * @note      the min, max, mean and variance are updated with Welford's method,
+ *            a full window is latched for hdc2080_stats_get_window_centi and a new window is started,
+ *            the ewma runs across the windows, the inputs are clamped to -40.50C - 125.00C and 0% - 100%
+ */
+uint8_t hdc2080_stats_update_centi(hdc2080_stats_centi_t *stats, uint64_t timestamp_us,
+                                   int16_t temperature_centi, uint16_t humidity_centi)
+{
+    if (stats == NULL)                                                            /* check stats */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (stats->inited != 1)                                                       /* check stats initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    
+    if (temperature_centi < HDC2080_STATS_TEMPERATURE_MIN)                        /* check temperature min */
+    {
+        temperature_centi = HDC2080_STATS_TEMPERATURE_MIN;                        /* clamp temperature */
+    }
+    if (temperature_centi > HDC2080_STATS_TEMPERATURE_MAX)                        /* check temperature max */
+    {
+        temperature_centi = HDC2080_STATS_TEMPERATURE_MAX;                        /* clamp temperature */
+    }
+    if (humidity_centi > HDC2080_STATS_HUMIDITY_MAX)                              /* check humidity max */
+    {
+        humidity_centi = HDC2080_STATS_HUMIDITY_MAX;                              /* clamp humidity */
+    }
+    if (stats->count == 0)                                                        /* check the first sample */
+    {
+        stats->first_us = timestamp_us;                                           /* set first time */
+    }
+    stats->last_us = timestamp_us;                                                /* set last time */
+    stats->count++;                                                               /* count the sample */
+    a_hdc2080_stats_channel_update_centi(&stats->temperature, temperature_centi, stats->count,
+                                         stats->alpha_q16, stats->seeded);        /* update temperature */
+    a_hdc2080_stats_channel_update_centi(&stats->humidity, humidity_centi, stats->count,
+                                         stats->alpha_q16, stats->seeded);        /* update humidity */
+    stats->seeded = 1;                                                            /* flag ewma seeded */
+    if ((stats->length != 0) && (stats->count >= stats->length))                  /* check the window end */
+    {
+        a_hdc2080_stats_summary_centi(stats, &stats->last);                       /* latch the window */
+        stats->ready = 1;                                                         /* flag ready */
+        stats->window++;                                                          /* next window */
+        stats->count = 0;                                                         /* clear count */
+        a_hdc2080_stats_channel_reset_centi(&stats->temperature);                 /* reset temperature */
+        a_hdc2080_stats_channel_reset_centi(&stats->humidity);                    /* reset humidity */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the summary of the running window
+ * @param[in]  *stats pointer to an hdc2080 stats centi structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or summary is NULL
+ *             - 3 stats is not initialized
+ *             - 4 window is empty
+ * @note       the variance of a single sample is 0
+ */
+uint8_t hdc2080_stats_get_summary_centi(hdc2080_stats_centi_t *stats, hdc2080_stats_summary_centi_t *summary)
+{
+    if ((stats == NULL) || (summary == NULL))             /* check stats and summary */
+    {
+        return 2;                                         /* return error */
+    }
+    if (stats->inited != 1)                               /* check stats initialization */
+    {
+        return 3;                                         /* return error */
+    }
+    if (stats->count == 0)                                /* check window */
+    {
+        return 4;                                         /* return error */
+    }
+    
+    a_hdc2080_stats_summary_centi(stats, summary);        /* summarize */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the summary of the last full window
+ * @param[in]  *stats pointer to an hdc2080 stats centi structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or summary is NULL
+ *             - 3 stats is not initialized
+ *             - 4 no new window
+ * @note       every full window is returned once, a window closed before the last one was read
+ *             is overwritten and shows up as a gap in the window sequence number
+ */
+uint8_t hdc2080_stats_get_window_centi(hdc2080_stats_centi_t *stats, hdc2080_stats_summary_centi_t *summary)
+{
+    if ((stats == NULL) || (summary == NULL))        /* check stats and summary */
+    {
+        return 2;                                    /* return error */
+    }
+    if (stats->inited != 1)                          /* check stats initialization */
+    {
+        return 3;                                    /* return error */
+    }
+    if (stats->ready == 0)                           /* check ready */
+    {
+        return 4;                                    /* return error */
+    }
+    
+    *summary = stats->last; /* copy the window */
+    stats->ready = 0;                                /* clear ready */
+    
+    return 0;                                        /* success return 0 */
+}
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief     start a new channel window
+ * @param[in] *channel pointer to an hdc2080 stats channel structure
+ * @note      the ewma is kept
+ */
+static void a_hdc2080_stats_channel_reset(hdc2080_stats_channel_t *channel)
+{
+    channel->mean = 0.0f;        /* clear mean */
+    channel->m2 = 0.0f;          /* clear squared sum */
+    channel->min = 0.0f;         /* clear min */
+    channel->max = 0.0f;         /* clear max */
+}
+
+/**
+ * @brief     update a channel with Welford's method
+ * @param[in] *channel pointer to an hdc2080 stats channel structure
+ * @param[in] x sample
+ * @param[in] n sample number including this sample
+ * @param[in] alpha ewma weight
+ * @param[in] seeded ewma seeded flag
+ * @note      none
+ */
+static void a_hdc2080_stats_channel_update(hdc2080_stats_channel_t *channel, float x, uint32_t n,
+                                           float alpha, uint8_t seeded)
+{
+    float delta;
+    
+    delta = x - channel->mean;                               /* deviation from the old mean */
+    channel->mean += delta / (float)n;                       /* update mean */
+    channel->m2 += delta * (x - channel->mean);              /* update squared sum */
+    if ((n == 1) || (x < channel->min))                      /* check min */
+    {
+        channel->min = x;                                    /* set min */
+    }
+    if ((n == 1) || (x > channel->max))                      /* check max */
+    {
+        channel->max = x;                                    /* set max */
+    }
+    if (seeded == 0)                                         /* check ewma */
+    {
+        channel->ewma = x;                                   /* seed ewma */
+    }
+    else
+    {
+        channel->ewma += (x - channel->ewma) * alpha;        /* update ewma */
+    }
+}
+
+/**
+ * @brief      summarize a channel
+ * @param[in]  *channel pointer to an hdc2080 stats channel structure
+ * @param[in]  n sample number
+ * @param[out] *summary pointer to a channel summary buffer
+ * @note       n must not be 0
+ */
+static void a_hdc2080_stats_channel_summary(hdc2080_stats_channel_t *channel, uint32_t n,
+                                            hdc2080_stats_channel_summary_t *summary)
+{
+    summary->min = channel->min;                                                /* set min */
+    summary->max = channel->max;                                                /* set max */
+    summary->mean = channel->mean;                                              /* set mean */
+    summary->ewma = channel->ewma;                                              /* set ewma */
+    summary->variance = (n > 1) ? (channel->m2 / (float)(n - 1)) : 0.0f;        /* set variance */
+}
+
+/**
+ * @brief      summarize the stats
+ * @param[in]  *stats pointer to an hdc2080 stats structure
+ * @param[out] *summary pointer to a summary buffer
+ * @note       the window must not be empty
+ */
+static void a_hdc2080_stats_summary(hdc2080_stats_t *stats, hdc2080_stats_summary_t *summary)
+{
+    summary->count = stats->count;                                                                    /* set count */
+    summary->window = stats->window;                                                                  /* set window */
+    summary->first_us = stats->first_us;                                                              /* set first time */
+    summary->last_us = stats->last_us;                                                                /* set last time */
+    a_hdc2080_stats_channel_summary(&stats->temperature, stats->count, &summary->temperature);        /* temperature */
+    a_hdc2080_stats_channel_summary(&stats->humidity, stats->count, &summary->humidity);              /* humidity */
+}
+
+/**
+ * @brief     init the stats
+ * @param[in] *stats pointer to an hdc2080 stats structure
+ * @param[in] length window length, 0 keeps one window forever
+ * @param[in] alpha ewma weight of a new sample, (0, 1]
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 4 param is invalid
+ * @note      none
+ */
+uint8_t hdc2080_stats_init(hdc2080_stats_t *stats, uint32_t length, float alpha)
+{
+    if (stats == NULL)                               /* check stats */
+    {
+        return 2;                                    /* return error */
+    }
+    if (!((alpha > 0.0f) && (alpha <= 1.0f)))        /* check alpha, nan is rejected too */
+    {
+        return 4;                                    /* return error */
+    }
+    
+    stats->length = length;                          /* set length */
+    stats->alpha = alpha;                            /* set alpha */
+    stats->inited = 1;                               /* flag finish initialization */
+    
+    return hdc2080_stats_reset(stats);               /* reset */
+}
+
+/**
+ * @brief     reset the stats
+ * @param[in] *stats pointer to an hdc2080 stats structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ * @note      the window, the ewma and the latched summary are cleared
+ */
+uint8_t hdc2080_stats_reset(hdc2080_stats_t *stats)
+{
+    if (stats == NULL)                                               /* check stats */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (stats->inited != 1)                                          /* check stats initialization */
+    {
+        return 3;                                                    /* return error */
+    }
+    
+    a_hdc2080_stats_channel_reset(&stats->temperature);              /* reset temperature */
+    a_hdc2080_stats_channel_reset(&stats->humidity);                 /* reset humidity */
+    stats->temperature.ewma = 0.0f;                                  /* clear temperature ewma */
+    stats->humidity.ewma = 0.0f;                                     /* clear humidity ewma */
+    memset(&stats->last, 0, sizeof(hdc2080_stats_summary_t));        /* clear last summary */
+    stats->first_us = 0;                                             /* clear first time */
+    stats->last_us = 0;                                              /* clear last time */
+    stats->count = 0;                                                /* clear count */
+    stats->window = 0;                                               /* clear window */
+    stats->seeded = 0;                                               /* clear seeded */
+    stats->ready = 0;                                                /* clear ready */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     update the stats with a sample
+ * @param[in] *stats pointer to an hdc2080 stats structure
+ * @param[in] timestamp_us time of the sample
+ * @param[in] temperature temperature in degrees
+ * @param[in] humidity humidity in percent
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ * @note      the min, max, mean and variance are updated with Welford's method,
+ *            a full window is latched for hdc2080_stats_get_window and a new window is started,
+ *            the ewma runs across the windows
+ */
+uint8_t hdc2080_stats_update(hdc2080_stats_t *stats, uint64_t timestamp_us, float temperature, float humidity)
+{
+    if (stats == NULL)                                                  /* check stats */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (stats->inited != 1)                                             /* check stats initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    
+    if (stats->count == 0)                                              /* check the first sample */
+    {
+        stats->first_us = timestamp_us;                                 /* set first time */
+    }
+    stats->last_us = timestamp_us;                                      /* set last time */
+    stats->count++;                                                     /* count the sample */
+    a_hdc2080_stats_channel_update(&stats->temperature, temperature, stats->count,
+                                   stats->alpha, stats->seeded);        /* update temperature */
+    a_hdc2080_stats_channel_update(&stats->humidity, humidity, stats->count,
+                                   stats->alpha, stats->seeded);        /* update humidity */
+    stats->seeded = 1;                                                  /* flag ewma seeded */
+    if ((stats->length != 0) && (stats->count >= stats->length))        /* check the window end */
+    {
+        a_hdc2080_stats_summary(stats, &stats->last);                   /* latch the window */
+        stats->ready = 1;                                               /* flag ready */
+        stats->window++;                                                /* next window */
+        stats->count = 0;                                               /* clear count */
+        a_hdc2080_stats_channel_reset(&stats->temperature);             /* reset temperature */
+        a_hdc2080_stats_channel_reset(&stats->humidity);                /* reset humidity */
+    }
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      get the summary of the running window
+ * @param[in]  *stats pointer to an hdc2080 stats structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or summary is NULL
+ *             - 3 stats is not initialized
+ *             - 4 window is empty
+ * @note       the variance of a single sample is 0
+ */
+uint8_t hdc2080_stats_get_summary(hdc2080_stats_t *stats, hdc2080_stats_summary_t *summary)
+{
+    if ((stats == NULL) || (summary == NULL))        /* check stats and summary */
+    {
+        return 2;                                    /* return error */
+    }
+    if (stats->inited != 1)                          /* check stats initialization */
+    {
+        return 3;                                    /* return error */
+    }
+    if (stats->count == 0)                           /* check window */
+    {
+        return 4;                                    /* return error */
+    }
+    
+    a_hdc2080_stats_summary(stats, summary);         /* summarize */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the summary of the last full window
+ * @param[in]  *stats pointer to an hdc2080 stats structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or summary is NULL
+ *             - 3 stats is not initialized
+ *             - 4 no new window
+ * @note       every full window is returned once
+ */
+uint8_t hdc2080_stats_get_window(hdc2080_stats_t *stats, hdc2080_stats_summary_t *summary)
+{
+    if ((stats == NULL) || (summary == NULL))        /* check stats and summary */
+    {
+        return 2;                                    /* return error */
+    }
+    if (stats->inited != 1)                          /* check stats initialization */
+    {
+        return 3;                                    /* return error */
+    }
+    if (stats->ready == 0)                           /* check ready */
+    {
+        return 4;                                    /* return error */
+    }
+    
+    *summary = stats->last; /* copy the window */
+    stats->ready = 0;                                /* clear ready */
+    
+    return 0;                                        /* success return 0 */
+}
+#endif
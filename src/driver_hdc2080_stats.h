@@ -0,0 +1,312 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_stats.h
+ * @brief     driver hdc2080 stats header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC2080_STATS_H
+#define DRIVER_HDC2080_STATS_H
+
+#include "driver_hdc2080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc2080_stats_driver hdc2080 stats driver function
+ * @brief    hdc2080 stats driver modules
+ * @ingroup  hdc2080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc2080 stats fixed point channel structure definition
+ */
+typedef struct hdc2080_stats_channel_centi_s
+{
+    int64_t mean_q16;         /**< running mean in 0.01 units, q16 */
+    uint64_t m2_q16;          /**< sum of the squared deviations in 0.0001 units, q16 */
+    int64_t ewma_q16;         /**< ewma in 0.01 units, q16 */
+    int32_t min;              /**< min in 0.01 units */
+    int32_t max;              /**< max in 0.01 units */
+} hdc2080_stats_channel_centi_t;
+
+/**
+ * @brief hdc2080 stats fixed point channel summary structure definition
+ */
+typedef struct hdc2080_stats_channel_summary_centi_s
+{
+    int32_t min;              /**< min in 0.01 units */
+    int32_t max;              /**< max in 0.01 units */
+    int32_t mean;             /**< mean in 0.01 units */
+    int32_t ewma;             /**< ewma in 0.01 units */
+    uint32_t variance;        /**< sample variance in 0.0001 units */
+} hdc2080_stats_channel_summary_centi_t;
+
+/**
+ * @brief hdc2080 stats fixed point summary structure definition
+ */
+typedef struct hdc2080_stats_summary_centi_s
+{
+    uint32_t count;                                        /**< sample number */
+    uint32_t window;                                       /**< window sequence number */
+    uint64_t first_us;                                     /**< time of the first sample */
+    uint64_t last_us;                                      /**< time of the last sample */
+    hdc2080_stats_channel_summary_centi_t temperature;     /**< temperature in 0.01 degrees */
+    hdc2080_stats_channel_summary_centi_t humidity;        /**< humidity in 0.01 percent */
+} hdc2080_stats_summary_centi_t;
+
+/**
+ * @brief hdc2080 stats fixed point structure definition
+ */
+typedef struct hdc2080_stats_centi_s
+{
+    hdc2080_stats_channel_centi_t temperature;     /**< temperature channel */
+    hdc2080_stats_channel_centi_t humidity;        /**< humidity channel */
+    hdc2080_stats_summary_centi_t last;            /**< latched summary of the last full window */
+    uint64_t first_us;                             /**< time of the first sample in the window */
+    uint64_t last_us;                              /**< time of the last sample in the window */
+    uint32_t count;                                /**< samples in the window */
+    uint32_t length;                               /**< window length, 0 never closes the window */
+    uint32_t window;                               /**< closed windows */
+    uint32_t alpha_q16;                            /**< ewma weight of a new sample, q16 */
+    uint8_t seeded;                                /**< ewma seeded flag */
+    uint8_t ready;                                 /**< unread window flag */
+    uint8_t inited;                                /**< inited flag */
+} hdc2080_stats_centi_t;
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief hdc2080 stats channel structure definition
+ */
+typedef struct hdc2080_stats_channel_s
+{
+    float mean;         /**< running mean */
+    float m2;           /**< sum of the squared deviations */
+    float ewma;         /**< ewma */
+    float min;          /**< min */
+    float max;          /**< max */
+} hdc2080_stats_channel_t;
+
+/**
+ * @brief hdc2080 stats channel summary structure definition
+ */
+typedef struct hdc2080_stats_channel_summary_s
+{
+    float min;              /**< min */
+    float max;              /**< max */
+    float mean;             /**< mean */
+    float ewma;             /**< ewma */
+    float variance;         /**< sample variance */
+} hdc2080_stats_channel_summary_t;
+
+/**
+ * @brief hdc2080 stats summary structure definition
+ */
+typedef struct hdc2080_stats_summary_s
+{
+    uint32_t count;                                  /**< sample number */
+    uint32_t window;                                 /**< window sequence number */
+    uint64_t first_us;                               /**< time of the first sample */
+    uint64_t last_us;                                /**< time of the last sample */
+    hdc2080_stats_channel_summary_t temperature;     /**< temperature in degrees */
+    hdc2080_stats_channel_summary_t humidity;        /**< humidity in percent */
+} hdc2080_stats_summary_t;
+
+/**
+ * @brief hdc2080 stats structure definition
+ */
+typedef struct hdc2080_stats_s
+{
+    hdc2080_stats_channel_t temperature;     /**< temperature channel */
+    hdc2080_stats_channel_t humidity;        /**< humidity channel */
+    hdc2080_stats_summary_t last;            /**< latched summary of the last full window */
+    uint64_t first_us;                       /**< time of the first sample in the window */
+    uint64_t last_us;                        /**< time of the last sample in the window */
+    uint32_t count;                          /**< samples in the window */
+    uint32_t length;                         /**< window length, 0 never closes the window */
+    uint32_t window;                         /**< closed windows */
+    float alpha;                             /**< ewma weight of a new sample */
+    uint8_t seeded;                          /**< ewma seeded flag */
+    uint8_t ready;                           /**< unread window flag */
+    uint8_t inited;                          /**< inited flag */
+} hdc2080_stats_t;
+#endif
+
+/**
+ * @brief     init the fixed point stats
+ * @param[in] *stats pointer to an hdc2080 stats centi structure
+ * @param[in] length window length, 0 keeps one window forever
+ * @param[in] alpha_q16 ewma weight of a new sample in q16, 1 - 65536
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 4 param is invalid
+ * @note      the update costs O(1) in 64 bit integers without division by the sample data,
+ *            a window holds at least 2^20 full scale samples before the squared sum saturates
+ */
+uint8_t hdc2080_stats_init_centi(hdc2080_stats_centi_t *stats, uint32_t length, uint32_t alpha_q16);
+
+/**
+ * @brief     reset the fixed point stats
+ * @param[in] *stats pointer to an hdc2080 stats centi structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ * @note      the window, the ewma and the latched summary are cleared
+ */
+uint8_t hdc2080_stats_reset_centi(hdc2080_stats_centi_t *stats);
+
+/**
+ * @brief     update the fixed point stats with a sample
+ * @param[in] *stats pointer to an hdc2080 stats centi structure
+ * @param[in] timestamp_us time of the sample
+ * @param[in] temperature_centi temperature in 0.01 degrees
+ * @param[in] humidity_centi humidity in 0.01 percent
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ * @note      the min, max, mean and variance are updated with Welford's method,
+ *            a full window is latched for hdc2080_stats_get_window_centi and a new window is started,
+ *            the ewma runs across the windows, the inputs are clamped to -40.50C - 125.00C and 0% - 100%
+ */
+uint8_t hdc2080_stats_update_centi(hdc2080_stats_centi_t *stats, uint64_t timestamp_us,
+                                   int16_t temperature_centi, uint16_t humidity_centi);
+
+/**
+ * @brief      get the summary of the running window
+ * @param[in]  *stats pointer to an hdc2080 stats centi structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or summary is NULL
+ *             - 3 stats is not initialized
+ *             - 4 window is empty
+ * @note       the variance of a single sample is 0
+ */
+uint8_t hdc2080_stats_get_summary_centi(hdc2080_stats_centi_t *stats, hdc2080_stats_summary_centi_t *summary);
+
+/**
+ * @brief      get the summary of the last full window
+ * @param[in]  *stats pointer to an hdc2080 stats centi structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or summary is NULL
+ *             - 3 stats is not initialized
+ *             - 4 no new window
+ * @note       every full window is returned once, a window closed before the last one was read
+ *             is overwritten and shows up as a gap in the window sequence number
+ */
+uint8_t hdc2080_stats_get_window_centi(hdc2080_stats_centi_t *stats, hdc2080_stats_summary_centi_t *summary);
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief     init the stats
+ * @param[in] *stats pointer to an hdc2080 stats structure
+ * @param[in] length window length, 0 keeps one window forever
+ * @param[in] alpha ewma weight of a new sample, (0, 1]
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 4 param is invalid
+ * @note      none
+ */
+uint8_t hdc2080_stats_init(hdc2080_stats_t *stats, uint32_t length, float alpha);
+
+/**
+ * @brief     reset the stats
+ * @param[in] *stats pointer to an hdc2080 stats structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ * @note      the window, the ewma and the latched summary are cleared
+ */
+uint8_t hdc2080_stats_reset(hdc2080_stats_t *stats);
+
+/**
+ * @brief     update the stats with a sample
+ * @param[in] *stats pointer to an hdc2080 stats structure
+ * @param[in] timestamp_us time of the sample
+ * @param[in] temperature temperature in degrees
+ * @param[in] humidity humidity in percent
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ * @note      the min, max, mean and variance are updated with Welford's method,
+ *            a full window is latched for hdc2080_stats_get_window and a new window is started,
+ *            the ewma runs across the windows
+ */
+uint8_t hdc2080_stats_update(hdc2080_stats_t *stats, uint64_t timestamp_us, float temperature, float humidity);
+
+/**
+ * @brief      get the summary of the running window
+ * @param[in]  *stats pointer to an hdc2080 stats structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or summary is NULL
+ *             - 3 stats is not initialized
+ *             - 4 window is empty
+ * @note       the variance of a single sample is 0
+ */
+uint8_t hdc2080_stats_get_summary(hdc2080_stats_t *stats, hdc2080_stats_summary_t *summary);
+
+/**
+ * @brief      get the summary of the last full window
+ * @param[in]  *stats pointer to an hdc2080 stats structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or summary is NULL
+ *             - 3 stats is not initialized
+ *             - 4 no new window
+ * @note       every full window is returned once
+ */
+uint8_t hdc2080_stats_get_window(hdc2080_stats_t *stats, hdc2080_stats_summary_t *summary);
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
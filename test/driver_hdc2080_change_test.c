@@ -0,0 +1,266 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_change_test.c
+ * @brief     driver hdc2080 change test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_change_test.h"
+#include "driver_hdc2080_change.h"
+
+static hdc2080_handle_t gs_handle;        /**< hdc2080 handle */
+static hdc2080_change_t gs_change;        /**< hdc2080 change */
+
+/**
+ * @brief     check the chip stays quiet
+ * @param[in] ms wait time
+ * @return    1 if no threshold flag is set, else 0
+ * @note      none
+ */
+static uint8_t a_hdc2080_change_test_quiet(uint32_t ms)
+{
+    uint8_t status;
+    
+    hdc2080_interface_delay_ms(ms);
+    if (hdc2080_get_interrupt_status(&gs_handle, &status) != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get interrupt status failed.\n");
+        
+        return 0;
+    }
+    
+    return ((status & HDC2080_CHANGE_INTERRUPT_MASK) == 0) ? 1 : 0;
+}
+
+/**
+ * @brief     change test
+ * @param[in] addr_pin address pin
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the thresholds are armed around a stale value to make the chip report a change
+ */
+uint8_t hdc2080_change_test(hdc2080_address_t addr_pin, uint32_t times)
+{
+    uint8_t res;
+    uint8_t ok;
+    uint8_t status;
+    uint8_t expect;
+    uint8_t reg;
+    uint32_t i;
+    uint32_t writes;
+    int16_t temperature_centi;
+    uint16_t humidity_centi;
+    hdc2080_info_t info;
+    
+    /* link interface function */
+    DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
+    DRIVER_HDC2080_LINK_IIC_INIT(&gs_handle, hdc2080_interface_iic_init);
+    DRIVER_HDC2080_LINK_IIC_DEINIT(&gs_handle, hdc2080_interface_iic_deinit);
+    DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
+    DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
+    DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
+    
+    /* get information */
+    res = hdc2080_info(&info);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        hdc2080_interface_debug_print("hdc2080: chip is %s.\n", info.chip_name);
+        hdc2080_interface_debug_print("hdc2080: manufacturer is %s.\n", info.manufacturer_name);
+        hdc2080_interface_debug_print("hdc2080: interface is %s.\n", info.interface);
+        hdc2080_interface_debug_print("hdc2080: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        hdc2080_interface_debug_print("hdc2080: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        hdc2080_interface_debug_print("hdc2080: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        hdc2080_interface_debug_print("hdc2080: max current is %0.2fmA.\n", info.max_current_ma);
+        hdc2080_interface_debug_print("hdc2080: max temperature is %0.1fC.\n", info.temperature_max);
+        hdc2080_interface_debug_print("hdc2080: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start change test */
+    hdc2080_interface_debug_print("hdc2080: start change test.\n");
+    
+    /* set addr pin */
+    res = hdc2080_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set addr pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* init */
+    res = hdc2080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set humidity and temperature */
+    res = hdc2080_set_mode(&gs_handle, HDC2080_MODE_HUMIDITY_TEMPERATURE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set mode failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* a zero deadband is rejected */
+    res = hdc2080_change_init(&gs_change, &gs_handle, 0, 200);
+    hdc2080_interface_debug_print("hdc2080: check change deadband %s.\n", (res == 4) ? "ok" : "error");
+    res = hdc2080_change_init(&gs_change, &gs_handle, 100, 200);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: change init failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* the chip measures on its own */
+    res = hdc2080_set_auto_measurement_mode(&gs_handle, HDC2080_AUTO_MEASUREMENT_MODE_5_HZ);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set auto measurement mode failed.\n");
+        (void)hdc2080_change_deinit(&gs_change);
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_set_measurement(&gs_handle, HDC2080_BOOL_TRUE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set measurement failed.\n");
+        (void)hdc2080_change_deinit(&gs_change);
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_delay_ms(500);
+    
+    /* arm around the first reading */
+    res = hdc2080_change_service_centi(&gs_change, &status, &temperature_centi, &humidity_centi);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: change service failed.\n");
+        (void)hdc2080_change_deinit(&gs_change);
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: armed around %0.2fC and %0.2f%%.\n",
+                                  (float)temperature_centi / 100.0f, (float)humidity_centi / 100.0f);
+    ok = 1;
+    (void)hdc2080_get_temperature_low_threshold(&gs_handle, &reg);
+    ok &= (reg == (uint8_t)(((int32_t)temperature_centi - 100 + 4050) * 256 / 16500)) ? 1 : 0;
+    (void)hdc2080_get_temperature_high_threshold(&gs_handle, &reg);
+    ok &= (reg == (uint8_t)(((int32_t)temperature_centi + 100 + 4050) * 256 / 16500)) ? 1 : 0;
+    (void)hdc2080_get_humidity_low_threshold(&gs_handle, &reg);
+    ok &= (reg == (uint8_t)(((int32_t)humidity_centi - 200) * 256 / 10000)) ? 1 : 0;
+    (void)hdc2080_get_humidity_high_threshold(&gs_handle, &reg);
+    ok &= (reg == (uint8_t)(((int32_t)humidity_centi + 200) * 256 / 10000)) ? 1 : 0;
+    hdc2080_interface_debug_print("hdc2080: check change window %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* a steady value never wakes the host */
+    ok = a_hdc2080_change_test_quiet(2000);
+    hdc2080_interface_debug_print("hdc2080: check change quiet %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* arm around a stale value so the current one looks like a move */
+    ok = 1;
+    for (i = 0; i < times; i++)
+    {
+        if ((i % 2) == 0)
+        {
+            res = hdc2080_change_rearm_centi(&gs_change, temperature_centi - 500, humidity_centi);
+            expect = 1 << HDC2080_INTERRUPT_TEMPERATURE_HIGH_THRESHOLD;
+        }
+        else
+        {
+            res = hdc2080_change_rearm_centi(&gs_change, temperature_centi, humidity_centi + 1000);
+            expect = 1 << HDC2080_INTERRUPT_HUMIDITY_LOW_THRESHOLD;
+        }
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: change rearm failed.\n");
+            (void)hdc2080_change_deinit(&gs_change);
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        hdc2080_interface_delay_ms(500);
+        res = hdc2080_change_service_centi(&gs_change, &status, &temperature_centi, &humidity_centi);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: change service failed.\n");
+            (void)hdc2080_change_deinit(&gs_change);
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        hdc2080_interface_debug_print("hdc2080: %d/%d status is 0x%02X.\n", (uint32_t)(i + 1), (uint32_t)times, status);
+        
+        /* the re-armed window is quiet again */
+        if ((status != expect) || (a_hdc2080_change_test_quiet(1000) == 0))
+        {
+            ok = 0;
+        }
+    }
+    hdc2080_interface_debug_print("hdc2080: check change report %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* the float window matches the fixed point one, so nothing is written */
+    writes = gs_change.writes;
+#if (HDC2080_USE_FLOAT == 1)
+    res = hdc2080_change_rearm(&gs_change, (float)temperature_centi / 100.0f, (float)humidity_centi / 100.0f);
+    hdc2080_interface_debug_print("hdc2080: check change float %s.\n", ((res == 0) && (gs_change.writes == writes)) ? "ok" : "error");
+#endif
+    hdc2080_interface_debug_print("hdc2080: %d re-arms with %d threshold writes.\n", gs_change.rearms, writes);
+    
+    /* finish change test */
+    (void)hdc2080_set_auto_measurement_mode(&gs_handle, HDC2080_AUTO_MEASUREMENT_MODE_DISABLED);
+    (void)hdc2080_change_deinit(&gs_change);
+    hdc2080_interface_debug_print("hdc2080: finish change test.\n");
+    (void)hdc2080_deinit(&gs_handle);
+    
+    return 0;
+}
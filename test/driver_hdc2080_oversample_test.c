@@ -0,0 +1,318 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_oversample_test.c
+ * @brief     driver hdc2080 oversample test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_oversample_test.h"
+#include "driver_hdc2080_oversample.h"
+
+#define OVERSAMPLE_TEST_NOISE_SHOTS        64        /**< shots of the noise check */
+#define OVERSAMPLE_TEST_SIGMA              20        /**< synthetic noise in 0.01 units */
+
+static hdc2080_handle_t gs_handle;                                      /**< hdc2080 handle */
+static int16_t gs_t[HDC2080_OVERSAMPLE_MAX_SHOTS];                      /**< synthetic temperature shots */
+static uint16_t gs_h[HDC2080_OVERSAMPLE_MAX_SHOTS];                     /**< synthetic humidity shots */
+
+/**
+ * @brief         get a gaussian noise sample
+ * @param[in,out] *seed pointer to a lcg state
+ * @param[in]     sigma standard deviation
+ * @return        noise sample
+ * @note          the sum of 12 uniform samples
+ */
+static int32_t a_hdc2080_oversample_test_noise(uint32_t *seed, int32_t sigma)
+{
+    uint32_t i;
+    int32_t sum;
+    
+    sum = 0;
+    for (i = 0; i < 12; i++)
+    {
+        *seed = *seed * 1664525U + 1013904223U;
+        sum += (int32_t)(*seed >> 16);
+    }
+    
+    return (int32_t)(((int64_t)(sum - 6 * 65536) * sigma) / 65536);
+}
+
+/**
+ * @brief     check a synthetic noise estimate
+ * @param[in] *name pointer to a filter name
+ * @param[in] *channel pointer to a decimated channel
+ * @param[in] gain effective noise gain over sigma / sqrt(n) in 0.001
+ * @return    1 if ok, else 0
+ * @note      the estimate must be within 35% of the synthetic sigma
+ */
+static uint8_t a_hdc2080_oversample_test_check_noise(const char *name, const hdc2080_oversample_channel_centi_t *channel,
+                                                     uint32_t gain)
+{
+    uint32_t sigma;
+    uint32_t expect;
+    uint8_t ok;
+    
+    sigma = OVERSAMPLE_TEST_SIGMA * 10;
+    expect = channel->sigma_milli * gain / 8000;
+    ok = ((channel->sigma_milli * 100 >= sigma * 65) && (channel->sigma_milli * 100 <= sigma * 135) &&
+          (channel->noise_milli + 1 >= expect) && (channel->noise_milli <= expect + 1)) ? 1 : 0;
+    hdc2080_interface_debug_print("hdc2080: %s shot noise %d.%03d, effective noise %d.%03d, synthetic %d.%03d.\n", name,
+                                  channel->sigma_milli / 1000, channel->sigma_milli % 1000,
+                                  channel->noise_milli / 1000, channel->noise_milli % 1000,
+                                  sigma / 1000, sigma % 1000);
+    
+    return ok;
+}
+
+/**
+ * @brief     oversample test
+ * @param[in] addr_pin address pin
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the filters are checked on synthetic shots with outliers and noise,
+ *            then every resolution is oversampled on the sensor
+ */
+uint8_t hdc2080_oversample_test(hdc2080_address_t addr_pin, uint32_t times)
+{
+    const int16_t spike[9] = {2500, 2501, 2499, 2500, 3000, 2500, 2498, 2200, 2500};
+    const hdc2080_resolution_t resolution[3] = {HDC2080_RESOLUTION_14_BIT, HDC2080_RESOLUTION_11_BIT, HDC2080_RESOLUTION_9_BIT};
+    const uint8_t bits[3] = {14, 11, 9};
+    const uint32_t shots[3] = {1, 4, 16};
+    uint8_t res;
+    uint8_t ok;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t seed;
+    int32_t t_ref;
+    int32_t h_ref;
+    int32_t diff;
+    uint32_t last_us;
+    hdc2080_resolution_t t_res;
+    hdc2080_resolution_t h_res;
+    hdc2080_oversample_centi_t mean;
+    hdc2080_oversample_centi_t median;
+    hdc2080_info_t info;
+    
+    /* link interface function */
+    DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
+    DRIVER_HDC2080_LINK_IIC_INIT(&gs_handle, hdc2080_interface_iic_init);
+    DRIVER_HDC2080_LINK_IIC_DEINIT(&gs_handle, hdc2080_interface_iic_deinit);
+    DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
+    DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
+    DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
+    
+    /* get information */
+    res = hdc2080_info(&info);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        hdc2080_interface_debug_print("hdc2080: chip is %s.\n", info.chip_name);
+        hdc2080_interface_debug_print("hdc2080: manufacturer is %s.\n", info.manufacturer_name);
+        hdc2080_interface_debug_print("hdc2080: interface is %s.\n", info.interface);
+        hdc2080_interface_debug_print("hdc2080: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        hdc2080_interface_debug_print("hdc2080: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        hdc2080_interface_debug_print("hdc2080: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        hdc2080_interface_debug_print("hdc2080: max current is %0.2fmA.\n", info.max_current_ma);
+        hdc2080_interface_debug_print("hdc2080: max temperature is %0.1fC.\n", info.temperature_max);
+        hdc2080_interface_debug_print("hdc2080: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start oversample test */
+    hdc2080_interface_debug_print("hdc2080: start oversample test.\n");
+    
+    /* invalid params are rejected */
+    res = hdc2080_oversample_decimate_centi(gs_t, gs_h, 0, HDC2080_RESOLUTION_14_BIT, HDC2080_OVERSAMPLE_FILTER_MEAN, &mean);
+    ok = (res == 4) ? 1 : 0;
+    res = hdc2080_oversample_decimate_centi(gs_t, gs_h, HDC2080_OVERSAMPLE_MAX_SHOTS + 1, HDC2080_RESOLUTION_14_BIT,
+                                            HDC2080_OVERSAMPLE_FILTER_MEAN, &mean);
+    ok = ((res == 4) && (ok != 0)) ? 1 : 0;
+    res = hdc2080_oversample_decimate_centi(NULL, gs_h, 1, HDC2080_RESOLUTION_14_BIT, HDC2080_OVERSAMPLE_FILTER_MEAN, &mean);
+    ok = ((res == 1) && (ok != 0)) ? 1 : 0;
+    hdc2080_interface_debug_print("hdc2080: check oversample param %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* two spikes move the mean and are rejected by the median */
+    hdc2080_interface_debug_print("hdc2080: oversample outlier test.\n");
+    for (i = 0; i < 9; i++)
+    {
+        gs_t[i] = spike[i];
+        gs_h[i] = (uint16_t)(spike[i] + 2500);
+    }
+    (void)hdc2080_oversample_decimate_centi(gs_t, gs_h, 9, HDC2080_RESOLUTION_14_BIT, HDC2080_OVERSAMPLE_FILTER_MEAN, &mean);
+    (void)hdc2080_oversample_decimate_centi(gs_t, gs_h, 9, HDC2080_RESOLUTION_14_BIT, HDC2080_OVERSAMPLE_FILTER_MEDIAN, &median);
+    hdc2080_interface_debug_print("hdc2080: mean is %d, median is %d, outliers are %d.\n",
+                                  mean.temperature.value, median.temperature.value, median.temperature.outliers);
+    ok = ((mean.temperature.value == 2522) && (mean.humidity.value == 5022) &&
+          (median.temperature.value == 2500) && (median.humidity.value == 5000) &&
+          (median.temperature.outliers == 2) && (median.humidity.outliers == 2) &&
+          (median.temperature.min == 2200) && (median.temperature.max == 3000) &&
+          (median.temperature.sigma_milli < mean.temperature.sigma_milli)) ? 1 : 0;
+    hdc2080_interface_debug_print("hdc2080: check oversample outlier %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* gaussian shots check the noise report */
+    hdc2080_interface_debug_print("hdc2080: oversample noise test.\n");
+    seed = 1;
+    for (i = 0; i < OVERSAMPLE_TEST_NOISE_SHOTS; i++)
+    {
+        gs_t[i] = (int16_t)(2500 + a_hdc2080_oversample_test_noise(&seed, OVERSAMPLE_TEST_SIGMA));
+        gs_h[i] = (uint16_t)(5000 + a_hdc2080_oversample_test_noise(&seed, OVERSAMPLE_TEST_SIGMA));
+    }
+    (void)hdc2080_oversample_decimate_centi(gs_t, gs_h, OVERSAMPLE_TEST_NOISE_SHOTS, HDC2080_RESOLUTION_14_BIT,
+                                            HDC2080_OVERSAMPLE_FILTER_MEAN, &mean);
+    (void)hdc2080_oversample_decimate_centi(gs_t, gs_h, OVERSAMPLE_TEST_NOISE_SHOTS, HDC2080_RESOLUTION_14_BIT,
+                                            HDC2080_OVERSAMPLE_FILTER_MEDIAN, &median);
+    ok = a_hdc2080_oversample_test_check_noise("mean", &mean.temperature, 1000);
+    ok &= a_hdc2080_oversample_test_check_noise("median", &median.temperature, 1253);
+    ok &= a_hdc2080_oversample_test_check_noise("mean", &mean.humidity, 1000);
+    ok &= a_hdc2080_oversample_test_check_noise("median", &median.humidity, 1253);
+    hdc2080_interface_debug_print("hdc2080: check oversample noise %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* set addr pin */
+    res = hdc2080_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set addr pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* init */
+    res = hdc2080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set humidity and temperature */
+    res = hdc2080_set_mode(&gs_handle, HDC2080_MODE_HUMIDITY_TEMPERATURE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set mode failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* 14 bit reference */
+    res = hdc2080_set_temperature_resolution(&gs_handle, HDC2080_RESOLUTION_14_BIT);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set temperature resolution failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_set_humidity_resolution(&gs_handle, HDC2080_RESOLUTION_14_BIT);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set humidity resolution failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_oversample_read_centi(&gs_handle, HDC2080_RESOLUTION_14_BIT, 1, HDC2080_OVERSAMPLE_FILTER_MEAN, &mean);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: oversample read failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    t_ref = mean.temperature.value;
+    h_ref = mean.humidity.value;
+    
+    /* trade the conversion time against the noise */
+    for (k = 0; k < times; k++)
+    {
+        hdc2080_interface_debug_print("hdc2080: oversample sensor test %d.\n", k + 1);
+        for (i = 0; i < 3; i++)
+        {
+            last_us = 0;
+            for (j = 0; j < 3; j++)
+            {
+                res = hdc2080_oversample_read_centi(&gs_handle, resolution[i], shots[j], HDC2080_OVERSAMPLE_FILTER_MEAN, &mean);
+                if (res == 0)
+                {
+                    res = hdc2080_oversample_read_centi(&gs_handle, resolution[i], shots[j], HDC2080_OVERSAMPLE_FILTER_MEDIAN, &median);
+                }
+                if (res != 0)
+                {
+                    hdc2080_interface_debug_print("hdc2080: oversample read failed.\n");
+                    (void)hdc2080_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+                hdc2080_interface_debug_print("hdc2080: %d bit x %d in %dus, temperature %0.2fC noise %0.3fC, humidity %0.2f%% noise %0.3f%%.\n",
+                                              bits[i], shots[j], mean.conversion_us,
+                                              (float)mean.temperature.value / 100.0f, (float)mean.temperature.noise_milli / 1000.0f,
+                                              (float)mean.humidity.value / 100.0f, (float)mean.humidity.noise_milli / 1000.0f);
+                
+                /* the decimated values stay within one code of the 14 bit reading */
+                diff = mean.temperature.value - t_ref;
+                ok = ((diff <= (int32_t)(16500 >> bits[i]) + 1) && (diff >= -(int32_t)(16500 >> bits[i]) - 1)) ? 1 : 0;
+                diff = median.humidity.value - h_ref;
+                ok &= ((diff <= (int32_t)(10000 >> bits[i]) + 1) && (diff >= -(int32_t)(10000 >> bits[i]) - 1)) ? 1 : 0;
+                ok &= ((mean.conversion_us > last_us) && (mean.shots == shots[j]) &&
+                       (median.conversion_us == mean.conversion_us)) ? 1 : 0;
+                if (ok == 0)
+                {
+                    hdc2080_interface_debug_print("hdc2080: check oversample %d bit x %d error.\n", bits[i], shots[j]);
+                }
+                last_us = mean.conversion_us;
+            }
+        }
+    }
+    
+    /* the resolutions are restored */
+    res = hdc2080_get_temperature_resolution(&gs_handle, &t_res);
+    res |= hdc2080_get_humidity_resolution(&gs_handle, &h_res);
+    hdc2080_interface_debug_print("hdc2080: check oversample restore %s.\n",
+                                  ((res == 0) && (t_res == HDC2080_RESOLUTION_14_BIT) && (h_res == HDC2080_RESOLUTION_14_BIT)) ? "ok" : "error");
+    
+    /* finish oversample test */
+    hdc2080_interface_debug_print("hdc2080: finish oversample test.\n");
+    (void)hdc2080_deinit(&gs_handle);
+    
+    return 0;
+}
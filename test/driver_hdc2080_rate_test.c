@@ -0,0 +1,272 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_rate_test.c
+ * @brief     driver hdc2080 rate test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_rate_test.h"
+#include "driver_hdc2080_rate.h"
+
+#define RATE_TEST_T_STEP         10            /**< 0.1C per sample */
+#define RATE_TEST_RH_STEP        50            /**< 0.5% per sample */
+#define RATE_TEST_HOLD_MS        60000         /**< 1 minute calm */
+
+static hdc2080_handle_t gs_handle;            /**< hdc2080 handle */
+static hdc2080_rate_t gs_rate;                /**< hdc2080 rate controller */
+static uint32_t gs_now_ms;                    /**< virtual time */
+static int32_t gs_t_milli;                    /**< temperature in 0.001 degrees */
+static int32_t gs_h_milli;                    /**< humidity in 0.001 percent */
+
+/**
+ * @brief      feed a profile to the controller
+ * @param[in]  duration_ms profile length
+ * @param[in]  t_slope temperature slope in 0.001 degrees per second
+ * @param[in]  h_slope humidity slope in 0.001 percent per second
+ * @param[out] *mode pointer to a mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ * @note       the samples come at the period of the current mode with one code of alternating noise
+ */
+static uint8_t a_hdc2080_rate_test_run(uint32_t duration_ms, int32_t t_slope, int32_t h_slope,
+                                       hdc2080_auto_measurement_mode_t *mode)
+{
+    uint32_t start_ms;
+    uint32_t period_ms;
+    int32_t noise;
+    
+    start_ms = gs_now_ms;
+    while (gs_now_ms - start_ms < duration_ms)
+    {
+        if (hdc2080_rate_get_period(*mode, &period_ms) != 0)
+        {
+            return 1;
+        }
+        gs_now_ms += period_ms;
+        gs_t_milli += (int32_t)((int64_t)t_slope * period_ms / 1000);
+        gs_h_milli += (int32_t)((int64_t)h_slope * period_ms / 1000);
+        noise = ((gs_now_ms / period_ms) & 1) != 0 ? 1 : -1;
+        if (hdc2080_rate_update(&gs_rate, gs_now_ms, (int16_t)(gs_t_milli / 10 + noise),
+                                (uint16_t)(gs_h_milli / 10 + noise), mode) != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: rate update failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     check the chip follows the controller
+ * @param[in] mode expected mode
+ * @return    1 if ok, else 0
+ * @note      none
+ */
+static uint8_t a_hdc2080_rate_test_chip(hdc2080_auto_measurement_mode_t mode)
+{
+    hdc2080_auto_measurement_mode_t chip;
+    
+    if (hdc2080_get_auto_measurement_mode(&gs_handle, &chip) != 0)
+    {
+        return 0;
+    }
+    
+    return (chip == mode) ? 1 : 0;
+}
+
+/**
+ * @brief     rate test
+ * @param[in] addr_pin address pin
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      calm, transient and edge profiles are fed on a virtual clock and the chip mode is read back
+ */
+uint8_t hdc2080_rate_test(hdc2080_address_t addr_pin, uint32_t times)
+{
+    uint8_t res;
+    uint8_t ok;
+    uint32_t i;
+    uint32_t ups;
+    uint32_t downs;
+    uint32_t period_ms;
+    hdc2080_auto_measurement_mode_t mode;
+    hdc2080_info_t info;
+    
+    /* link interface function */
+    DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
+    DRIVER_HDC2080_LINK_IIC_INIT(&gs_handle, hdc2080_interface_iic_init);
+    DRIVER_HDC2080_LINK_IIC_DEINIT(&gs_handle, hdc2080_interface_iic_deinit);
+    DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
+    DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
+    DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
+    
+    /* get information */
+    res = hdc2080_info(&info);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        hdc2080_interface_debug_print("hdc2080: chip is %s.\n", info.chip_name);
+        hdc2080_interface_debug_print("hdc2080: manufacturer is %s.\n", info.manufacturer_name);
+        hdc2080_interface_debug_print("hdc2080: interface is %s.\n", info.interface);
+        hdc2080_interface_debug_print("hdc2080: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        hdc2080_interface_debug_print("hdc2080: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        hdc2080_interface_debug_print("hdc2080: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        hdc2080_interface_debug_print("hdc2080: max current is %0.2fmA.\n", info.max_current_ma);
+        hdc2080_interface_debug_print("hdc2080: max temperature is %0.1fC.\n", info.temperature_max);
+        hdc2080_interface_debug_print("hdc2080: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start rate test */
+    hdc2080_interface_debug_print("hdc2080: start rate test.\n");
+    
+    /* set addr pin */
+    res = hdc2080_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set addr pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* init */
+    res = hdc2080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* invalid params are rejected */
+    res = hdc2080_rate_init(&gs_rate, &gs_handle, HDC2080_AUTO_MEASUREMENT_MODE_5_HZ, HDC2080_AUTO_MEASUREMENT_MODE_1_HZ,
+                            RATE_TEST_T_STEP, RATE_TEST_RH_STEP, RATE_TEST_HOLD_MS);
+    ok = (res == 4) ? 1 : 0;
+    res = hdc2080_rate_init(&gs_rate, &gs_handle, HDC2080_AUTO_MEASUREMENT_MODE_DISABLED, HDC2080_AUTO_MEASUREMENT_MODE_5_HZ,
+                            RATE_TEST_T_STEP, RATE_TEST_RH_STEP, RATE_TEST_HOLD_MS);
+    ok = ((res == 4) && (ok != 0)) ? 1 : 0;
+    hdc2080_interface_debug_print("hdc2080: check rate param %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* start at the fastest rate */
+    res = hdc2080_rate_init(&gs_rate, &gs_handle, HDC2080_AUTO_MEASUREMENT_MODE_1_DIV_120_HZ, HDC2080_AUTO_MEASUREMENT_MODE_5_HZ,
+                            RATE_TEST_T_STEP, RATE_TEST_RH_STEP, RATE_TEST_HOLD_MS);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: rate init failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mode = HDC2080_AUTO_MEASUREMENT_MODE_5_HZ;
+    gs_now_ms = 0xFFFF0000U;
+    gs_t_milli = 25000;
+    gs_h_milli = 50000;
+    
+    for (i = 0; i < times; i++)
+    {
+        /* calm hours step down to the slowest rate */
+        hdc2080_interface_debug_print("hdc2080: rate calm test %d.\n", i + 1);
+        ups = gs_rate.ups;
+        downs = gs_rate.downs;
+        if (a_hdc2080_rate_test_run(2 * 3600 * 1000, 0, 0, &mode) != 0)
+        {
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        (void)hdc2080_rate_get_period(mode, &period_ms);
+        hdc2080_interface_debug_print("hdc2080: mode is %d, period is %dms, ups are %d, downs are %d.\n",
+                                      mode, period_ms, gs_rate.ups - ups, gs_rate.downs - downs);
+        ok = ((mode == HDC2080_AUTO_MEASUREMENT_MODE_1_DIV_120_HZ) && (gs_rate.ups == ups) &&
+              (a_hdc2080_rate_test_chip(mode) != 0)) ? 1 : 0;
+        hdc2080_interface_debug_print("hdc2080: check rate calm %s.\n", (ok != 0) ? "ok" : "error");
+        
+        /* a 0.08C/s transient needs 1hz at once */
+        hdc2080_interface_debug_print("hdc2080: rate transient test %d.\n", i + 1);
+        ups = gs_rate.ups;
+        downs = gs_rate.downs;
+        if (a_hdc2080_rate_test_run(1, 80, 0, &mode) != 0)
+        {
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ok = ((mode == HDC2080_AUTO_MEASUREMENT_MODE_1_HZ) && (gs_rate.ups == ups + 1) &&
+              (a_hdc2080_rate_test_chip(mode) != 0)) ? 1 : 0;
+        hdc2080_interface_debug_print("hdc2080: mode is %d after one sample.\n", mode);
+        hdc2080_interface_debug_print("hdc2080: check rate transient %s.\n", (ok != 0) ? "ok" : "error");
+        
+        /* a ramp just within one step per sample never toggles the rate */
+        hdc2080_interface_debug_print("hdc2080: rate edge test %d.\n", i + 1);
+        ups = gs_rate.ups;
+        downs = gs_rate.downs;
+        if (a_hdc2080_rate_test_run(600 * 1000, 80, 0, &mode) != 0)
+        {
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ok = ((mode == HDC2080_AUTO_MEASUREMENT_MODE_1_HZ) && (gs_rate.ups == ups) && (gs_rate.downs == downs)) ? 1 : 0;
+        hdc2080_interface_debug_print("hdc2080: check rate edge %s.\n", (ok != 0) ? "ok" : "error");
+        
+        /* a fast humidity step raises the rate to the max */
+        hdc2080_interface_debug_print("hdc2080: rate step test %d.\n", i + 1);
+        if (a_hdc2080_rate_test_run(1, 0, 20000, &mode) != 0)
+        {
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ok = ((mode == HDC2080_AUTO_MEASUREMENT_MODE_5_HZ) && (a_hdc2080_rate_test_chip(mode) != 0)) ? 1 : 0;
+        gs_h_milli = 50000;
+        hdc2080_interface_debug_print("hdc2080: check rate step %s.\n", (ok != 0) ? "ok" : "error");
+    }
+    
+    /* finish rate test */
+    (void)hdc2080_rate_deinit(&gs_rate);
+    hdc2080_interface_debug_print("hdc2080: finish rate test.\n");
+    (void)hdc2080_deinit(&gs_handle);
+    
+    return 0;
+}
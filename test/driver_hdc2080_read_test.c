@@ -35,6 +35,8 @@
  */
 
 #include "driver_hdc2080_read_test.h"
+#include "driver_hdc2080_batch.h"
+#include <stdlib.h>
 
 static hdc2080_handle_t gs_handle;        /**< hdc2080 handle */
 
@@ -57,6 +59,14 @@ uint8_t hdc2080_read_test(hdc2080_address_t addr_pin, uint32_t times)
     float percent;
     float deg;
     hdc2080_info_t info;
+    uint16_t batch_temperature_raw[8];
+    float batch_temperature_s[8];
+    float batch_temperature[8];
+    int16_t batch_temperature_centi[8];
+    uint16_t batch_humidity_raw[8];
+    float batch_humidity_s[8];
+    float batch_humidity[8];
+    uint16_t batch_humidity_centi[8];
    
     /* link interface function */
     DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
@@ -65,6 +75,7 @@ uint8_t hdc2080_read_test(hdc2080_address_t addr_pin, uint32_t times)
     DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
     DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
     DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
     DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
 
     /* get hdc2080 information */
@@ -816,6 +827,197 @@ uint8_t hdc2080_read_test(hdc2080_address_t addr_pin, uint32_t times)
         hdc2080_interface_delay_ms(1000);
     }
     
+    /* disable auto measurement mode */
+    res = hdc2080_set_auto_measurement_mode(&gs_handle, HDC2080_AUTO_MEASUREMENT_MODE_DISABLED);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set auto measurement mode failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    hdc2080_interface_debug_print("hdc2080: non-blocking read test.\n");
+    
+    /* loop */
+    for (i = 0; i < times; i++)
+    {
+        uint16_t temperature_raw;
+        float temperature_s;
+        uint16_t humidity_raw;
+        float humidity_s;
+        uint32_t polls;
+        
+        /* trigger measurement */
+        res = hdc2080_trigger_measurement(&gs_handle);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: trigger measurement failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* try fetch until ready */
+        polls = 0;
+        while (1)
+        {
+            res = hdc2080_try_fetch(&gs_handle, &temperature_raw, &temperature_s, &humidity_raw, &humidity_s);
+            if (res == 0)
+            {
+                break;
+            }
+            if ((res != 4) || (polls >= 1000))
+            {
+                hdc2080_interface_debug_print("hdc2080: try fetch failed.\n");
+                (void)hdc2080_deinit(&gs_handle);
+                
+                return 1;
+            }
+            polls++;
+            hdc2080_interface_delay_ms(1);
+        }
+        
+        /* output */
+        hdc2080_interface_debug_print("hdc2080: temperature[%d] is %0.2fC.\n", i, temperature_s);
+        hdc2080_interface_debug_print("hdc2080: humidity[%d] is %0.2f%%.\n", i, humidity_s);
+        hdc2080_interface_debug_print("hdc2080: not ready polls[%d] is %d.\n", i, polls);
+        
+        /* delay 1000ms */
+        hdc2080_interface_delay_ms(1000);
+    }
+    
+    /* output */
+    hdc2080_interface_debug_print("hdc2080: fixed point read test.\n");
+    
+    /* loop */
+    for (i = 0; i < times; i++)
+    {
+        uint16_t temperature_raw;
+        int16_t temperature_centi;
+        uint16_t humidity_raw;
+        uint16_t humidity_centi;
+        
+        /* read poll */
+        res = hdc2080_read_poll(&gs_handle);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: read poll failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* read temperature humidity centi */
+        res = hdc2080_read_temperature_humidity_centi(&gs_handle, &temperature_raw, &temperature_centi, &humidity_raw, &humidity_centi);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: read temperature humidity centi failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        hdc2080_interface_debug_print("hdc2080: temperature[%d] is %s%d.%02dC.\n", i, temperature_centi < 0 ? "-" : "",
+                                      abs(temperature_centi) / 100, abs(temperature_centi) % 100);
+        hdc2080_interface_debug_print("hdc2080: humidity[%d] is %d.%02d%%.\n", i, humidity_centi / 100, humidity_centi % 100);
+        
+        /* delay 1000ms */
+        hdc2080_interface_delay_ms(1000);
+    }
+    
+    /* output */
+    hdc2080_interface_debug_print("hdc2080: batch convert test.\n");
+    
+    /* read the raw samples */
+    for (i = 0; i < 8; i++)
+    {
+        /* read poll */
+        res = hdc2080_read_poll(&gs_handle);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: read poll failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* read temperature humidity */
+        res = hdc2080_read_temperature_humidity(&gs_handle, &batch_temperature_raw[i], &batch_temperature_s[i], &batch_humidity_raw[i], &batch_humidity_s[i]);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: read temperature humidity failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* convert batch */
+    res = hdc2080_convert_batch(batch_temperature_raw, batch_temperature, batch_humidity_raw, batch_humidity, 8);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: convert batch failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* convert batch centi */
+    res = hdc2080_convert_batch_centi(batch_temperature_raw, batch_temperature_centi, batch_humidity_raw, batch_humidity_centi, 8);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: convert batch centi failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* check the results */
+    for (i = 0; i < 8; i++)
+    {
+        if ((batch_temperature[i] != batch_temperature_s[i]) || (batch_humidity[i] != batch_humidity_s[i]) ||
+            (abs(batch_temperature_centi[i] - (int32_t)(batch_temperature_s[i] * 100.0f)) > 1) ||
+            (abs(batch_humidity_centi[i] - (int32_t)(batch_humidity_s[i] * 100.0f)) > 1))
+        {
+            break;
+        }
+    }
+    
+    /* output */
+    hdc2080_interface_debug_print("hdc2080: check batch convert %s.\n", i == 8 ? "ok" : "error");
+    
+    /* output */
+    hdc2080_interface_debug_print("hdc2080: snapshot read test.\n");
+    
+    /* loop */
+    for (i = 0; i < times; i++)
+    {
+        hdc2080_snapshot_t snapshot;
+        
+        /* read snapshot */
+        res = hdc2080_read_snapshot(&gs_handle, &snapshot);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: read snapshot failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        hdc2080_interface_debug_print("hdc2080: temperature[%d] is %0.2fC.\n", i, snapshot.temperature_s);
+        hdc2080_interface_debug_print("hdc2080: humidity[%d] is %0.2f%%.\n", i, snapshot.humidity_s);
+        hdc2080_interface_debug_print("hdc2080: status[%d] is 0x%02X.\n", i, snapshot.status);
+        hdc2080_interface_debug_print("hdc2080: temperature max[%d] is 0x%02X.\n", i, snapshot.temperature_max);
+        hdc2080_interface_debug_print("hdc2080: humidity max[%d] is 0x%02X.\n", i, snapshot.humidity_max);
+        
+        /* delay 1000ms */
+        hdc2080_interface_delay_ms(1000);
+    }
+    
     /* finish read test and exit */
     hdc2080_interface_debug_print("hdc2080: finish read test.\n");
     (void)hdc2080_deinit(&gs_handle);
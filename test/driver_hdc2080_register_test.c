@@ -38,6 +38,89 @@
 #include <stdlib.h>
 
 static hdc2080_handle_t gs_handle;        /**< hdc2080 handle */
+static uint32_t gs_lock_depth;            /**< lock depth */
+static uint32_t gs_lock_times;            /**< lock times */
+static uint32_t gs_unlocked_times;        /**< bus access without the lock */
+static uint32_t gs_locked_delays;         /**< delays with the lock held */
+
+/**
+ * @brief     counting lock
+ * @param[in] *ctx pointer to a user context
+ * @note      none
+ */
+static void a_hdc2080_register_test_lock(void *ctx)
+{
+    hdc2080_interface_lock(ctx);
+    gs_lock_depth++;
+    gs_lock_times++;
+}
+
+/**
+ * @brief     counting unlock
+ * @param[in] *ctx pointer to a user context
+ * @note      none
+ */
+static void a_hdc2080_register_test_unlock(void *ctx)
+{
+    gs_lock_depth--;
+    hdc2080_interface_unlock(ctx);
+}
+
+/**
+ * @brief     delay us with the lock check
+ * @param[in] us time
+ * @note      a wait must not hold the bus
+ */
+static void a_hdc2080_register_test_delay_us(uint32_t us)
+{
+    if (gs_lock_depth != 0)
+    {
+        gs_locked_delays++;
+    }
+    hdc2080_interface_delay_us(us);
+}
+
+/**
+ * @brief      iic read with the lock check
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_hdc2080_register_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if (gs_lock_depth == 0)
+    {
+        gs_unlocked_times++;
+    }
+    
+    return hdc2080_interface_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     iic write with the lock check
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_hdc2080_register_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if (gs_lock_depth == 0)
+    {
+        gs_unlocked_times++;
+    }
+    
+    return hdc2080_interface_iic_write(addr, reg, buf, len);
+}
 
 /**
  * @brief     register test
@@ -52,6 +135,7 @@ uint8_t hdc2080_register_test(hdc2080_address_t addr_pin)
     uint8_t res;
     uint8_t reg;
     uint8_t reg_check;
+    uint32_t i;
     int8_t offset;
     int8_t offset_check;
     float f;
@@ -62,8 +146,11 @@ uint8_t hdc2080_register_test(hdc2080_address_t addr_pin)
     hdc2080_auto_measurement_mode_t auto_mode;
     hdc2080_bool_t enable;
     hdc2080_info_t info;
+    hdc2080_config_t config;
+    hdc2080_config_t config_check;
     hdc2080_interrupt_polarity_t polarity;
     hdc2080_interrupt_mode_t interrupt_mode;
+    hdc2080_interface_bus_t bus;
 
     /* link interface function */
     DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
@@ -72,6 +159,7 @@ uint8_t hdc2080_register_test(hdc2080_address_t addr_pin)
     DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
     DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
     DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
     DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
     
     /* get information */
@@ -1314,6 +1402,270 @@ uint8_t hdc2080_register_test(hdc2080_address_t addr_pin)
     /* output */
     hdc2080_interface_debug_print("hdc2080: check temperature offset %0.2f.\n", f_check);
     
+    /* hdc2080_set_register_cache/hdc2080_get_register_cache test */
+    hdc2080_interface_debug_print("hdc2080: hdc2080_set_register_cache/hdc2080_get_register_cache test.\n");
+    
+    /* enable register cache */
+    res = hdc2080_set_register_cache(&gs_handle, HDC2080_BOOL_TRUE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set register cache failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: enable register cache.\n");
+    res = hdc2080_get_register_cache(&gs_handle, &enable);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get register cache failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: check register cache %s.\n", enable == HDC2080_BOOL_TRUE ? "ok" : "error");
+    
+    /* write through the cache */
+    res = hdc2080_set_heater(&gs_handle, HDC2080_BOOL_FALSE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set heater failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_set_temperature_resolution(&gs_handle, HDC2080_RESOLUTION_11_BIT);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set temperature resolution failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: set temperature resolution 11 bit.\n");
+    
+    /* read back from the cache */
+    res = hdc2080_get_temperature_resolution(&gs_handle, &resolution);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get temperature resolution failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: check cached temperature resolution %s.\n", resolution == HDC2080_RESOLUTION_11_BIT ? "ok" : "error");
+    
+    /* disable register cache and read back from the chip */
+    res = hdc2080_set_register_cache(&gs_handle, HDC2080_BOOL_FALSE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set register cache failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: disable register cache.\n");
+    res = hdc2080_get_temperature_resolution(&gs_handle, &resolution);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get temperature resolution failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: check chip temperature resolution %s.\n", resolution == HDC2080_RESOLUTION_11_BIT ? "ok" : "error");
+    
+    /* hdc2080_apply_config/hdc2080_get_config test */
+    hdc2080_interface_debug_print("hdc2080: hdc2080_apply_config/hdc2080_get_config test.\n");
+    
+    /* random config */
+    memset(&config, 0, sizeof(hdc2080_config_t));
+    memset(&config_check, 0, sizeof(hdc2080_config_t));
+    config.drdy_interrupt = (hdc2080_bool_t)(rand() % 2);
+    config.temperature_high_threshold_interrupt = (hdc2080_bool_t)(rand() % 2);
+    config.temperature_low_threshold_interrupt = (hdc2080_bool_t)(rand() % 2);
+    config.humidity_high_threshold_interrupt = (hdc2080_bool_t)(rand() % 2);
+    config.humidity_low_threshold_interrupt = (hdc2080_bool_t)(rand() % 2);
+    config.temperature_offset = (int8_t)(rand() % 256 - 128);
+    config.humidity_offset = (int8_t)(rand() % 256 - 128);
+    config.temperature_low_threshold = (uint8_t)(rand() % 256);
+    config.temperature_high_threshold = (uint8_t)(rand() % 256);
+    config.humidity_low_threshold = (uint8_t)(rand() % 256);
+    config.humidity_high_threshold = (uint8_t)(rand() % 256);
+    config.auto_measurement_mode = HDC2080_AUTO_MEASUREMENT_MODE_DISABLED;
+    config.heater = HDC2080_BOOL_FALSE;
+    config.interrupt_pin = (hdc2080_bool_t)(rand() % 2);
+    config.interrupt_polarity = (hdc2080_interrupt_polarity_t)(rand() % 2);
+    config.interrupt_mode = (hdc2080_interrupt_mode_t)(rand() % 2);
+    config.temperature_resolution = (hdc2080_resolution_t)(rand() % 3);
+    config.humidity_resolution = (hdc2080_resolution_t)(rand() % 3);
+    config.mode = (hdc2080_mode_t)(rand() % 2);
+    config.measurement = HDC2080_BOOL_FALSE;
+    res = hdc2080_apply_config(&gs_handle, &config);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: apply config failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: apply random config.\n");
+    res = hdc2080_get_config(&gs_handle, &config_check);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get config failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: check config %s.\n", memcmp(&config, &config_check, sizeof(hdc2080_config_t)) == 0 ? "ok" : "error");
+    res = hdc2080_apply_config(&gs_handle, NULL);
+    hdc2080_interface_debug_print("hdc2080: check null config %s.\n", (res == 4) ? "ok" : "error");
+    (void)hdc2080_deinit(&gs_handle);
+    
+    /* context link test */
+    hdc2080_interface_debug_print("hdc2080: context link test.\n");
+    
+    /* link the context functions */
+    memset(&bus, 0, sizeof(hdc2080_interface_bus_t));
+    strncpy(bus.name, "/dev/i2c-1", 31);
+    DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
+    DRIVER_HDC2080_LINK_CONTEXT(&gs_handle, &bus);
+    DRIVER_HDC2080_LINK_IIC_INIT_CTX(&gs_handle, hdc2080_interface_iic_init_ctx);
+    DRIVER_HDC2080_LINK_IIC_DEINIT_CTX(&gs_handle, hdc2080_interface_iic_deinit_ctx);
+    DRIVER_HDC2080_LINK_IIC_READ_CTX(&gs_handle, hdc2080_interface_iic_read_ctx);
+    DRIVER_HDC2080_LINK_IIC_WRITE_CTX(&gs_handle, hdc2080_interface_iic_write_ctx);
+    DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
+    res = hdc2080_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set addr pin failed.\n");
+        
+        return 1;
+    }
+    res = hdc2080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: init failed.\n");
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: init with the context %s.\n", bus.name);
+    res = hdc2080_set_heater(&gs_handle, HDC2080_BOOL_FALSE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set heater failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_get_heater(&gs_handle, &enable);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get heater failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc2080_interface_debug_print("hdc2080: check context heater %s.\n", enable == HDC2080_BOOL_FALSE ? "ok" : "error");
+    (void)hdc2080_deinit(&gs_handle);
+    
+    /* lock test */
+    hdc2080_interface_debug_print("hdc2080: lock test.\n");
+    
+    /* link the lock functions */
+    DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
+    DRIVER_HDC2080_LINK_IIC_INIT(&gs_handle, hdc2080_interface_iic_init);
+    DRIVER_HDC2080_LINK_IIC_DEINIT(&gs_handle, hdc2080_interface_iic_deinit);
+    DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, a_hdc2080_register_test_iic_read);
+    DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, a_hdc2080_register_test_iic_write);
+    DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_LOCK(&gs_handle, a_hdc2080_register_test_lock);
+    DRIVER_HDC2080_LINK_UNLOCK(&gs_handle, a_hdc2080_register_test_unlock);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
+    gs_lock_depth = 0;
+    gs_lock_times = 0;
+    gs_unlocked_times = 0;
+    res = hdc2080_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set addr pin failed.\n");
+        
+        return 1;
+    }
+    res = hdc2080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* read modify write under the lock */
+    res = hdc2080_set_interrupt_polarity(&gs_handle, HDC2080_INTERRUPT_POLARITY_HIGH);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set interrupt polarity failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_set_interrupt(&gs_handle, HDC2080_INTERRUPT_DRDY, HDC2080_BOOL_TRUE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set interrupt failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_get_interrupt_polarity(&gs_handle, &polarity);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get interrupt polarity failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_set_register_cache(&gs_handle, HDC2080_BOOL_TRUE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set register cache failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc2080_set_interrupt(&gs_handle, HDC2080_INTERRUPT_DRDY, HDC2080_BOOL_FALSE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set interrupt failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* every poll read is locked and no wait holds the bus */
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, a_hdc2080_register_test_delay_us);
+    gs_locked_delays = 0;
+    for (i = 0; i < 3; i++)
+    {
+        res = hdc2080_read_poll(&gs_handle);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: read poll failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    hdc2080_interface_debug_print("hdc2080: lock %d times.\n", gs_lock_times);
+    hdc2080_interface_debug_print("hdc2080: check lock balance %s.\n", gs_lock_depth == 0 ? "ok" : "error");
+    hdc2080_interface_debug_print("hdc2080: check locked access %s.\n", ((gs_unlocked_times == 0) && (gs_lock_times != 0)) ? "ok" : "error");
+    hdc2080_interface_debug_print("hdc2080: check unlocked wait %s.\n", (gs_locked_delays == 0) ? "ok" : "error");
+    hdc2080_interface_debug_print("hdc2080: check lock interrupt polarity %s.\n", polarity == HDC2080_INTERRUPT_POLARITY_HIGH ? "ok" : "error");
+    
     /* finish register */
     hdc2080_interface_debug_print("hdc2080: finish register test.\n");
     (void)hdc2080_deinit(&gs_handle);
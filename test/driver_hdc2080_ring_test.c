@@ -0,0 +1,255 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_ring_test.c
+ * @brief     driver hdc2080 ring test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_ring_test.h"
+#include "driver_hdc2080_ring.h"
+
+#define RING_TEST_SLOT        8        /**< ring slot number */
+
+static hdc2080_handle_t gs_handle;                                  /**< hdc2080 handle */
+static hdc2080_ring_t gs_ring;                                     /**< hdc2080 ring */
+static hdc2080_ring_sample_t gs_slot[RING_TEST_SLOT];              /**< ring slots */
+static hdc2080_ring_sample_t gs_batch[RING_TEST_SLOT * 2];         /**< pop batch */
+
+/**
+ * @brief     read a sample and push it
+ * @param[in] time sample time
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 4 ring is full
+ * @note      none
+ */
+static uint8_t a_hdc2080_ring_test_push(uint64_t time)
+{
+    hdc2080_snapshot_t snapshot;
+    hdc2080_ring_sample_t sample;
+    
+    if (hdc2080_read_poll(&gs_handle) != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: read poll failed.\n");
+        
+        return 1;
+    }
+    if (hdc2080_read_snapshot(&gs_handle, &snapshot) != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: read snapshot failed.\n");
+        
+        return 1;
+    }
+    sample.timestamp_us = time;
+    sample.temperature_raw = snapshot.temperature_raw;
+    sample.temperature_centi = snapshot.temperature_centi;
+    sample.humidity_raw = snapshot.humidity_raw;
+    sample.humidity_centi = snapshot.humidity_centi;
+    sample.status = snapshot.status;
+    if (hdc2080_ring_push(&gs_ring, &sample) != 0)
+    {
+        return 4;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     ring test
+ * @param[in] addr_pin address pin
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the samples are pushed and popped from one thread to check the order, wrap and drop
+ */
+uint8_t hdc2080_ring_test(hdc2080_address_t addr_pin, uint32_t times)
+{
+    uint8_t res;
+    uint8_t ok;
+    uint32_t i;
+    uint32_t j;
+    uint32_t num;
+    uint32_t dropped;
+    uint32_t expect;
+    hdc2080_info_t info;
+    
+    /* link interface function */
+    DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t); 
+    DRIVER_HDC2080_LINK_IIC_INIT(&gs_handle, hdc2080_interface_iic_init);
+    DRIVER_HDC2080_LINK_IIC_DEINIT(&gs_handle, hdc2080_interface_iic_deinit);
+    DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
+    DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
+    DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
+    
+    /* get information */
+    res = hdc2080_info(&info);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        hdc2080_interface_debug_print("hdc2080: chip is %s.\n", info.chip_name);
+        hdc2080_interface_debug_print("hdc2080: manufacturer is %s.\n", info.manufacturer_name);
+        hdc2080_interface_debug_print("hdc2080: interface is %s.\n", info.interface);
+        hdc2080_interface_debug_print("hdc2080: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        hdc2080_interface_debug_print("hdc2080: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        hdc2080_interface_debug_print("hdc2080: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        hdc2080_interface_debug_print("hdc2080: max current is %0.2fmA.\n", info.max_current_ma);
+        hdc2080_interface_debug_print("hdc2080: max temperature is %0.1fC.\n", info.temperature_max);
+        hdc2080_interface_debug_print("hdc2080: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start ring test */
+    hdc2080_interface_debug_print("hdc2080: start ring test.\n");
+    
+    /* set addr pin */
+    res = hdc2080_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set addr pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* init */
+    res = hdc2080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set humidity and temperature */
+    res = hdc2080_set_mode(&gs_handle, HDC2080_MODE_HUMIDITY_TEMPERATURE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set mode failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* a slot number not a power of 2 is rejected */
+    res = hdc2080_ring_init(&gs_ring, gs_slot, RING_TEST_SLOT - 2);
+    hdc2080_interface_debug_print("hdc2080: check ring slot number %s.\n", (res == 4) ? "ok" : "error");
+    res = hdc2080_ring_init(&gs_ring, gs_slot, RING_TEST_SLOT);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: ring init failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* fill the ring, the last sample does not fit */
+    hdc2080_interface_debug_print("hdc2080: ring full test.\n");
+    for (i = 0; i < RING_TEST_SLOT; i++)
+    {
+        res = a_hdc2080_ring_test_push(i);
+        if (res == 1)
+        {
+            (void)hdc2080_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    (void)hdc2080_ring_get_count(&gs_ring, &num);
+    (void)hdc2080_ring_get_dropped(&gs_ring, &dropped);
+    hdc2080_interface_debug_print("hdc2080: ring count is %d, dropped is %d.\n", num, dropped);
+    hdc2080_interface_debug_print("hdc2080: check ring full %s.\n", ((res == 4) && (num == RING_TEST_SLOT - 1) && (dropped == 1)) ? "ok" : "error");
+    
+    /* pop half and check the order */
+    (void)hdc2080_ring_pop(&gs_ring, gs_batch, RING_TEST_SLOT / 2, &num);
+    ok = (num == RING_TEST_SLOT / 2) ? 1 : 0;
+    for (i = 0; i < num; i++)
+    {
+        if ((gs_batch[i].sequence != i) || (gs_batch[i].timestamp_us != i))
+        {
+            ok = 0;
+        }
+        if ((gs_batch[i].temperature_centi < -4000) || (gs_batch[i].temperature_centi > 12500) ||
+            (gs_batch[i].humidity_centi > 10000))
+        {
+            ok = 0;
+        }
+    }
+    hdc2080_interface_debug_print("hdc2080: check ring order %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* push and pop across the wrap */
+    hdc2080_interface_debug_print("hdc2080: ring wrap test.\n");
+    expect = RING_TEST_SLOT / 2;
+    ok = 1;
+    for (i = 0; i < times; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            res = a_hdc2080_ring_test_push(RING_TEST_SLOT + i * 3 + j);
+            if (res != 0)
+            {
+                ok = 0;
+            }
+        }
+        (void)hdc2080_ring_pop(&gs_ring, gs_batch, RING_TEST_SLOT * 2, &num);
+        for (j = 0; j < num; j++)
+        {
+            /* the dropped sample leaves a gap in the sequence */
+            if (expect == RING_TEST_SLOT - 1)
+            {
+                expect++;
+            }
+            if (gs_batch[j].sequence != expect)
+            {
+                ok = 0;
+            }
+            expect++;
+        }
+    }
+    (void)hdc2080_ring_get_count(&gs_ring, &num);
+    hdc2080_interface_debug_print("hdc2080: popped up to sequence %d.\n", expect - 1);
+    hdc2080_interface_debug_print("hdc2080: check ring wrap %s.\n", ((ok != 0) && (num == 0)) ? "ok" : "error");
+    
+    /* finish ring test */
+    (void)hdc2080_ring_deinit(&gs_ring);
+    hdc2080_interface_debug_print("hdc2080: finish ring test.\n");
+    (void)hdc2080_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_scheduler_test.c
+ * @brief     driver hdc2080 scheduler test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_scheduler_test.h"
+#include "driver_hdc2080_scheduler.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief scheduler test iic device definition
+ */
+#ifndef HDC2080_SCHEDULER_TEST_IIC_NAME
+    #define HDC2080_SCHEDULER_TEST_IIC_NAME "/dev/i2c-1"        /**< iic device of the sensors */
+#endif
+
+static hdc2080_handle_t gs_handle[2];                      /**< hdc2080 handles */
+static hdc2080_interface_bus_t gs_bus[2];                  /**< bus context of each handle */
+static hdc2080_scheduler_sensor_t gs_sensor[2];            /**< scheduler sensor table */
+static hdc2080_scheduler_t gs_scheduler;                   /**< hdc2080 scheduler */
+static hdc2080_handle_t *gs_all[2];                        /**< read all handle table */
+static hdc2080_snapshot_t gs_snapshot[2];                  /**< read all snapshots */
+
+/**
+ * @brief     scheduler test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the sensors at both addresses are scheduled, a missing sensor is skipped
+ */
+uint8_t hdc2080_scheduler_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t count;
+    uint32_t now_us;
+    uint32_t wait_us;
+    uint32_t timeout_us;
+    uint32_t done;
+    const uint32_t rate_hz = 200;
+    const hdc2080_address_t addr_pin[2] = {HDC2080_ADDRESS_0, HDC2080_ADDRESS_1};
+    hdc2080_info_t info;
+    
+    /* get information */
+    res = hdc2080_info(&info);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        hdc2080_interface_debug_print("hdc2080: chip is %s.\n", info.chip_name);
+        hdc2080_interface_debug_print("hdc2080: manufacturer is %s.\n", info.manufacturer_name);
+        hdc2080_interface_debug_print("hdc2080: interface is %s.\n", info.interface);
+        hdc2080_interface_debug_print("hdc2080: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        hdc2080_interface_debug_print("hdc2080: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        hdc2080_interface_debug_print("hdc2080: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        hdc2080_interface_debug_print("hdc2080: max current is %0.2fmA.\n", info.max_current_ma);
+        hdc2080_interface_debug_print("hdc2080: max temperature is %0.1fC.\n", info.temperature_max);
+        hdc2080_interface_debug_print("hdc2080: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start scheduler test */
+    hdc2080_interface_debug_print("hdc2080: start scheduler test.\n");
+    
+    /* init all sensors */
+    count = 0;
+    for (i = 0; i < 2; i++)
+    {
+        /* every handle owns its bus context */
+        memset(&gs_bus[count], 0, sizeof(hdc2080_interface_bus_t));
+        strncpy(gs_bus[count].name, HDC2080_SCHEDULER_TEST_IIC_NAME, sizeof(gs_bus[count].name) - 1);
+        gs_bus[count].fd = -1;
+        
+        /* link interface function */
+        DRIVER_HDC2080_LINK_INIT(&gs_handle[count], hdc2080_handle_t); 
+        DRIVER_HDC2080_LINK_CONTEXT(&gs_handle[count], &gs_bus[count]);
+        DRIVER_HDC2080_LINK_IIC_INIT_CTX(&gs_handle[count], hdc2080_interface_iic_init_ctx);
+        DRIVER_HDC2080_LINK_IIC_DEINIT_CTX(&gs_handle[count], hdc2080_interface_iic_deinit_ctx);
+        DRIVER_HDC2080_LINK_IIC_READ_CTX(&gs_handle[count], hdc2080_interface_iic_read_ctx);
+        DRIVER_HDC2080_LINK_IIC_WRITE_CTX(&gs_handle[count], hdc2080_interface_iic_write_ctx);
+        DRIVER_HDC2080_LINK_IIC_READ_BATCH(&gs_handle[count], hdc2080_interface_iic_read_batch);
+        DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle[count], hdc2080_interface_delay_ms);
+        DRIVER_HDC2080_LINK_DELAY_US(&gs_handle[count], hdc2080_interface_delay_us);
+        DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle[count], hdc2080_interface_debug_print);
+        
+        /* set addr pin */
+        res = hdc2080_set_addr_pin(&gs_handle[count], addr_pin[i]);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: set addr pin failed.\n");
+            
+            goto deinit;
+        }
+        
+        /* init */
+        res = hdc2080_init(&gs_handle[count]);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: no sensor at address %d.\n", i);
+            
+            continue;
+        }
+        
+        /* enable the register cache so a trigger is one write */
+        res = hdc2080_set_register_cache(&gs_handle[count], HDC2080_BOOL_TRUE);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: set register cache failed.\n");
+            count++;
+            
+            goto deinit;
+        }
+        gs_sensor[count].handle = &gs_handle[count];
+        count++;
+        hdc2080_interface_debug_print("hdc2080: add sensor at address %d.\n", i);
+    }
+    if (count == 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: no sensor found.\n");
+        
+        return 1;
+    }
+    
+    /* init the scheduler */
+    now_us = 0;
+    res = hdc2080_scheduler_init(&gs_scheduler, gs_sensor, count, rate_hz, now_us);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: scheduler init failed.\n");
+        
+        goto deinit;
+    }
+    hdc2080_interface_debug_print("hdc2080: schedule %d sensors at %d triggers per second.\n", count, rate_hz);
+    
+    /* run until every sensor has enough samples */
+    timeout_us = (times + 2) * count * (1000000 / rate_hz) * 4;
+    while (now_us < timeout_us)
+    {
+        res = hdc2080_scheduler_poll(&gs_scheduler, now_us, &wait_us);
+        if (res != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: scheduler poll failed.\n");
+            
+            goto deinit;
+        }
+        done = 0;
+        for (i = 0; i < count; i++)
+        {
+            if (gs_sensor[i].samples >= times)
+            {
+                done++;
+            }
+        }
+        if (done == count)
+        {
+            break;
+        }
+        if (wait_us != 0)
+        {
+            hdc2080_interface_delay_us(wait_us);
+        }
+        now_us += wait_us;
+    }
+    
+    /* print the sensor table */
+    for (i = 0; i < count; i++)
+    {
+        hdc2080_interface_debug_print("hdc2080: sensor %d temperature is %s%d.%02dC.\n", i,
+                                      (gs_sensor[i].temperature_centi < 0) ? "-" : "",
+                                      abs(gs_sensor[i].temperature_centi) / 100, abs(gs_sensor[i].temperature_centi) % 100);
+        hdc2080_interface_debug_print("hdc2080: sensor %d humidity is %d.%02d%%.\n", i,
+                                      gs_sensor[i].humidity_centi / 100, gs_sensor[i].humidity_centi % 100);
+        hdc2080_interface_debug_print("hdc2080: sensor %d samples %d, errors %d, overruns %d.\n", i,
+                                      gs_sensor[i].samples, gs_sensor[i].errors, gs_sensor[i].overruns);
+        hdc2080_interface_debug_print("hdc2080: check sensor %d samples %s.\n", i, (gs_sensor[i].samples >= times) ? "ok" : "error");
+        hdc2080_interface_debug_print("hdc2080: check sensor %d errors %s.\n", i, (gs_sensor[i].errors == 0) ? "ok" : "error");
+    }
+    hdc2080_interface_debug_print("hdc2080: %d samples in %dus.\n", times * count, now_us);
+    (void)hdc2080_scheduler_deinit(&gs_scheduler);
+    
+    /* read all sensors in one batched transfer */
+    for (i = 0; i < count; i++)
+    {
+        gs_all[i] = &gs_handle[i];
+    }
+    res = hdc2080_read_all(gs_all, (uint8_t)count, gs_snapshot);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: read all failed.\n");
+        
+        goto deinit;
+    }
+    for (i = 0; i < count; i++)
+    {
+        hdc2080_interface_debug_print("hdc2080: read all sensor %d temperature is %s%d.%02dC.\n", i,
+                                      (gs_snapshot[i].temperature_centi < 0) ? "-" : "",
+                                      abs(gs_snapshot[i].temperature_centi) / 100, abs(gs_snapshot[i].temperature_centi) % 100);
+        hdc2080_interface_debug_print("hdc2080: read all sensor %d humidity is %d.%02d%%.\n", i,
+                                      gs_snapshot[i].humidity_centi / 100, gs_snapshot[i].humidity_centi % 100);
+        hdc2080_interface_debug_print("hdc2080: check read all sensor %d %s.\n", i,
+                                      ((gs_snapshot[i].temperature_centi >= -4050) && (gs_snapshot[i].temperature_centi <= 12500) &&
+                                       (gs_snapshot[i].humidity_centi <= 10000)) ? "ok" : "error");
+    }
+    
+    /* finish scheduler test */
+    hdc2080_interface_debug_print("hdc2080: finish scheduler test.\n");
+    for (i = 0; i < count; i++)
+    {
+        (void)hdc2080_deinit(&gs_handle[i]);
+    }
+    
+    return 0;
+    
+    deinit:
+    for (i = 0; i < count; i++)
+    {
+        (void)hdc2080_deinit(&gs_handle[i]);
+    }
+    
+    return 1;
+}
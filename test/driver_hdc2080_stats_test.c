@@ -0,0 +1,478 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc2080_stats_test.c
+ * @brief     driver hdc2080 stats test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc2080_stats_test.h"
+#include "driver_hdc2080_stats.h"
+#include <math.h>
+
+#define STATS_TEST_MAX           256         /**< max sample number */
+#define STATS_TEST_WINDOW        5           /**< window length */
+#define STATS_TEST_ALPHA         0.25        /**< ewma weight */
+
+static hdc2080_handle_t gs_handle;                              /**< hdc2080 handle */
+static int32_t gs_x[2][STATS_TEST_MAX];                         /**< temperature and humidity samples */
+static hdc2080_stats_centi_t gs_stats_centi;                    /**< fixed point stats */
+#if (HDC2080_USE_FLOAT == 1)
+static hdc2080_stats_t gs_stats;                                /**< float stats */
+#endif
+
+/**
+ * @brief reference summary structure definition
+ */
+typedef struct stats_test_reference_s
+{
+    double min;             /**< min */
+    double max;             /**< max */
+    double mean;            /**< mean */
+    double variance;        /**< sample variance */
+    double ewma;            /**< ewma */
+} stats_test_reference_t;
+
+/**
+ * @brief      two pass reference of a sample range
+ * @param[in]  *x pointer to a sample array in 0.01 units
+ * @param[in]  start first sample of the window
+ * @param[in]  len window length
+ * @param[out] *ref pointer to a reference buffer
+ * @note       the ewma starts at the first sample of the array and runs to the end of the window
+ */
+static void a_hdc2080_stats_test_reference(const int32_t *x, uint32_t start, uint32_t len, stats_test_reference_t *ref)
+{
+    uint32_t i;
+    double sum;
+    
+    /* first pass */
+    sum = 0.0;
+    ref->min = x[start];
+    ref->max = x[start];
+    for (i = start; i < start + len; i++)
+    {
+        sum += x[i];
+        ref->min = (x[i] < ref->min) ? x[i] : ref->min;
+        ref->max = (x[i] > ref->max) ? x[i] : ref->max;
+    }
+    ref->mean = sum / len;
+    
+    /* second pass */
+    sum = 0.0;
+    for (i = start; i < start + len; i++)
+    {
+        sum += (x[i] - ref->mean) * (x[i] - ref->mean);
+    }
+    ref->variance = (len > 1) ? (sum / (len - 1)) : 0.0;
+    
+    /* ewma */
+    ref->ewma = x[0];
+    for (i = 1; i < start + len; i++)
+    {
+        ref->ewma += (x[i] - ref->ewma) * STATS_TEST_ALPHA;
+    }
+}
+
+/**
+ * @brief     check a fixed point channel summary
+ * @param[in] *summary pointer to a channel summary
+ * @param[in] *ref pointer to a reference in 0.01 units
+ * @return    1 if it matches, else 0
+ * @note      the mean and the ewma may be 1 lsb off, the variance 1 lsb plus 0.1%
+ */
+static uint8_t a_hdc2080_stats_test_check_centi(const hdc2080_stats_channel_summary_centi_t *summary,
+                                                const stats_test_reference_t *ref)
+{
+    double variance = ref->variance;
+    
+    if ((summary->min != (int32_t)ref->min) || (summary->max != (int32_t)ref->max))
+    {
+        return 0;
+    }
+    if ((fabs(summary->mean - ref->mean) > 1.0) || (fabs(summary->ewma - ref->ewma) > 1.0))
+    {
+        return 0;
+    }
+    if (fabs(summary->variance - variance) > (1.0 + variance * 0.001))
+    {
+        return 0;
+    }
+    
+    return 1;
+}
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief     check a float channel summary
+ * @param[in] *summary pointer to a channel summary
+ * @param[in] *ref pointer to a reference in 0.01 units
+ * @return    1 if it matches, else 0
+ * @note      the values must be within 0.1% of the range or 0.001
+ */
+static uint8_t a_hdc2080_stats_test_check(const hdc2080_stats_channel_summary_t *summary,
+                                          const stats_test_reference_t *ref)
+{
+    double tolerance = 0.001 + fabs(ref->max) * 0.00001;
+    
+    if ((fabs(summary->min - ref->min / 100.0) > tolerance) || (fabs(summary->max - ref->max / 100.0) > tolerance))
+    {
+        return 0;
+    }
+    if ((fabs(summary->mean - ref->mean / 100.0) > tolerance) || (fabs(summary->ewma - ref->ewma / 100.0) > tolerance))
+    {
+        return 0;
+    }
+    if (fabs(summary->variance - ref->variance / 10000.0) > (0.0001 + ref->variance / 10000.0 * 0.001))
+    {
+        return 0;
+    }
+    
+    return 1;
+}
+#endif
+
+/**
+ * @brief     check the fixed point windows of the samples
+ * @param[in] n sample number
+ * @return    1 if all windows match, else 0
+ * @note      none
+ */
+static uint8_t a_hdc2080_stats_test_windows_centi(uint32_t n)
+{
+    uint8_t ok;
+    uint32_t i;
+    uint32_t window;
+    stats_test_reference_t ref[2];
+    hdc2080_stats_summary_centi_t summary;
+    
+    /* full windows */
+    (void)hdc2080_stats_init_centi(&gs_stats_centi, STATS_TEST_WINDOW, (uint32_t)(STATS_TEST_ALPHA * 65536));
+    ok = 1;
+    window = 0;
+    for (i = 0; i < n; i++)
+    {
+        (void)hdc2080_stats_update_centi(&gs_stats_centi, i, (int16_t)gs_x[0][i], (uint16_t)gs_x[1][i]);
+        if (hdc2080_stats_get_window_centi(&gs_stats_centi, &summary) == 0)
+        {
+            a_hdc2080_stats_test_reference(gs_x[0], i + 1 - STATS_TEST_WINDOW, STATS_TEST_WINDOW, &ref[0]);
+            a_hdc2080_stats_test_reference(gs_x[1], i + 1 - STATS_TEST_WINDOW, STATS_TEST_WINDOW, &ref[1]);
+            if ((summary.window != window) || (summary.count != STATS_TEST_WINDOW) ||
+                (summary.first_us != i + 1 - STATS_TEST_WINDOW) || (summary.last_us != i) ||
+                (a_hdc2080_stats_test_check_centi(&summary.temperature, &ref[0]) == 0) ||
+                (a_hdc2080_stats_test_check_centi(&summary.humidity, &ref[1]) == 0))
+            {
+                ok = 0;
+            }
+            window++;
+        }
+    }
+    if (window != n / STATS_TEST_WINDOW)
+    {
+        ok = 0;
+    }
+    
+    /* the partial window */
+    a_hdc2080_stats_test_reference(gs_x[0], n - n % STATS_TEST_WINDOW, n % STATS_TEST_WINDOW, &ref[0]);
+    a_hdc2080_stats_test_reference(gs_x[1], n - n % STATS_TEST_WINDOW, n % STATS_TEST_WINDOW, &ref[1]);
+    if ((hdc2080_stats_get_summary_centi(&gs_stats_centi, &summary) != 0) || (summary.count != n % STATS_TEST_WINDOW) ||
+        (a_hdc2080_stats_test_check_centi(&summary.temperature, &ref[0]) == 0) ||
+        (a_hdc2080_stats_test_check_centi(&summary.humidity, &ref[1]) == 0))
+    {
+        ok = 0;
+    }
+    
+    return ok;
+}
+
+#if (HDC2080_USE_FLOAT == 1)
+/**
+ * @brief     check the float windows of the samples
+ * @param[in] n sample number
+ * @return    1 if all windows match, else 0
+ * @note      none
+ */
+static uint8_t a_hdc2080_stats_test_windows(uint32_t n)
+{
+    uint8_t ok;
+    uint32_t i;
+    uint32_t window;
+    stats_test_reference_t ref[2];
+    hdc2080_stats_summary_t summary;
+    
+    /* full windows */
+    (void)hdc2080_stats_init(&gs_stats, STATS_TEST_WINDOW, (float)STATS_TEST_ALPHA);
+    ok = 1;
+    window = 0;
+    for (i = 0; i < n; i++)
+    {
+        (void)hdc2080_stats_update(&gs_stats, i, (float)gs_x[0][i] / 100.0f, (float)gs_x[1][i] / 100.0f);
+        if (hdc2080_stats_get_window(&gs_stats, &summary) == 0)
+        {
+            a_hdc2080_stats_test_reference(gs_x[0], i + 1 - STATS_TEST_WINDOW, STATS_TEST_WINDOW, &ref[0]);
+            a_hdc2080_stats_test_reference(gs_x[1], i + 1 - STATS_TEST_WINDOW, STATS_TEST_WINDOW, &ref[1]);
+            if ((summary.window != window) || (summary.count != STATS_TEST_WINDOW) ||
+                (a_hdc2080_stats_test_check(&summary.temperature, &ref[0]) == 0) ||
+                (a_hdc2080_stats_test_check(&summary.humidity, &ref[1]) == 0))
+            {
+                ok = 0;
+            }
+            window++;
+        }
+    }
+    if (window != n / STATS_TEST_WINDOW)
+    {
+        ok = 0;
+    }
+    
+    /* the partial window */
+    a_hdc2080_stats_test_reference(gs_x[0], n - n % STATS_TEST_WINDOW, n % STATS_TEST_WINDOW, &ref[0]);
+    a_hdc2080_stats_test_reference(gs_x[1], n - n % STATS_TEST_WINDOW, n % STATS_TEST_WINDOW, &ref[1]);
+    if ((hdc2080_stats_get_summary(&gs_stats, &summary) != 0) || (summary.count != n % STATS_TEST_WINDOW) ||
+        (a_hdc2080_stats_test_check(&summary.temperature, &ref[0]) == 0) ||
+        (a_hdc2080_stats_test_check(&summary.humidity, &ref[1]) == 0))
+    {
+        ok = 0;
+    }
+    
+    return ok;
+}
+#endif
+
+/**
+ * @brief     stats test
+ * @param[in] addr_pin address pin
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the streaming summaries are checked against a two pass reference of the same samples
+ */
+uint8_t hdc2080_stats_test(hdc2080_address_t addr_pin, uint32_t times)
+{
+    uint8_t res;
+    uint8_t ok;
+    uint32_t i;
+    uint32_t n;
+    uint32_t seed = 2080;
+    hdc2080_info_t info;
+    hdc2080_snapshot_t snapshot;
+    hdc2080_stats_summary_centi_t summary_centi;
+#if (HDC2080_USE_FLOAT == 1)
+    hdc2080_stats_summary_t summary;
+#endif
+    
+    /* link interface function */
+    DRIVER_HDC2080_LINK_INIT(&gs_handle, hdc2080_handle_t);
+    DRIVER_HDC2080_LINK_IIC_INIT(&gs_handle, hdc2080_interface_iic_init);
+    DRIVER_HDC2080_LINK_IIC_DEINIT(&gs_handle, hdc2080_interface_iic_deinit);
+    DRIVER_HDC2080_LINK_IIC_READ(&gs_handle, hdc2080_interface_iic_read);
+    DRIVER_HDC2080_LINK_IIC_WRITE(&gs_handle, hdc2080_interface_iic_write);
+    DRIVER_HDC2080_LINK_DELAY_MS(&gs_handle, hdc2080_interface_delay_ms);
+    DRIVER_HDC2080_LINK_DELAY_US(&gs_handle, hdc2080_interface_delay_us);
+    DRIVER_HDC2080_LINK_DEBUG_PRINT(&gs_handle, hdc2080_interface_debug_print);
+    
+    /* get information */
+    res = hdc2080_info(&info);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: get info failed.\n");
+    
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        hdc2080_interface_debug_print("hdc2080: chip is %s.\n", info.chip_name);
+        hdc2080_interface_debug_print("hdc2080: manufacturer is %s.\n", info.manufacturer_name);
+        hdc2080_interface_debug_print("hdc2080: interface is %s.\n", info.interface);
+        hdc2080_interface_debug_print("hdc2080: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        hdc2080_interface_debug_print("hdc2080: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        hdc2080_interface_debug_print("hdc2080: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        hdc2080_interface_debug_print("hdc2080: max current is %0.2fmA.\n", info.max_current_ma);
+        hdc2080_interface_debug_print("hdc2080: max temperature is %0.1fC.\n", info.temperature_max);
+        hdc2080_interface_debug_print("hdc2080: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start stats test */
+    hdc2080_interface_debug_print("hdc2080: start stats test.\n");
+    
+    /* at least two full windows and a partial one */
+    if (times < 2)
+    {
+        times = 2;
+    }
+    if (times > (STATS_TEST_MAX - 2) / STATS_TEST_WINDOW)
+    {
+        times = (STATS_TEST_MAX - 2) / STATS_TEST_WINDOW;
+    }
+    n = times * STATS_TEST_WINDOW + 2;
+    
+    /* set addr pin */
+    res = hdc2080_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set addr pin failed.\n");
+    
+        return 1;
+    }
+    
+    /* init */
+    res = hdc2080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: init failed.\n");
+    
+        return 1;
+    }
+    
+    /* set humidity and temperature */
+    res = hdc2080_set_mode(&gs_handle, HDC2080_MODE_HUMIDITY_TEMPERATURE);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: set mode failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+    
+        return 1;
+    }
+    
+    /* read the samples */
+    hdc2080_interface_debug_print("hdc2080: read %d samples.\n", n);
+    for (i = 0; i < n; i++)
+    {
+        if (hdc2080_read_poll(&gs_handle) != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: read poll failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+    
+            return 1;
+        }
+        if (hdc2080_read_snapshot(&gs_handle, &snapshot) != 0)
+        {
+            hdc2080_interface_debug_print("hdc2080: read snapshot failed.\n");
+            (void)hdc2080_deinit(&gs_handle);
+    
+            return 1;
+        }
+        gs_x[0][i] = snapshot.temperature_centi;
+        gs_x[1][i] = snapshot.humidity_centi;
+    }
+    
+    /* check the params */
+    res = hdc2080_stats_init_centi(&gs_stats_centi, STATS_TEST_WINDOW, 0);
+    hdc2080_interface_debug_print("hdc2080: check stats alpha %s.\n", (res == 4) ? "ok" : "error");
+    res = hdc2080_stats_init_centi(&gs_stats_centi, STATS_TEST_WINDOW, 65536);
+    if (res != 0)
+    {
+        hdc2080_interface_debug_print("hdc2080: stats init failed.\n");
+        (void)hdc2080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ok = (hdc2080_stats_get_summary_centi(&gs_stats_centi, &summary_centi) == 4) ? 1 : 0;
+    ok = (hdc2080_stats_get_window_centi(&gs_stats_centi, &summary_centi) == 4) ? ok : 0;
+    hdc2080_interface_debug_print("hdc2080: check stats empty %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* fixed point windows of the sensor samples */
+    hdc2080_interface_debug_print("hdc2080: stats fixed point test.\n");
+    ok = a_hdc2080_stats_test_windows_centi(n);
+    (void)hdc2080_stats_get_summary_centi(&gs_stats_centi, &summary_centi);
+    hdc2080_interface_debug_print("hdc2080: temperature min %0.2fC max %0.2fC mean %0.2fC ewma %0.2fC variance %0.4f.\n",
+                                  (float)summary_centi.temperature.min / 100.0f, (float)summary_centi.temperature.max / 100.0f,
+                                  (float)summary_centi.temperature.mean / 100.0f, (float)summary_centi.temperature.ewma / 100.0f,
+                                  (float)summary_centi.temperature.variance / 10000.0f);
+    hdc2080_interface_debug_print("hdc2080: humidity min %0.2f%% max %0.2f%% mean %0.2f%% ewma %0.2f%% variance %0.4f.\n",
+                                  (float)summary_centi.humidity.min / 100.0f, (float)summary_centi.humidity.max / 100.0f,
+                                  (float)summary_centi.humidity.mean / 100.0f, (float)summary_centi.humidity.ewma / 100.0f,
+                                  (float)summary_centi.humidity.variance / 10000.0f);
+    hdc2080_interface_debug_print("hdc2080: check stats fixed point sensor windows %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* a full scale pseudo random stream */
+    for (i = 0; i < STATS_TEST_MAX; i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        gs_x[0][i] = -4000 + (int32_t)((seed >> 8) % 16501);
+        seed = seed * 1103515245U + 12345U;
+        gs_x[1][i] = (int32_t)((seed >> 8) % 10001);
+    }
+    n = (STATS_TEST_MAX - 2) / STATS_TEST_WINDOW * STATS_TEST_WINDOW + 2;
+    ok = a_hdc2080_stats_test_windows_centi(n);
+    hdc2080_interface_debug_print("hdc2080: check stats fixed point random windows %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* a long stream with a large offset and a tiny spread */
+    (void)hdc2080_stats_init_centi(&gs_stats_centi, 0, 65536);
+    for (i = 0; i < 100000; i++)
+    {
+        (void)hdc2080_stats_update_centi(&gs_stats_centi, i, (int16_t)(12498 + (i & 1) * 2), 9999);
+    }
+    (void)hdc2080_stats_get_summary_centi(&gs_stats_centi, &summary_centi);
+    hdc2080_interface_debug_print("hdc2080: check stats fixed point stability %s.\n",
+                                  ((summary_centi.temperature.mean == 12499) && (summary_centi.temperature.variance == 1) &&
+                                   (summary_centi.humidity.variance == 0)) ? "ok" : "error");
+    
+    /* the full 16 bit inputs are clamped to the sensor range */
+    (void)hdc2080_stats_init_centi(&gs_stats_centi, 0, 65536);
+    for (i = 0; i < 1000; i++)
+    {
+        (void)hdc2080_stats_update_centi(&gs_stats_centi, i, (i & 1) ? INT16_MAX : INT16_MIN, UINT16_MAX);
+    }
+    (void)hdc2080_stats_get_summary_centi(&gs_stats_centi, &summary_centi);
+    hdc2080_interface_debug_print("hdc2080: check stats fixed point clamp %s.\n",
+                                  ((summary_centi.temperature.min == -4050) && (summary_centi.temperature.max == 12500) &&
+                                   (summary_centi.temperature.mean == 4225) && (summary_centi.humidity.max == 10000)) ? "ok" : "error");
+    
+#if (HDC2080_USE_FLOAT == 1)
+    /* float windows of the random stream */
+    hdc2080_interface_debug_print("hdc2080: stats float test.\n");
+    res = hdc2080_stats_init(&gs_stats, STATS_TEST_WINDOW, 0.0f);
+    hdc2080_interface_debug_print("hdc2080: check stats alpha %s.\n", (res == 4) ? "ok" : "error");
+    ok = a_hdc2080_stats_test_windows(n);
+    hdc2080_interface_debug_print("hdc2080: check stats float random windows %s.\n", (ok != 0) ? "ok" : "error");
+    
+    /* a long stream with a large offset and a tiny spread */
+    (void)hdc2080_stats_init(&gs_stats, 0, 1.0f);
+    for (i = 0; i < 100000; i++)
+    {
+        (void)hdc2080_stats_update(&gs_stats, i, 124.99f + (float)(i & 1) * 0.02f, 99.99f);
+    }
+    (void)hdc2080_stats_get_summary(&gs_stats, &summary);
+    hdc2080_interface_debug_print("hdc2080: stats float variance is %0.6f.\n", summary.temperature.variance);
+    hdc2080_interface_debug_print("hdc2080: check stats float stability %s.\n",
+                                  ((fabs(summary.temperature.mean - 125.0) < 0.001) &&
+                                   (fabs(summary.temperature.variance - 0.0001) < 0.00001)) ? "ok" : "error");
+#endif
+    
+    /* finish stats test */
+    hdc2080_interface_debug_print("hdc2080: finish stats test.\n");
+    (void)hdc2080_deinit(&gs_handle);
+    
+    return 0;
+}